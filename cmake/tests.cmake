@@ -26,10 +26,14 @@ FetchContent_MakeAvailable(GTest testing-plugins)
 
 set(LOOT_SRC_TESTS_GUI_CPP_FILES
     "${CMAKE_SOURCE_DIR}/src/tests/gui/main.cpp"
-    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/non_blocking_test_task.cpp")
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/non_blocking_test_task.cpp"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/test_http_server.cpp")
 
 set(LOOT_SRC_TESTS_GUI_H_FILES
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/state/censoring_file_sink_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/change_count_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/state/diagnostics_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection/cache_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection/common_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection/detail_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection/epic_games_store_test.h"
@@ -47,9 +51,19 @@ set(LOOT_SRC_TESTS_GUI_H_FILES
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/helpers_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/loot_paths_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/loot_settings_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/state/stage_graph_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/state/tracing_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/card_height_calculator_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/counters_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/diagnostics_report_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/groups_editor/layout_input_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/helpers_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/network_task_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/non_blocking_test_task.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/task_scheduler_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/tasks_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/test_http_server.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/update_masterlist_task_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/backup_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/helpers_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/sourced_message_test.h"
@@ -73,8 +87,22 @@ set(LOOT_GUI_TESTS_ALL_SOURCES
     "${CMAKE_SOURCE_DIR}/src/gui/helpers.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/plugin_item.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/sourced_message.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/card.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/card_height_calculator.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/counters.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/diagnostics_report.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/groups_editor/layout_input.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/qt/helpers.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/icon_factory.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/messages_widget.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/plugin_card.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/network_task.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/task_scheduler.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/tasks.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/update_masterlist_task.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/censoring_file_sink.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/diagnostics.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/cache.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/common.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/detail.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/epic_games_store.cpp"
@@ -96,14 +124,30 @@ set(LOOT_GUI_TESTS_ALL_SOURCES
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_paths.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_settings.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_state.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/stage_graph.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/tracing.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/translate.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/backup.h"
     "${CMAKE_SOURCE_DIR}/src/gui/helpers.h"
     "${CMAKE_SOURCE_DIR}/src/gui/plugin_item.h"
     "${CMAKE_SOURCE_DIR}/src/gui/sourced_message.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/card.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/card_height_calculator.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/counters.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/diagnostics_report.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/groups_editor/layout_input.h"
     "${CMAKE_SOURCE_DIR}/src/gui/qt/helpers.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/icon_factory.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/messages_widget.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/plugin_card.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/network_task.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/task_scheduler.h"
     "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/tasks.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/update_masterlist_task.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/censoring_file_sink.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/change_count.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/diagnostics.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/cache.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/common.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/detail.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/epic_games_store.h"
@@ -118,6 +162,7 @@ set(LOOT_GUI_TESTS_ALL_SOURCES
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/game.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_id.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_settings.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_snapshot.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/games_manager.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/group_node_positions.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/helpers.h"
@@ -125,6 +170,8 @@ set(LOOT_GUI_TESTS_ALL_SOURCES
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_paths.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_settings.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_state.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/stage_graph.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/tracing.h"
     "${CMAKE_SOURCE_DIR}/src/gui/translate.h")
 
 ##############################
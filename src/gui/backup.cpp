@@ -21,74 +21,95 @@
     <https://www.gnu.org/licenses/>.
     */
 
+
 #include "gui/backup.h"
 
 #include <mz.h>
+#include <mz_crypt.h>
+#include <mz_os.h>
 #include <mz_strm.h>
 #include <mz_zip.h>
 #include <mz_zip_rw.h>
 
-#include <cstdint>
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <algorithm>
+#include <execution>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include "gui/state/logging.h"
+#include "gui/state/tracing.h"
 
-namespace loot {
-std::filesystem::path compressDirectory(const std::filesystem::path& dir) {
-  std::filesystem::path archivePath = dir;
-  archivePath += ".zip";
-
-  auto archivePathString = archivePath.u8string();
-  auto rootPathString = dir.u8string();
-
-  auto zipWriter = mz_zip_writer_create();
-
-  mz_zip_writer_set_compress_method(zipWriter, MZ_COMPRESS_METHOD_DEFLATE);
+namespace {
+using loot::getLogger;
+using loot::TraceSpan;
 
-  auto result =
-      mz_zip_writer_open_file(zipWriter, archivePathString.c_str(), 0, 0);
-  if (result != MZ_OK) {
-    mz_zip_writer_delete(&zipWriter);
+constexpr const char* BACKUP_MANIFEST_FILENAME = "backup-manifest.json";
 
-    auto logger = getLogger();
-    if (logger) {
-      logger->error("Failed to open zip file at {}, got error code {}",
-                    archivePathString,
-                    result);
-    }
+// Files are read and compressed in batches of up to this many bytes, so that
+// memory usage stays bounded.
+constexpr uintmax_t BATCH_SIZE = 64 * 1024 * 1024;
 
-    throw std::runtime_error("Failed to open zip file for writing");
-  }
+constexpr qsizetype CHUNK_SIZE = 1024 * 1024;
 
-  result = mz_zip_writer_add_path(
-      zipWriter, rootPathString.c_str(), rootPathString.c_str(), 0, 1);
+// qCompress() prefixes its output with the uncompressed length, and wraps the
+// raw deflate data that zip entries store in a zlib header and an Adler-32
+// trailer.
+constexpr qsizetype QCOMPRESS_LENGTH_SIZE = 4;
+constexpr qsizetype ZLIB_HEADER_SIZE = 2;
+constexpr qsizetype ZLIB_TRAILER_SIZE = 4;
 
-  if (result != MZ_OK) {
-    mz_zip_writer_close(zipWriter);
-    mz_zip_writer_delete(&zipWriter);
+struct SourceFile {
+  std::filesystem::path path;
+  std::string entryName;
+  uintmax_t size{0};
+  std::filesystem::file_time_type modificationTime;
+};
 
-    auto logger = getLogger();
-    if (logger) {
-      logger->error("Failed to add path {} to zip file, got error code {}",
-                    rootPathString,
-                    result);
-    }
+struct CompressedFile {
+  uint32_t crc{0};
+  uint16_t compressionMethod{MZ_COMPRESS_METHOD_STORE};
+  int64_t uncompressedSize{0};
+  QByteArray data;
+  std::string error;
+};
 
-    throw std::runtime_error("Failed to add path to zip file");
-  }
+// A record of a file that was added to an archive, and where its compressed
+// data was written.
+struct ArchivedFile {
+  int64_t uncompressedSize{0};
+  std::string modificationTime;
+  uint32_t crc{0};
+  uint16_t compressionMethod{MZ_COMPRESS_METHOD_STORE};
+  int64_t compressedSize{0};
+  int64_t dataOffset{0};
+};
 
-  mz_zip_writer_close(zipWriter);
-  mz_zip_writer_delete(&zipWriter);
+struct BackupManifest {
+  std::string archiveFilename;
+  uintmax_t archiveSize{0};
+  std::map<std::string, ArchivedFile> files;
+};
 
-  return archivePath;
+std::string toString(std::filesystem::file_time_type time) {
+  return std::to_string(time.time_since_epoch().count());
 }
 
-void createBackup(const std::filesystem::path& sourceDir,
-                  const std::filesystem::path& destDir) {
+std::vector<SourceFile> findSourceFiles(
+    const std::filesystem::path& sourceDir) {
+  TraceSpan span("filesystem", "Find files to back up");
+
   auto logger = getLogger();
-  if (logger) {
-    logger->trace("Creating backup of {} in {}",
-                  sourceDir.u8string(),
-                  destDir.u8string());
+
+  std::vector<SourceFile> files;
+  if (!std::filesystem::exists(sourceDir)) {
+    return files;
   }
 
   for (auto it = std::filesystem::recursive_directory_iterator(sourceDir);
@@ -108,8 +129,9 @@ void createBackup(const std::filesystem::path& sourceDir,
     }
 
     if (!it->is_regular_file() ||
-        (it.depth() == 0 && filename == "LOOTDebugLog.txt")) {
-      // Skip copying the debug log and anything that isn't a normal file.
+        (it.depth() == 0 &&
+         (filename == "LOOTDebugLog.txt" || filename == "LOOTTrace.json"))) {
+      // Skip the debug log, the trace and anything that isn't a normal file.
       if (logger) {
         logger->debug(
             "Skipping directory entry {} at depth {}", filename, it.depth());
@@ -117,16 +139,450 @@ void createBackup(const std::filesystem::path& sourceDir,
       continue;
     }
 
-    auto destPath = destDir / path.lexically_relative(sourceDir);
+    SourceFile file;
+    file.path = path;
+    file.entryName = path.lexically_relative(sourceDir).generic_u8string();
+    file.size = it->file_size();
+    file.modificationTime = it->last_write_time();
+
+    files.push_back(file);
+  }
+
+  return files;
+}
+
+uint32_t calculateCrc32(const QByteArray& data) {
+  const auto bytes = reinterpret_cast<const uint8_t*>(data.constData());
+
+  uint32_t crc = 0;
+  for (qsizetype offset = 0; offset < data.size(); offset += CHUNK_SIZE) {
+    const auto length =
+        static_cast<int32_t>(std::min(CHUNK_SIZE, data.size() - offset));
+    crc = mz_crypt_crc32_update(crc, bytes + offset, length);
+  }
+
+  return crc;
+}
+
+// This is called concurrently, so must not throw.
+CompressedFile compressFile(const SourceFile& file) {
+  CompressedFile compressed;
+
+  QFile qFile(QString::fromStdString(file.path.u8string()));
+  if (!qFile.open(QIODevice::ReadOnly)) {
+    compressed.error = qFile.errorString().toStdString();
+    return compressed;
+  }
+
+  const auto data = qFile.readAll();
+  qFile.close();
 
-    std::filesystem::create_directories(destPath.parent_path());
+  compressed.uncompressedSize = data.size();
+  compressed.crc = calculateCrc32(data);
+
+  const auto zlibData = qCompress(data);
+  const auto deflateSize = zlibData.size() - QCOMPRESS_LENGTH_SIZE -
+                           ZLIB_HEADER_SIZE - ZLIB_TRAILER_SIZE;
+
+  if (deflateSize > 0 && deflateSize < data.size()) {
+    compressed.compressionMethod = MZ_COMPRESS_METHOD_DEFLATE;
+    compressed.data =
+        zlibData.mid(QCOMPRESS_LENGTH_SIZE + ZLIB_HEADER_SIZE, deflateSize);
+  } else {
+    // Store data that doesn't compress, including empty files.
+    compressed.compressionMethod = MZ_COMPRESS_METHOD_STORE;
+    compressed.data = data;
+  }
+
+  return compressed;
+}
 
-    std::filesystem::copy(path, destPath);
+std::optional<BackupManifest> readManifest(
+    const std::filesystem::path& archiveDir) {
+  QFile file(QString::fromStdString(
+      (archiveDir / BACKUP_MANIFEST_FILENAME).u8string()));
+  if (!file.open(QIODevice::ReadOnly)) {
+    return std::nullopt;
   }
 
+  const auto json = QJsonDocument::fromJson(file.readAll()).object();
+
+  BackupManifest manifest;
+  manifest.archiveFilename = json.value("archive").toString().toStdString();
+  manifest.archiveSize =
+      static_cast<uintmax_t>(json.value("archiveSize").toInteger());
+
+  const auto files = json.value("files").toObject();
+  for (auto it = files.begin(); it != files.end(); ++it) {
+    const auto object = it.value().toObject();
+
+    ArchivedFile archivedFile;
+    archivedFile.uncompressedSize = object.value("size").toInteger();
+    archivedFile.modificationTime =
+        object.value("modified").toString().toStdString();
+    archivedFile.crc = static_cast<uint32_t>(object.value("crc").toInteger());
+    archivedFile.compressionMethod =
+        static_cast<uint16_t>(object.value("method").toInteger());
+    archivedFile.compressedSize = object.value("compressedSize").toInteger();
+    archivedFile.dataOffset = object.value("dataOffset").toInteger();
+
+    manifest.files.emplace(it.key().toStdString(), archivedFile);
+  }
+
+  if (manifest.archiveFilename.empty()) {
+    return std::nullopt;
+  }
+
+  return manifest;
+}
+
+void writeManifest(const std::filesystem::path& archiveDir,
+                   const BackupManifest& manifest) {
+  QJsonObject files;
+  for (const auto& [entryName, archivedFile] : manifest.files) {
+    QJsonObject object;
+    object["size"] = static_cast<qint64>(archivedFile.uncompressedSize);
+    object["modified"] = QString::fromStdString(archivedFile.modificationTime);
+    object["crc"] = static_cast<qint64>(archivedFile.crc);
+    object["method"] = archivedFile.compressionMethod;
+    object["compressedSize"] = static_cast<qint64>(archivedFile.compressedSize);
+    object["dataOffset"] = static_cast<qint64>(archivedFile.dataOffset);
+
+    files[QString::fromStdString(entryName)] = object;
+  }
+
+  QJsonObject json;
+  json["archive"] = QString::fromStdString(manifest.archiveFilename);
+  json["archiveSize"] = static_cast<qint64>(manifest.archiveSize);
+  json["files"] = files;
+
+  std::ofstream out(archiveDir / BACKUP_MANIFEST_FILENAME, std::ios::binary);
+  out << QJsonDocument(json).toJson(QJsonDocument::Compact).toStdString();
+}
+
+// Returns the previous backup's manifest if its archive still exists, is
+// unchanged, and is not about to be overwritten.
+std::optional<BackupManifest> getPreviousBackup(
+    const std::filesystem::path& archivePath) {
+  const auto archiveDir = archivePath.parent_path();
+  auto manifest = readManifest(archiveDir);
+  if (!manifest.has_value() ||
+      manifest->archiveFilename == archivePath.filename().u8string()) {
+    return std::nullopt;
+  }
+
+  const auto previousArchivePath =
+      archiveDir / std::filesystem::u8path(manifest->archiveFilename);
+
+  std::error_code ec;
+  const auto archiveSize = std::filesystem::file_size(previousArchivePath, ec);
+  if (ec || archiveSize != manifest->archiveSize) {
+    return std::nullopt;
+  }
+
+  return manifest;
+}
+
+const ArchivedFile* findUnchangedFile(
+    const std::optional<BackupManifest>& previousBackup,
+    const SourceFile& file) {
+  if (!previousBackup.has_value()) {
+    return nullptr;
+  }
+
+  const auto it = previousBackup->files.find(file.entryName);
+  if (it == previousBackup->files.end() ||
+      static_cast<uintmax_t>(it->second.uncompressedSize) != file.size ||
+      it->second.modificationTime != toString(file.modificationTime)) {
+    return nullptr;
+  }
+
+  return &it->second;
+}
+
+std::optional<QByteArray> readArchivedData(std::ifstream& archive,
+                                           const ArchivedFile& archivedFile) {
+  QByteArray data(static_cast<qsizetype>(archivedFile.compressedSize),
+                  Qt::Uninitialized);
+
+  archive.clear();
+  archive.seekg(archivedFile.dataOffset);
+  archive.read(data.data(), data.size());
+
+  if (!archive || archive.gcount() != data.size()) {
+    return std::nullopt;
+  }
+
+  return data;
+}
+
+class ArchiveWriter {
+public:
+  explicit ArchiveWriter(const std::filesystem::path& archivePath) :
+      archivePath_(archivePath), zipWriter_(mz_zip_writer_create()) {
+    // Entries' data is compressed before it is given to the writer.
+    mz_zip_writer_set_raw(zipWriter_, 1);
+
+    const auto archivePathString = archivePath_.u8string();
+    const auto result =
+        mz_zip_writer_open_file(zipWriter_, archivePathString.c_str(), 0, 0);
+    if (result != MZ_OK) {
+      mz_zip_writer_delete(&zipWriter_);
+
+      auto logger = getLogger();
+      if (logger) {
+        logger->error("Failed to open zip file at {}, got error code {}",
+                      archivePathString,
+                      result);
+      }
+
+      throw std::runtime_error("Failed to open zip file for writing");
+    }
+  }
+
+  ArchiveWriter(const ArchiveWriter&) = delete;
+  ArchiveWriter(ArchiveWriter&&) = delete;
+
+  ~ArchiveWriter() {
+    if (zipWriter_ != nullptr) {
+      // The archive wasn't finished, so don't leave it behind.
+      mz_zip_writer_close(zipWriter_);
+      mz_zip_writer_delete(&zipWriter_);
+
+      std::error_code ec;
+      std::filesystem::remove(archivePath_, ec);
+    }
+  }
+
+  ArchiveWriter& operator=(const ArchiveWriter&) = delete;
+  ArchiveWriter& operator=(ArchiveWriter&&) = delete;
+
+  // Writes an entry with already-compressed data and records where that data
+  // was written.
+  void writeEntry(const SourceFile& file,
+                  ArchivedFile& archivedFile,
+                  const QByteArray& data) {
+    const auto pathString = file.path.u8string();
+
+    mz_zip_file fileInfo = {};
+    fileInfo.version_madeby = MZ_VERSION_MADEBY;
+    fileInfo.flag = MZ_ZIP_FLAG_UTF8;
+    fileInfo.compression_method = archivedFile.compressionMethod;
+    fileInfo.crc = archivedFile.crc;
+    fileInfo.compressed_size = data.size();
+    fileInfo.uncompressed_size = archivedFile.uncompressedSize;
+    fileInfo.filename = file.entryName.c_str();
+
+    mz_os_get_file_date(pathString.c_str(),
+                        &fileInfo.modified_date,
+                        &fileInfo.accessed_date,
+                        &fileInfo.creation_date);
+
+    uint32_t attributes = 0;
+    if (mz_os_get_file_attribs(pathString.c_str(), &attributes) == MZ_OK) {
+      fileInfo.external_fa = attributes;
+    }
+
+    checkResult(mz_zip_writer_entry_open(zipWriter_, &fileInfo), file);
+
+    void* zipHandle = nullptr;
+    void* stream = nullptr;
+    mz_zip_writer_get_zip_handle(zipWriter_, &zipHandle);
+    mz_zip_get_stream(zipHandle, &stream);
+    archivedFile.dataOffset = mz_stream_tell(stream);
+    archivedFile.compressedSize = data.size();
+
+    for (qsizetype offset = 0; offset < data.size(); offset += CHUNK_SIZE) {
+      const auto length =
+          static_cast<int32_t>(std::min(CHUNK_SIZE, data.size() - offset));
+      const auto written = mz_zip_writer_entry_write(
+          zipWriter_, data.constData() + offset, length);
+      if (written != length) {
+        checkResult(written < 0 ? written : MZ_WRITE_ERROR, file);
+      }
+    }
+
+    checkResult(mz_zip_writer_entry_close(zipWriter_), file);
+  }
+
+  void close() {
+    const auto result = mz_zip_writer_close(zipWriter_);
+    mz_zip_writer_delete(&zipWriter_);
+    zipWriter_ = nullptr;
+
+    if (result != MZ_OK) {
+      std::error_code ec;
+      std::filesystem::remove(archivePath_, ec);
+
+      throw std::runtime_error("Failed to finish writing zip file");
+    }
+  }
+
+private:
+  void checkResult(int32_t result, const SourceFile& file) {
+    if (result == MZ_OK) {
+      return;
+    }
+
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to add path {} to zip file, got error code {}",
+                    file.path.u8string(),
+                    result);
+    }
+
+    throw std::runtime_error("Failed to add path to zip file");
+  }
+
+  std::filesystem::path archivePath_;
+  void* zipWriter_{nullptr};
+};
+}
+
+namespace loot {
+std::optional<BackupStats> createBackup(
+    const std::filesystem::path& sourceDir,
+    const std::filesystem::path& archivePath) {
+  const auto startTime = std::chrono::steady_clock::now();
+
+  auto logger = getLogger();
   if (logger) {
+    logger->trace("Creating backup of {} in {}",
+                  sourceDir.u8string(),
+                  archivePath.u8string());
+  }
+
+  const auto files = findSourceFiles(sourceDir);
+  if (files.empty()) {
+    if (logger) {
+      logger->info("There are no files in {} to back up",
+                   sourceDir.u8string());
+    }
+    return std::nullopt;
+  }
+
+  const auto archiveDir = archivePath.parent_path();
+  std::filesystem::create_directories(archiveDir);
+
+  const auto previousBackup = getPreviousBackup(archivePath);
+  std::ifstream previousArchive;
+  if (previousBackup.has_value()) {
+    previousArchive.open(
+        archiveDir / std::filesystem::u8path(previousBackup->archiveFilename),
+        std::ios::binary);
+  }
+
+  BackupManifest manifest;
+  manifest.archiveFilename = archivePath.filename().u8string();
+
+  BackupStats stats;
+  ArchiveWriter writer(archivePath);
+
+  size_t batchStart = 0;
+  while (batchStart < files.size()) {
+    size_t batchEnd = batchStart;
+    uintmax_t batchSize = 0;
+    std::vector<const ArchivedFile*> unchangedFiles;
+    std::vector<size_t> changedFileIndices;
+    while (batchEnd < files.size() &&
+           (batchEnd == batchStart ||
+            batchSize + files[batchEnd].size <= BATCH_SIZE)) {
+      const auto unchangedFile = previousArchive.is_open()
+                                     ? findUnchangedFile(previousBackup,
+                                                         files[batchEnd])
+                                     : nullptr;
+      if (unchangedFile == nullptr) {
+        changedFileIndices.push_back(unchangedFiles.size());
+        batchSize += files[batchEnd].size;
+      }
+      unchangedFiles.push_back(unchangedFile);
+      batchEnd += 1;
+    }
+
+    std::vector<CompressedFile> compressedFiles(batchEnd - batchStart);
+    std::for_each(std::execution::par,
+                  changedFileIndices.begin(),
+                  changedFileIndices.end(),
+                  [&](size_t index) {
+                    compressedFiles[index] =
+                        compressFile(files[batchStart + index]);
+                  });
+
+    for (size_t i = 0; i < compressedFiles.size(); i += 1) {
+      const auto& file = files[batchStart + i];
+
+      ArchivedFile archivedFile;
+      archivedFile.modificationTime = toString(file.modificationTime);
+
+      std::optional<QByteArray> data;
+      if (unchangedFiles[i] != nullptr) {
+        data = readArchivedData(previousArchive, *unchangedFiles[i]);
+        if (data.has_value()) {
+          archivedFile.uncompressedSize = unchangedFiles[i]->uncompressedSize;
+          archivedFile.crc = unchangedFiles[i]->crc;
+          archivedFile.compressionMethod =
+              unchangedFiles[i]->compressionMethod;
+          stats.reusedFileCount += 1;
+        } else {
+          compressedFiles[i] = compressFile(file);
+        }
+      }
+
+      if (!data.has_value()) {
+        auto& compressedFile = compressedFiles[i];
+        if (!compressedFile.error.empty()) {
+          if (logger) {
+            logger->error("Failed to read {} for backup: {}",
+                          file.path.u8string(),
+                          compressedFile.error);
+          }
+          throw std::runtime_error("Failed to read file to back up");
+        }
+
+        archivedFile.uncompressedSize = compressedFile.uncompressedSize;
+        archivedFile.crc = compressedFile.crc;
+        archivedFile.compressionMethod = compressedFile.compressionMethod;
+        data = std::move(compressedFile.data);
+      }
+
+      writer.writeEntry(file, archivedFile, data.value());
+
+      stats.fileCount += 1;
+      stats.byteCount += static_cast<uintmax_t>(archivedFile.uncompressedSize);
+      manifest.files.emplace(file.entryName, archivedFile);
+    }
+
+    batchStart = batchEnd;
+  }
+
+  writer.close();
+  previousArchive.close();
+
+  manifest.archiveSize = std::filesystem::file_size(archivePath);
+  writeManifest(archiveDir, manifest);
+
+  stats.duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - startTime);
+
+  if (logger) {
+    static constexpr double BYTES_PER_MIB = 1024.0 * 1024.0;
+    static constexpr double MS_PER_SECOND = 1000.0;
+
+    const auto seconds =
+        std::max(stats.duration.count(), std::chrono::milliseconds::rep{1}) /
+        MS_PER_SECOND;
     logger->info(
-        "Backup of {} created in {}", sourceDir.u8string(), destDir.u8string());
+        "Backup of {} created in {}: {} files ({} reused from the previous "
+        "backup), {} bytes in {} ms ({:.1f} MiB/s)",
+        sourceDir.u8string(),
+        archivePath.u8string(),
+        stats.fileCount,
+        stats.reusedFileCount,
+        stats.byteCount,
+        stats.duration.count(),
+        stats.byteCount / BYTES_PER_MIB / seconds);
   }
+
+  return stats;
 }
 }
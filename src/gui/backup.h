@@ -24,13 +24,30 @@
 #ifndef LOOT_GUI_BACKUP
 #define LOOT_GUI_BACKUP
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
+#include <optional>
 
 namespace loot {
-std::filesystem::path compressDirectory(const std::filesystem::path& dir);
-
-void createBackup(const std::filesystem::path& sourceDir,
-                  const std::filesystem::path& destDir);
+struct BackupStats {
+  size_t fileCount{0};
+  // The number of files that were unchanged since the previous backup, so
+  // had their compressed data copied from it.
+  size_t reusedFileCount{0};
+  uintmax_t byteCount{0};
+  std::chrono::milliseconds duration{0};
+};
+
+// Writes a zip archive of the files in sourceDir to archivePath, skipping
+// .git folders, the root backups folder and the debug log. Files are
+// compressed in parallel, and files that have not changed since the last
+// backup written to the same directory have their compressed data copied from
+// that backup's archive. Returns nullopt without writing an archive if there
+// are no files to back up.
+std::optional<BackupStats> createBackup(
+    const std::filesystem::path& sourceDir,
+    const std::filesystem::path& archivePath);
 }
 
 #endif
@@ -24,11 +24,18 @@
 
 #include "gui/qt/card_delegate.h"
 
+#include <QtConcurrent/QtConcurrentMap>
+#include <QtCore/QAbstractProxyModel>
+#include <QtWidgets/QScrollBar>
+#include <functional>
+#include <memory>
+
 #include "gui/qt/counters.h"
 #include "gui/qt/plugin_item_model.h"
 #include "gui/state/logging.h"
 
 namespace {
+using loot::ContentRevisionRole;
 using loot::CountersRole;
 using loot::FilteredContentRole;
 using loot::GeneralInfoCard;
@@ -80,6 +87,15 @@ QString getLongestString(std::initializer_list<std::string> list) {
   return QString::fromStdString(*longestString);
 }
 
+SizeHintCacheKey getSizeHintCacheKey(const PluginItem& pluginItem) {
+  return SizeHintCacheKey(getTagsText(pluginItem.currentTags),
+                          getTagsText(pluginItem.addTags),
+                          getTagsText(pluginItem.removeTags),
+                          getMessageTexts(pluginItem.messages),
+                          getLocationNames(pluginItem.locations),
+                          false);
+}
+
 SizeHintCacheKey getSizeHintCacheKey(const QModelIndex& index) {
   if (index.row() == 0) {
     auto generalInfo =
@@ -112,13 +128,37 @@ SizeHintCacheKey getSizeHintCacheKey(const QModelIndex& index) {
   } else {
     auto pluginItem = index.data(FilteredContentRole).value<PluginItem>();
 
-    return SizeHintCacheKey(getTagsText(pluginItem.currentTags),
-                            getTagsText(pluginItem.addTags),
-                            getTagsText(pluginItem.removeTags),
-                            getMessageTexts(pluginItem.messages),
-                            getLocationNames(pluginItem.locations),
-                            false);
+    return getSizeHintCacheKey(pluginItem);
+  }
+}
+
+// The card sizing cache is updated using the source model's rows, but the
+// delegate is given the proxy model's indexes.
+int getSourceRow(const QModelIndex& index) {
+  const auto proxyModel =
+      qobject_cast<const QAbstractProxyModel*>(index.model());
+  if (proxyModel == nullptr) {
+    return index.row();
+  }
+
+  return proxyModel->mapToSource(index).row();
+}
+
+// Get a string that identifies everything that is displayed on the card for
+// the given index. The model's content revision covers everything except the
+// search result state, which is cheap to read.
+QString getCardContentKey(const QModelIndex& index) {
+  const auto revision = index.data(ContentRevisionRole).value<uint64_t>();
+  if (index.row() == 0) {
+    return QString::number(revision);
   }
+
+  const auto searchResult =
+      index.data(loot::SearchResultRole).value<loot::SearchResultData>();
+
+  return QString::number(revision) % QChar(0x1F) %
+         QString::number(searchResult.isResult) %
+         QString::number(searchResult.isCurrentResult);
 }
 
 void prepareWidget(QWidget* widget) {
@@ -154,9 +194,20 @@ PluginCard* setPluginCardContent(PluginCard* card, const QModelIndex& index) {
   return card;
 }
 
-QSize calculateSize(const QWidget* card,
+QPixmap renderToPixmap(QWidget* widget, QSize size, qreal devicePixelRatio) {
+  QPixmap pixmap(size * devicePixelRatio);
+  pixmap.setDevicePixelRatio(devicePixelRatio);
+  pixmap.fill(Qt::transparent);
+
+  widget->render(&pixmap, QPoint(), QRegion(), QWidget::DrawChildren);
+
+  return pixmap;
+}
+
+QSize calculateSize(int minCardWidth,
                     const QStyleOptionViewItem& option,
-                    int largestMinCardWidth) {
+                    int largestMinCardWidth,
+                    const std::function<int(int)>& calculateHeight) {
   /*
    * There are three relevant widths:
    *
@@ -185,8 +236,6 @@ QSize calculateSize(const QWidget* card,
    * accurate height. That's why the card sizing cache is used to get it, as
    * that cache is populated before the delegate tries to size anything.
    */
-  const auto minCardWidth = card->layout()->minimumSize().width();
-
   // option.rect is the width of the scrollable area that the viewport looks
   // into. It's initially set to some not very useful value, and is subsequently
   // set equal to largestMinWidth once the scrollable area has been resized to
@@ -197,12 +246,21 @@ QSize calculateSize(const QWidget* card,
 
   const auto widthForHeight = std::max(rectWidth, largestMinCardWidth);
 
-  const auto height =
-      card->hasHeightForWidth()
-          ? card->layout()->minimumHeightForWidth(widthForHeight)
-          : card->minimumHeight();
+  return QSize(cardWidth, calculateHeight(widthForHeight));
+}
 
-  return QSize(cardWidth, height);
+QSize calculateSize(const QWidget* card,
+                    const QStyleOptionViewItem& option,
+                    int largestMinCardWidth) {
+  return calculateSize(card->layout()->minimumSize().width(),
+                       option,
+                       largestMinCardWidth,
+                       [card](int width) {
+                         return card->hasHeightForWidth()
+                                    ? card->layout()->minimumHeightForWidth(
+                                          width)
+                                    : card->minimumHeight();
+                       });
 }
 }
 
@@ -211,15 +269,15 @@ CardSizingCache::CardSizingCache(QWidget* cardParentWidget) :
     cardParentWidget(cardParentWidget) {}
 
 void CardSizingCache::clear() {
-  keyCache.clear();
+  delete generalInfoCard;
+  generalInfoCard = nullptr;
 
-  for (auto& [key, value] : cardCache) {
-    delete value.first;
-    value.first = nullptr;
-    value.second = 0;
-  }
+  // The calculator's metrics may depend on the style sheet, which may have
+  // changed.
+  heightCalculator = std::nullopt;
 
-  cardCache.clear();
+  minWidthByRow.clear();
+  minWidths.clear();
 }
 
 void CardSizingCache::update(const QAbstractItemModel* model) {
@@ -234,6 +292,15 @@ void CardSizingCache::update(const QModelIndex& topLeft,
 void CardSizingCache::update(const QAbstractItemModel* model,
                              int firstRow,
                              int lastRow) {
+  // Forget rows that no longer exist, so that they don't affect the largest
+  // min width.
+  const auto rowCount = model->rowCount();
+  for (auto it = minWidthByRow.lower_bound(rowCount);
+       it != minWidthByRow.end();) {
+    minWidths.erase(minWidths.find(it->second));
+    it = minWidthByRow.erase(it);
+  }
+
   for (int row = firstRow; row <= lastRow; row += 1) {
     const auto index = model->index(row, PluginItemModel::CARDS_COLUMN);
 
@@ -241,113 +308,221 @@ void CardSizingCache::update(const QAbstractItemModel* model,
   }
 }
 
-QWidget* CardSizingCache::update(const QModelIndex& index) {
+void CardSizingCache::update(const QModelIndex& index) {
   if (!index.isValid()) {
-    return nullptr;
+    return;
   }
 
-  // Get the key cache entry if it exists, and the new cache key and its
-  // entry.
-  const auto keyCacheIt = keyCache.find(index.row());
-  const auto newCacheKey = getSizeHintCacheKey(index);
-  auto newCardCacheIt = cardCache.find(newCacheKey);
-
-  if (keyCacheIt != keyCache.end()) {
-    // This row has a cached key, get it.
-    const auto oldCacheKey = keyCacheIt->second;
-    if (*oldCacheKey == newCacheKey) {
-      // The cache key hasn't changed, no need to make any changes.
-      // Just return the key's card. It should never be null but handle that
-      // for safety.
-      return newCardCacheIt == cardCache.end() ? nullptr
-                                               : newCardCacheIt->second.first;
-    } else {
-      // The cache key has changed, get the old key's card cache entry and
-      // reduce its count by 1.
-      const auto oldCardCacheIt = cardCache.find(*oldCacheKey);
-      if (oldCardCacheIt != cardCache.end()) {
-        oldCardCacheIt->second.second -= 1;
-
-        // If the old key's count is now 0, remove it from the card cache.
-        if (oldCardCacheIt->second.second == 0) {
-          delete oldCardCacheIt->second.first;
-          oldCardCacheIt->second.first = nullptr;
-          cardCache.erase(oldCardCacheIt);
-        }
-      }
+  if (index.row() == 0) {
+    if (generalInfoCard == nullptr) {
+      generalInfoCard = new GeneralInfoCard(cardParentWidget);
+      prepareWidget(generalInfoCard);
     }
-  }
 
-  // If there is no entry for the new cache key, create one.
-  if (newCardCacheIt == cardCache.end()) {
-    QWidget* widget = nullptr;
-    if (index.row() == 0) {
-      widget = setGeneralInfoCardContent(new GeneralInfoCard(cardParentWidget),
-                                         index);
-    } else {
-      widget = setPluginCardContent(new PluginCard(cardParentWidget), index);
-    }
+    setGeneralInfoCardContent(generalInfoCard, index);
 
-    prepareWidget(widget);
+    setMinWidth(0, generalInfoCard->layout()->minimumSize().width());
+  } else {
+    const auto pluginItem = index.data(FilteredContentRole).value<PluginItem>();
+    const auto hasHiddenMessages =
+        index.data(HasHiddenMessagesRole).value<bool>();
 
-    newCardCacheIt =
-        cardCache.emplace(newCacheKey, std::make_pair(widget, 0)).first;
+    setMinWidth(getSourceRow(index),
+                getHeightCalculator().calculateMinimumWidth(pluginItem,
+                                                            hasHiddenMessages));
   }
+}
 
-  // Increase the new cache key's usage count by 1.
-  newCardCacheIt->second.second += 1;
+QWidget* CardSizingCache::getGeneralInfoCard() const { return generalInfoCard; }
 
-  if (keyCacheIt == keyCache.end()) {
-    // This row has no cached key, add a pointer to the new key.
-    keyCache.emplace(index.row(), &newCardCacheIt->first);
-  } else {
-    // Now update the key cache entry to point to the new key for this row.
-    keyCacheIt->second = &newCardCacheIt->first;
+const CardHeightCalculator& CardSizingCache::getHeightCalculator() {
+  if (!heightCalculator.has_value()) {
+    // Read the metrics from a card that has the same parent as the cards that
+    // get painted, so that it gets the same styling.
+    auto card = new PluginCard(cardParentWidget);
+    prepareWidget(card);
+
+    heightCalculator = CardHeightCalculator(card->getLayoutMetrics());
+
+    delete card;
   }
 
-  // Return the new cache key entry's card.
-  return newCardCacheIt->second.first;
+  return heightCalculator.value();
 }
 
-QWidget* CardSizingCache::getCard(const SizeHintCacheKey& key) const {
-  auto it = cardCache.find(key);
-  if (it != cardCache.end()) {
-    return it->second.first;
+std::optional<int> CardSizingCache::getMinWidth(int row) const {
+  const auto it = minWidthByRow.find(row);
+  if (it == minWidthByRow.end()) {
+    return std::nullopt;
   }
 
-  return nullptr;
+  return it->second;
 }
 
 int CardSizingCache::getLargestMinWidth() const {
-  int largest = 0;
-  for (const auto& [key, value] : cardCache) {
-    const auto minWidth = value.first->layout()->minimumSize().width();
-    if (minWidth > largest) {
-      largest = minWidth;
-    }
+  if (minWidths.empty()) {
+    return 0;
+  }
+
+  return *minWidths.rbegin();
+}
+
+void CardSizingCache::setMinWidth(int row, int minWidth) {
+  const auto it = minWidthByRow.find(row);
+  if (it == minWidthByRow.end()) {
+    minWidthByRow.emplace(row, minWidth);
+  } else if (it->second != minWidth) {
+    minWidths.erase(minWidths.find(it->second));
+    it->second = minWidth;
+  } else {
+    return;
   }
 
-  return largest;
+  minWidths.insert(minWidth);
 }
 
 CardDelegate::CardDelegate(QListView* parent,
-                           CardSizingCache& cardSizingCache) :
+                           CardSizingCache& cardSizingCache,
+                           int pixmapCacheSizeMB) :
     QStyledItemDelegate(parent),
+    view(parent),
     generalInfoCard(new GeneralInfoCard(parent->viewport())),
     pluginCard(new PluginCard(parent->viewport())),
     cardSizingCache(&cardSizingCache) {
+  static constexpr int KIB_PER_MIB = 1024;
+  pixmapCache.setMaxCost(static_cast<qsizetype>(pixmapCacheSizeMB) *
+                         KIB_PER_MIB);
+
   prepareWidget(generalInfoCard);
   prepareWidget(pluginCard);
+
+  // Wait until scrolling has been processed before checking which rows are
+  // near the viewport, as the view may be in the middle of a layout.
+  exactSizeRowsTimer->setSingleShot(true);
+  exactSizeRowsTimer->setInterval(0);
+
+  connect(exactSizeRowsTimer,
+          &QTimer::timeout,
+          this,
+          &CardDelegate::updateExactSizeRows);
+  connect(parent->verticalScrollBar(),
+          &QScrollBar::valueChanged,
+          exactSizeRowsTimer,
+          qOverload<>(&QTimer::start));
+
+  parent->viewport()->installEventFilter(this);
 }
 
 void CardDelegate::setIcons() {
   generalInfoCard->setIcons();
   pluginCard->setIcons();
+
+  invalidatePixmapCache();
 }
 
 void CardDelegate::invalidateCache() {
   cardSizingCache->clear();
   sizeHintCache.clear();
+  sizeHintCacheRevision += 1;
+
+  invalidatePixmapCache();
+}
+
+void CardDelegate::invalidatePixmapCache() {
+  themeRevision += 1;
+  pixmapCache.clear();
+}
+
+QFuture<void> CardDelegate::precomputeSizeHints(
+    const std::vector<PluginItem>& filteredPlugins,
+    const std::vector<bool>& hasHiddenMessages) {
+  // Copy the calculator so that the workers aren't affected if the card sizing
+  // cache is cleared while they're running.
+  const auto calculator = std::make_shared<const CardHeightCalculator>(
+      cardSizingCache->getHeightCalculator());
+
+  // Use the width that the view last gave a card, as the cards will be laid
+  // out with it unless something else changes. Before the view has sized any
+  // cards, fall back to the viewport's width.
+  QStyleOptionViewItem option;
+  option.rect = QRect(QPoint(), view->viewport()->size());
+  if (lastSizeHintWidth.has_value()) {
+    option.rect.setWidth(lastSizeHintWidth.value());
+  }
+
+  auto largestMinWidth = cardSizingCache->getMinWidth(0).value_or(0);
+  auto keys = std::make_shared<std::vector<SizeHintCacheKey>>();
+  std::vector<std::pair<int, PluginItem>> uncachedPlugins;
+  std::set<SizeHintCacheKey> uncachedKeys;
+  for (size_t i = 0; i < filteredPlugins.size(); i += 1) {
+    const auto& plugin = filteredPlugins[i];
+    const auto minWidth = calculator->calculateMinimumWidth(
+        plugin, i < hasHiddenMessages.size() && hasHiddenMessages[i]);
+    largestMinWidth = std::max(largestMinWidth, minWidth);
+
+    auto key = getSizeHintCacheKey(plugin);
+    if (sizeHintCache.count(key) == 0 && uncachedKeys.count(key) == 0) {
+      uncachedKeys.insert(key);
+      keys->push_back(std::move(key));
+      uncachedPlugins.emplace_back(minWidth, plugin);
+    }
+  }
+
+  const auto pluginCount = filteredPlugins.size();
+  const auto revision = sizeHintCacheRevision;
+
+  return QtConcurrent::mapped(
+             std::move(uncachedPlugins),
+             [calculator, option, largestMinWidth](
+                 const std::pair<int, PluginItem>& entry) {
+               const auto& [minWidth, plugin] = entry;
+               return calculateSize(minWidth,
+                                    option,
+                                    largestMinWidth,
+                                    [&](int width) {
+                                      return calculator->calculateHeight(
+                                          plugin, width);
+                                    });
+             })
+      .then(this, [this, keys, pluginCount, revision](QFuture<QSize> future) {
+        if (revision != sizeHintCacheRevision) {
+          // The cache was invalidated while the sizes were being calculated,
+          // so they may be out of date.
+          return;
+        }
+
+        const auto sizeHints = future.results();
+        for (size_t i = 0; i < keys->size(); i += 1) {
+          sizeHintCache.emplace(keys->at(i),
+                                sizeHints.at(static_cast<qsizetype>(i)));
+        }
+
+        const auto logger = getLogger();
+        if (logger) {
+          logger->debug("Precomputed {} card sizes for {} plugins",
+                        sizeHints.size(),
+                        pluginCount);
+        }
+      });
+}
+
+void CardDelegate::setEstimateOffscreenSizes(bool estimateOffscreenSizes) {
+  this->estimateOffscreenSizes = estimateOffscreenSizes;
+
+  if (!estimateOffscreenSizes && !estimatedRows.empty()) {
+    estimatedRows.clear();
+    view->doItemsLayout();
+  }
+}
+
+CardCacheStats CardDelegate::getCacheStats() const {
+  CardCacheStats stats;
+  stats.sizeHintCacheEntries = sizeHintCache.size();
+  stats.pixmapCacheEntries = static_cast<size_t>(pixmapCache.count());
+  stats.sizeHints = sizeHintCacheStats;
+  stats.pixmaps = pixmapCacheStats;
+
+  return stats;
 }
 
 void CardDelegate::paint(QPainter* painter,
@@ -368,6 +543,29 @@ void CardDelegate::paint(QPainter* painter,
 
   painter->translate(styleOption.rect.topLeft());
 
+  // The rendered card depends on the row's size and the largest minimum card
+  // width as well as its content.
+  const auto largestMinWidth = cardSizingCache->getLargestMinWidth();
+  const auto devicePixelRatio = painter->device()->devicePixelRatioF();
+
+  const auto cacheKey = getCardContentKey(index) % QChar(0x1F) %
+                        QString::number(styleOption.rect.width()) %
+                        QChar(0x1F) %
+                        QString::number(styleOption.rect.height()) %
+                        QChar(0x1F) % QString::number(largestMinWidth) %
+                        QChar(0x1F) % QString::number(devicePixelRatio) %
+                        QChar(0x1F) % QString::number(themeRevision);
+
+  const auto cachedPixmap = pixmapCache.object(cacheKey);
+  if (cachedPixmap != nullptr) {
+    pixmapCacheStats.hits += 1;
+    painter->drawPixmap(QPoint(), *cachedPixmap);
+    painter->restore();
+    return;
+  }
+
+  pixmapCacheStats.misses += 1;
+
   QWidget* widget = nullptr;
 
   if (index.row() == 0) {
@@ -376,14 +574,28 @@ void CardDelegate::paint(QPainter* painter,
     widget = setPluginCardContent(pluginCard, index);
   }
 
-  const auto sizeHint =
-      calculateSize(widget, styleOption, cardSizingCache->getLargestMinWidth());
+  // Use the height that the view has laid out the row with, as plugin card
+  // heights are calculated without laying out a card, and so could differ
+  // slightly from the widget's own minimum height.
+  const auto cardSize =
+      QSize(calculateSize(widget, styleOption, largestMinWidth).width(),
+            styleOption.rect.height());
 
-  widget->setFixedSize(sizeHint);
+  widget->setFixedSize(cardSize);
 
-  widget->render(painter, QPoint(), QRegion(), QWidget::DrawChildren);
+  const auto pixmap = renderToPixmap(widget, cardSize, devicePixelRatio);
+
+  painter->drawPixmap(QPoint(), pixmap);
 
   painter->restore();
+
+  static constexpr qsizetype BITS_PER_KIB = 8 * 1024;
+  const auto cost = std::max(qsizetype{1},
+                             static_cast<qsizetype>(pixmap.width()) *
+                                 pixmap.height() * pixmap.depth() /
+                                 BITS_PER_KIB);
+
+  pixmapCache.insert(cacheKey, new QPixmap(pixmap), cost);
 }
 
 QSize CardDelegate::sizeHint(const QStyleOptionViewItem& option,
@@ -399,6 +611,8 @@ QSize CardDelegate::sizeHint(const QStyleOptionViewItem& option,
     return QStyledItemDelegate::sizeHint(option, index);
   }
 
+  lastSizeHintWidth = styleOption.rect.width();
+
   const auto cacheKey = getSizeHintCacheKey(index);
 
   auto it = sizeHintCache.find(cacheKey);
@@ -407,31 +621,141 @@ QSize CardDelegate::sizeHint(const QStyleOptionViewItem& option,
     // width.
     if (it->second.width() == styleOption.rect.width()) {
       // The cached size is valid, return it.
+      sizeHintCacheStats.hits += 1;
+      estimatedRows.erase(index.row());
       return it->second;
     }
-  } else {
+  }
+
+  if (index.row() != 0 && estimateOffscreenSizes &&
+      (index.row() < exactSizeRows.first ||
+       index.row() > exactSizeRows.second)) {
+    // Don't cache estimated sizes, they're cheap to get and shouldn't be
+    // mistaken for exact sizes.
+    estimatedRows.insert(index.row());
+
+    const auto& calculator = cardSizingCache->getHeightCalculator();
+    const auto pluginItem = index.data(FilteredContentRole).value<PluginItem>();
+    const auto minWidth =
+        cardSizingCache->getMinWidth(getSourceRow(index)).value_or(0);
+
+    return calculateSize(
+        minWidth,
+        styleOption,
+        cardSizingCache->getLargestMinWidth(),
+        [&](int) { return calculator.estimateHeight(pluginItem); });
+  }
+
+  estimatedRows.erase(index.row());
+  sizeHintCacheStats.misses += 1;
+
+  if (it == sizeHintCache.end()) {
     // Store an invalid size so that it can be replaced below.
     it = sizeHintCache.emplace(cacheKey, QSize()).first;
   }
 
-  auto card = cardSizingCache->getCard(cacheKey);
-  if (card == nullptr) {
+  if (index.row() == 0) {
+    auto card = cardSizingCache->getGeneralInfoCard();
+    if (card == nullptr) {
+      const auto logger = getLogger();
+      if (logger) {
+        logger->warn(
+            "No cached card exists for row {}, card sizes may not be "
+            "calculated correctly",
+            index.row());
+      }
+      cardSizingCache->update(index);
+      card = cardSizingCache->getGeneralInfoCard();
+    }
+
+    it->second = calculateSize(
+        card, styleOption, cardSizingCache->getLargestMinWidth());
+
+    return it->second;
+  }
+
+  const auto sourceRow = getSourceRow(index);
+  auto minWidth = cardSizingCache->getMinWidth(sourceRow);
+  if (!minWidth.has_value()) {
     const auto logger = getLogger();
-    logger->warn(
-        "No cached card exists for row {}, card sizes may not be calculated "
-        "correctly",
-        index.row());
-    card = cardSizingCache->update(index);
+    if (logger) {
+      logger->warn(
+          "No cached minimum width exists for row {}, card sizes may not be "
+          "calculated correctly",
+          sourceRow);
+    }
+    cardSizingCache->update(index);
+    minWidth = cardSizingCache->getMinWidth(sourceRow);
   }
 
+  const auto& calculator = cardSizingCache->getHeightCalculator();
+  const auto pluginItem = index.data(FilteredContentRole).value<PluginItem>();
+
   const auto sizeHint =
-      calculateSize(card, styleOption, cardSizingCache->getLargestMinWidth());
+      calculateSize(minWidth.value_or(0),
+                    styleOption,
+                    cardSizingCache->getLargestMinWidth(),
+                    [&](int width) {
+                      return calculator.calculateHeight(pluginItem, width);
+                    });
 
   it->second = sizeHint;
 
   return sizeHint;
 }
 
+bool CardDelegate::eventFilter(QObject* object, QEvent* event) {
+  if (object == view->viewport() && event->type() == QEvent::Resize) {
+    exactSizeRowsTimer->start();
+  }
+
+  return QStyledItemDelegate::eventFilter(object, event);
+}
+
+void CardDelegate::updateExactSizeRows() {
+  if (!estimateOffscreenSizes || view->model() == nullptr) {
+    return;
+  }
+
+  const auto viewportRect = view->viewport()->rect();
+  const auto firstVisibleIndex = view->indexAt(
+      QPoint(viewportRect.center().x(), viewportRect.top()));
+  const auto lastVisibleIndex = view->indexAt(
+      QPoint(viewportRect.center().x(), viewportRect.bottom()));
+
+  const auto firstVisibleRow =
+      firstVisibleIndex.isValid() ? firstVisibleIndex.row() : 0;
+  const auto lastVisibleRow = lastVisibleIndex.isValid()
+                                  ? lastVisibleIndex.row()
+                                  : view->model()->rowCount() - 1;
+
+  exactSizeRows =
+      std::make_pair(std::max(0, firstVisibleRow - EXACT_SIZE_ROW_PADDING),
+                     lastVisibleRow + EXACT_SIZE_ROW_PADDING);
+
+  const auto it = estimatedRows.lower_bound(exactSizeRows.first);
+  if (it == estimatedRows.end() || *it > exactSizeRows.second) {
+    // All the rows near the viewport already have exact sizes.
+    return;
+  }
+
+  // Replacing estimated sizes with exact sizes for rows above the viewport
+  // would move the visible cards, so remember where the first visible card
+  // is and scroll to keep it in the same place.
+  const QPersistentModelIndex anchorIndex(firstVisibleIndex);
+  const auto anchorTop = view->visualRect(firstVisibleIndex).top();
+
+  view->doItemsLayout();
+
+  if (anchorIndex.isValid()) {
+    const auto offset = view->visualRect(anchorIndex).top() - anchorTop;
+    if (offset != 0) {
+      const auto scrollBar = view->verticalScrollBar();
+      scrollBar->setValue(scrollBar->value() + offset);
+    }
+  }
+}
+
 QWidget* CardDelegate::createEditor(QWidget* parent,
                                     const QStyleOptionViewItem& option,
                                     const QModelIndex& index) const {
@@ -24,14 +24,22 @@
 #ifndef LOOT_GUI_QT_CARD_DELEGATE
 #define LOOT_GUI_QT_CARD_DELEGATE
 
+#include <QtCore/QCache>
+#include <QtCore/QFuture>
+#include <QtCore/QTimer>
 #include <QtGui/QPainter>
+#include <QtGui/QPixmap>
 #include <QtWidgets/QListView>
 #include <QtWidgets/QStyledItemDelegate>
 #include <QtWidgets/QWidget>
+#include <optional>
+#include <set>
 
+#include "gui/qt/card_height_calculator.h"
 #include "gui/qt/general_info_card.h"
 #include "gui/qt/plugin_card.h"
 #include "gui/qt/plugin_item_model.h"
+#include "gui/state/diagnostics.h"
 
 namespace loot {
 // SizeHintCacheKey contains all the data that the card size could depend on,
@@ -71,6 +79,9 @@ typedef std::tuple<QString,
  * affected indexes. This update needs to happen before the delegate's paint or
  * size hint methods are called so that they are given the correct largest min
  * width value.
+ *
+ * Plugin cards are sized using a CardHeightCalculator, and only the general
+ * information card is sized using a (hidden) widget.
  */
 class CardSizingCache {
 public:
@@ -80,27 +91,67 @@ public:
   void update(const QAbstractItemModel* model);
   void update(const QModelIndex& topLeft, const QModelIndex& bottomRight);
   void update(const QAbstractItemModel*, int firstRow, int lastRow);
-  QWidget* update(const QModelIndex& index);
+  void update(const QModelIndex& index);
 
-  QWidget* getCard(const SizeHintCacheKey& key) const;
+  QWidget* getGeneralInfoCard() const;
+
+  const CardHeightCalculator& getHeightCalculator();
+
+  std::optional<int> getMinWidth(int row) const;
 
   int getLargestMinWidth() const;
 
 private:
   QWidget* cardParentWidget{nullptr};
-  std::map<int, const SizeHintCacheKey*> keyCache;
-  std::map<SizeHintCacheKey, std::pair<QWidget*, unsigned int>> cardCache;
+  GeneralInfoCard* generalInfoCard{nullptr};
+  std::optional<CardHeightCalculator> heightCalculator;
+  std::map<int, int> minWidthByRow;
+  std::multiset<int> minWidths;
+
+  void setMinWidth(int row, int minWidth);
+};
+
+struct CardCacheStats {
+  size_t sizeHintCacheEntries{0};
+  size_t pixmapCacheEntries{0};
+  CacheStats sizeHints;
+  CacheStats pixmaps;
 };
 
 class CardDelegate : public QStyledItemDelegate {
   Q_OBJECT
 public:
-  CardDelegate(QListView* parent, CardSizingCache& cardSizingCache);
+  // The default amount of memory that rendered card pixmaps may use.
+  static constexpr int DEFAULT_PIXMAP_CACHE_SIZE_MB = 64;
+
+  CardDelegate(QListView* parent,
+               CardSizingCache& cardSizingCache,
+               int pixmapCacheSizeMB = DEFAULT_PIXMAP_CACHE_SIZE_MB);
 
   void setIcons();
 
   void invalidateCache();
 
+  // Discard rendered cards without discarding cached sizes, e.g. because
+  // a colour has changed.
+  void invalidatePixmapCache();
+
+  // Calculate the sizes of the given plugins' cards in parallel without
+  // blocking, so that they can be cached before the plugins are added to the
+  // model. The plugins' card content filters must already have been applied,
+  // and each plugin's entry in hasHiddenMessages says whether it has any
+  // messages hidden. The returned future finishes once the sizes are cached.
+  QFuture<void> precomputeSizeHints(
+      const std::vector<PluginItem>& filteredPlugins,
+      const std::vector<bool>& hasHiddenMessages);
+
+  // When enabled, plugin cards that aren't near the viewport are given
+  // estimated sizes, and their exact sizes are only calculated once they get
+  // near the viewport.
+  void setEstimateOffscreenSizes(bool estimateOffscreenSizes);
+
+  CardCacheStats getCacheStats() const;
+
   void paint(QPainter* painter,
              const QStyleOptionViewItem& option,
              const QModelIndex& index) const override;
@@ -122,11 +173,40 @@ signals:
   void hideMessage(const std::string& pluginName,
                    const std::string& messageText) const;
 
+protected:
+  bool eventFilter(QObject* object, QEvent* event) override;
+
 private:
+  // The number of rows either side of the viewport that get exact sizes when
+  // estimating offscreen sizes.
+  static constexpr int EXACT_SIZE_ROW_PADDING = 20;
+
+  QListView* view{nullptr};
   GeneralInfoCard* generalInfoCard{nullptr};
   PluginCard* pluginCard{nullptr};
   CardSizingCache* cardSizingCache;
   mutable std::map<SizeHintCacheKey, QSize> sizeHintCache;
+  // Incremented whenever the size hint cache is invalidated.
+  unsigned int sizeHintCacheRevision{0};
+  // The available width that the view last gave when sizing a card.
+  mutable std::optional<int> lastSizeHintWidth;
+
+  // Rendered cards, keyed by their displayed content, size, device pixel
+  // ratio and theme revision. Entry costs are in KiB, and the least recently
+  // used entries are evicted first when the cache is full.
+  mutable QCache<QString, QPixmap> pixmapCache;
+  unsigned int themeRevision{0};
+
+  // Estimated sizes are counted as neither hits nor misses.
+  mutable CacheStats sizeHintCacheStats;
+  mutable CacheStats pixmapCacheStats;
+
+  bool estimateOffscreenSizes{false};
+  std::pair<int, int> exactSizeRows{0, EXACT_SIZE_ROW_PADDING};
+  mutable std::set<int> estimatedRows;
+  QTimer* exactSizeRowsTimer{new QTimer(this)};
+
+  void updateExactSizeRows();
 };
 }
 
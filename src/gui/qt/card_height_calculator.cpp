@@ -0,0 +1,263 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#include "gui/qt/card_height_calculator.h"
+
+#include <QtGui/QFontMetrics>
+#include <QtGui/QTextDocument>
+#include <QtGui/QTextLayout>
+#include <cmath>
+
+#include "gui/helpers.h"
+#include "gui/qt/plugin_card.h"
+
+namespace {
+using loot::getTagsText;
+
+int toPixels(qreal length) { return static_cast<int>(std::ceil(length)); }
+
+// Get the height of plain text that's word-wrapped to the given width, as in
+// a QLabel that has word wrap enabled.
+int getTextHeight(const QString& text, const QFont& font, int width) {
+  QTextOption textOption;
+  textOption.setWrapMode(QTextOption::WordWrap);
+
+  QTextLayout textLayout(text, font);
+  textLayout.setTextOption(textOption);
+
+  qreal height = 0;
+
+  textLayout.beginLayout();
+  while (true) {
+    auto line = textLayout.createLine();
+    if (!line.isValid()) {
+      break;
+    }
+
+    line.setLineWidth(width);
+    height += line.height();
+  }
+  textLayout.endLayout();
+
+  return std::max(toPixels(height), QFontMetrics(font).height());
+}
+
+// Get the height of Markdown text that's wrapped to the given width. A
+// QTextDocument is used because that's what a QLabel uses to lay out rich
+// text, and it handles paragraph and list spacing.
+int getMarkdownHeight(const QString& text,
+                      const QFont& font,
+                      int width,
+                      QTextDocument::MarkdownFeatures features) {
+  QTextDocument document;
+  document.setDefaultFont(font);
+  document.setDocumentMargin(0);
+  document.setMarkdown(text, features);
+  document.setTextWidth(width);
+
+  return toPixels(document.size().height());
+}
+
+int getTextWidth(const std::optional<std::string>& text, const QFont& font) {
+  if (!text.has_value()) {
+    return 0;
+  }
+
+  return QFontMetrics(font).horizontalAdvance(
+      QString::fromStdString(text.value()));
+}
+
+int verticalMargins(const QMargins& margins) {
+  return margins.top() + margins.bottom();
+}
+
+int horizontalMargins(const QMargins& margins) {
+  return margins.left() + margins.right();
+}
+}
+
+namespace loot {
+CardHeightCalculator::CardHeightCalculator(
+    const PluginCardLayoutMetrics& metrics) :
+    metrics(metrics),
+    messageLineHeight(QFontMetrics(metrics.messageFont).height()),
+    tagsLineHeight(QFontMetrics(metrics.tagsFont).height()),
+    locationsLineHeight(QFontMetrics(metrics.locationsFont).height()) {}
+
+int CardHeightCalculator::calculateMinimumWidth(const PluginItem& plugin,
+                                                bool hasHiddenMessages) const {
+  // All the card's other text is word-wrapped and so can be made almost
+  // arbitrarily narrow, so the minimum width is that of the header row.
+  auto headerWidth = getTextWidth(plugin.name, metrics.nameFont);
+
+  if (plugin.crc.has_value()) {
+    headerWidth += getTextWidth(crcToString(plugin.crc.value()),
+                                metrics.crcFont);
+  }
+
+  headerWidth += getTextWidth(plugin.version, metrics.versionFont);
+
+  // The name, CRC and version labels are always present, even if empty.
+  auto headerItemCount = 3;
+  for (const auto isIconVisible : {plugin.isActive,
+                                   plugin.isMaster,
+                                   plugin.isBlueprintMaster,
+                                   plugin.isLightPlugin,
+                                   plugin.isMediumPlugin,
+                                   plugin.isEmpty,
+                                   plugin.loadsArchive,
+                                   plugin.cleaningUtility.has_value(),
+                                   plugin.hasUserMetadata,
+                                   hasHiddenMessages}) {
+    if (isIconVisible) {
+      headerWidth += metrics.iconWidth;
+      headerItemCount += 1;
+    }
+  }
+
+  headerWidth += metrics.headerSpacing * (headerItemCount - 1);
+
+  return horizontalMargins(metrics.cardMargins) + headerWidth;
+}
+
+int CardHeightCalculator::calculateHeight(const PluginItem& plugin,
+                                          int width) const {
+  const auto contentWidth =
+      std::max(1, width - horizontalMargins(metrics.cardMargins));
+
+  auto height = verticalMargins(metrics.cardMargins) + metrics.headerHeight;
+
+  if (!plugin.messages.empty()) {
+    height += metrics.cardSpacing +
+              calculateMessagesHeight(plugin.messages, contentWidth);
+  }
+
+  if (!plugin.currentTags.empty() || !plugin.addTags.empty() ||
+      !plugin.removeTags.empty()) {
+    height += metrics.cardSpacing + calculateTagsHeight(plugin, contentWidth);
+  }
+
+  if (!plugin.locations.empty()) {
+    height += metrics.cardSpacing +
+              getMarkdownHeight(getLocationsText(plugin.locations),
+                                metrics.locationsFont,
+                                contentWidth,
+                                QTextDocument::MarkdownDialectGitHub);
+  }
+
+  return height;
+}
+
+int CardHeightCalculator::estimateHeight(const PluginItem& plugin) const {
+  auto height = verticalMargins(metrics.cardMargins) + metrics.headerHeight;
+
+  if (!plugin.messages.empty()) {
+    const auto messageCount = static_cast<int>(plugin.messages.size());
+    height += metrics.cardSpacing +
+              messageCount * (verticalMargins(metrics.messageMargins) +
+                              messageLineHeight);
+  }
+
+  auto tagsRowCount = 0;
+  for (const auto hasTags : {!plugin.currentTags.empty(),
+                             !plugin.addTags.empty(),
+                             !plugin.removeTags.empty()}) {
+    if (hasTags) {
+      tagsRowCount += 1;
+    }
+  }
+
+  if (tagsRowCount > 0) {
+    height += metrics.cardSpacing + verticalMargins(metrics.tagsMargins) +
+              tagsRowCount * tagsLineHeight +
+              (tagsRowCount - 1) * metrics.tagsVerticalSpacing;
+  }
+
+  if (!plugin.locations.empty()) {
+    height += metrics.cardSpacing + locationsLineHeight;
+  }
+
+  return height;
+}
+
+int CardHeightCalculator::calculateMessagesHeight(
+    const std::vector<SourcedMessage>& messages,
+    int width) const {
+  // Each message is a row in a grid with no spacing, with the bullet point
+  // in the first column and the message label in the second.
+  const auto textWidth =
+      std::max(1,
+               width - metrics.bulletColumnWidth -
+                   horizontalMargins(metrics.messageMargins));
+  const auto lineHeight = QFontMetrics(metrics.messageFont).height();
+
+  auto height = 0;
+  for (const auto& message : messages) {
+    const auto textHeight =
+        getMarkdownHeight(QString::fromStdString(message.text),
+                          metrics.messageFont,
+                          textWidth,
+                          {QTextDocument::MarkdownNoHTML,
+                           QTextDocument::MarkdownDialectCommonMark});
+
+    height += verticalMargins(metrics.messageMargins) +
+              std::max(lineHeight, textHeight);
+  }
+
+  return height;
+}
+
+int CardHeightCalculator::calculateTagsHeight(const PluginItem& plugin,
+                                              int width) const {
+  const std::vector<std::pair<QString, int>> rows{
+      {getTagsText(plugin.currentTags), metrics.currentTagsHeaderWidth},
+      {getTagsText(plugin.addTags), metrics.addTagsHeaderWidth},
+      {getTagsText(plugin.removeTags), metrics.removeTagsHeaderWidth}};
+
+  // Hidden rows don't contribute to the header column's width.
+  auto headerColumnWidth = 0;
+  auto rowCount = 0;
+  for (const auto& [text, headerWidth] : rows) {
+    if (!text.isEmpty()) {
+      headerColumnWidth = std::max(headerColumnWidth, headerWidth);
+      rowCount += 1;
+    }
+  }
+
+  const auto textWidth =
+      std::max(1,
+               width - horizontalMargins(metrics.tagsMargins) -
+                   headerColumnWidth - metrics.tagsHorizontalSpacing);
+
+  auto height = verticalMargins(metrics.tagsMargins) +
+                metrics.tagsVerticalSpacing * (rowCount - 1);
+  for (const auto& [text, headerWidth] : rows) {
+    if (!text.isEmpty()) {
+      height += getTextHeight(text, metrics.tagsFont, textWidth);
+    }
+  }
+
+  return height;
+}
+}
@@ -0,0 +1,94 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_GUI_QT_CARD_HEIGHT_CALCULATOR
+#define LOOT_GUI_QT_CARD_HEIGHT_CALCULATOR
+
+#include <QtCore/QMargins>
+#include <QtGui/QFont>
+
+#include "gui/plugin_item.h"
+
+namespace loot {
+// The fonts, margins and spacings that a PluginCard's size depends on. They're
+// read from a polished card so that any style sheet values are included.
+struct PluginCardLayoutMetrics {
+  QMargins cardMargins;
+  int cardSpacing{0};
+
+  QFont nameFont;
+  QFont crcFont;
+  QFont versionFont;
+  int headerHeight{0};
+  int headerSpacing{0};
+  int iconWidth{0};
+
+  QFont messageFont;
+  QMargins messageMargins;
+  int bulletColumnWidth{0};
+
+  QFont tagsFont;
+  QMargins tagsMargins;
+  int tagsHorizontalSpacing{0};
+  int tagsVerticalSpacing{0};
+  int currentTagsHeaderWidth{0};
+  int addTagsHeaderWidth{0};
+  int removeTagsHeaderWidth{0};
+
+  QFont locationsFont;
+};
+
+/**
+ * Calculates the size of a PluginCard from its content using text layouts and
+ * font metrics, following the same layout rules as the card itself. No widgets
+ * are involved, so this is much cheaper than laying out a card, and it's safe
+ * to use from any thread.
+ */
+class CardHeightCalculator {
+public:
+  explicit CardHeightCalculator(const PluginCardLayoutMetrics& metrics);
+
+  int calculateMinimumWidth(const PluginItem& plugin,
+                            bool hasHiddenMessages) const;
+
+  int calculateHeight(const PluginItem& plugin, int width) const;
+
+  // Get a rough height for the plugin's card without laying out any text, by
+  // assuming that each message and each row of Bash Tags fits on one line.
+  int estimateHeight(const PluginItem& plugin) const;
+
+private:
+  PluginCardLayoutMetrics metrics;
+  int messageLineHeight{0};
+  int tagsLineHeight{0};
+  int locationsLineHeight{0};
+
+  int calculateMessagesHeight(const std::vector<SourcedMessage>& messages,
+                              int width) const;
+
+  int calculateTagsHeight(const PluginItem& plugin, int width) const;
+};
+}
+
+#endif
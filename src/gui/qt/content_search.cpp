@@ -0,0 +1,174 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#include "gui/qt/content_search.h"
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore/QRegularExpression>
+
+#include "gui/qt/plugin_item_filter_model.h"
+#include "gui/qt/plugin_item_model.h"
+#include "gui/state/logging.h"
+
+namespace {
+// The source rows of the visible plugin cards, and the content to search for
+// each source model item.
+struct SearchItems {
+  std::vector<int> sourceRows;
+  QStringList contents;
+};
+
+bool isMatch(const QString& content, const QVariant& text) {
+  if (text.userType() == QMetaType::QRegularExpression) {
+    return text.toRegularExpression().match(content).hasMatch();
+  }
+
+  return content.contains(text.toString(), Qt::CaseInsensitive);
+}
+
+SearchItems getVisibleItems(const loot::PluginItemFilterModel& proxyModel) {
+  SearchItems items;
+
+  const auto sourceModel =
+      qobject_cast<const loot::PluginItemModel*>(proxyModel.sourceModel());
+  if (sourceModel == nullptr) {
+    return items;
+  }
+
+  // The contents are shared with the model instead of being copied.
+  items.contents = sourceModel->getSearchContents();
+  items.sourceRows.reserve(static_cast<size_t>(proxyModel.rowCount()));
+
+  // Skip the general information card, it's never a search result.
+  for (int row = 1; row < proxyModel.rowCount(); row += 1) {
+    const auto proxyIndex =
+        proxyModel.index(row, loot::PluginItemModel::CARDS_COLUMN);
+
+    items.sourceRows.push_back(proxyModel.mapToSource(proxyIndex).row());
+  }
+
+  return items;
+}
+
+std::optional<std::vector<int>> findMatchingRows(
+    const SearchItems& items,
+    const QVariant& text,
+    uint64_t searchId,
+    const std::shared_ptr<std::atomic<uint64_t>>& latestSearchId) {
+  std::vector<int> rows;
+
+  for (const auto row : items.sourceRows) {
+    if (latestSearchId->load() != searchId) {
+      // This search has been superseded, stop early.
+      return std::nullopt;
+    }
+
+    // Source row 0 is the general information card, so item rows are offset
+    // by one.
+    const auto contentIndex = static_cast<qsizetype>(row) - 1;
+    if (contentIndex < 0 || contentIndex >= items.contents.size()) {
+      continue;
+    }
+
+    if (isMatch(items.contents.at(contentIndex), text)) {
+      rows.push_back(row);
+    }
+  }
+
+  return rows;
+}
+}
+
+namespace loot {
+ContentSearch::ContentSearch(QObject* parent,
+                             const PluginItemFilterModel& proxyModel) :
+    QObject(parent), proxyModel(&proxyModel) {
+  debounceTimer->setSingleShot(true);
+  debounceTimer->setInterval(DEBOUNCE_INTERVAL_MS);
+
+  connect(debounceTimer, &QTimer::timeout, this, &ContentSearch::startSearch);
+}
+
+void ContentSearch::search(const QVariant& text) {
+  // Incrementing the ID cancels any search that is currently running.
+  latestSearchId->fetch_add(1);
+  pendingText = text;
+
+  setSearching(true);
+  debounceTimer->start();
+}
+
+void ContentSearch::cancel() {
+  latestSearchId->fetch_add(1);
+  debounceTimer->stop();
+  pendingText = QVariant();
+
+  setSearching(false);
+}
+
+bool ContentSearch::isSearching() const { return searching; }
+
+void ContentSearch::setSearching(bool isSearching) {
+  if (searching != isSearching) {
+    searching = isSearching;
+    emit searchingChanged(searching);
+  }
+}
+
+void ContentSearch::startSearch() {
+  const auto searchId = latestSearchId->load();
+  const auto latest = latestSearchId;
+  const auto text = pendingText;
+
+  // Take a snapshot of the visible rows on this thread, as the model can't be
+  // safely read from the worker thread. The content to search is kept up to
+  // date by the model, so only the row numbers need to be collected.
+  auto items = std::make_shared<SearchItems>(getVisibleItems(*proxyModel));
+
+  QtConcurrent::run([items, text, searchId, latest]() {
+    return findMatchingRows(*items, text, searchId, latest);
+  })
+      .then(this,
+            [this, searchId](std::optional<std::vector<int>> rows) {
+              if (!rows.has_value() || latestSearchId->load() != searchId) {
+                // The search was superseded, a newer search will replace
+                // the results.
+                return;
+              }
+
+              setSearching(false);
+              emit searchFinished(rows.value());
+            })
+      .onFailed(this, [this, searchId](const std::exception& e) {
+        const auto logger = getLogger();
+        if (logger) {
+          logger->error("Failed to search card content: {}", e.what());
+        }
+
+        if (latestSearchId->load() == searchId) {
+          setSearching(false);
+        }
+      });
+}
+}
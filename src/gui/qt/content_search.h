@@ -0,0 +1,78 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_GUI_QT_CONTENT_SEARCH
+#define LOOT_GUI_QT_CONTENT_SEARCH
+
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtCore/QVariant>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "gui/plugin_item.h"
+
+namespace loot {
+class PluginItemFilterModel;
+
+/**
+ * Matches card content against search text on a worker thread.
+ *
+ * Searches are debounced so that typing a query only runs one search once
+ * typing pauses, and starting a new search supersedes any search that is
+ * still running, which then stops early and has its results discarded.
+ */
+class ContentSearch : public QObject {
+  Q_OBJECT
+public:
+  static constexpr int DEBOUNCE_INTERVAL_MS = 200;
+
+  ContentSearch(QObject* parent, const PluginItemFilterModel& proxyModel);
+
+  void search(const QVariant& text);
+  void cancel();
+
+  bool isSearching() const;
+
+signals:
+  void searchingChanged(bool isSearching);
+
+  // The given rows are rows in the source model that contain the search text.
+  void searchFinished(const std::vector<int>& sourceRows);
+
+private:
+  const PluginItemFilterModel* proxyModel{nullptr};
+  QTimer* debounceTimer{new QTimer(this)};
+  QVariant pendingText;
+  std::shared_ptr<std::atomic<uint64_t>> latestSearchId{
+      std::make_shared<std::atomic<uint64_t>>(0)};
+  bool searching{false};
+
+  void setSearching(bool isSearching);
+  void startSearch();
+};
+}
+
+#endif
@@ -25,42 +25,76 @@
 
 #include "gui/state/game/helpers.h"
 
+namespace {
+void updateCount(size_t& count, size_t change, bool add) {
+  if (add) {
+    count += change;
+  } else {
+    count -= change;
+  }
+}
+}
+
 namespace loot {
 GeneralInformationCounters::GeneralInformationCounters(
     const std::vector<SourcedMessage>& generalMessages,
     const std::vector<PluginItem>& plugins) {
-  countMessages(generalMessages);
-
-  totalPlugins = plugins.size();
+  addMessages(generalMessages);
 
   for (const auto& plugin : plugins) {
-    if (plugin.isActive) {
-      if (plugin.isLightPlugin) {
-        activeLight += 1;
-      } else if (plugin.isMediumPlugin) {
-        activeMedium += 1;
-      } else {
-        activeFull += 1;
-      }
-    }
-    if (plugin.isDirty) {
-      dirty += 1;
-    }
+    addPlugin(plugin);
+  }
+}
+
+void GeneralInformationCounters::addPlugin(const PluginItem& plugin) {
+  countPlugin(plugin, true);
+}
+
+void GeneralInformationCounters::removePlugin(const PluginItem& plugin) {
+  countPlugin(plugin, false);
+}
+
+void GeneralInformationCounters::addMessages(
+    const std::vector<SourcedMessage>& messages) {
+  countMessages(messages, true);
+}
+
+void GeneralInformationCounters::removeMessages(
+    const std::vector<SourcedMessage>& messages) {
+  countMessages(messages, false);
+}
+
+void GeneralInformationCounters::countPlugin(const PluginItem& plugin,
+                                             bool add) {
+  updateCount(totalPlugins, 1, add);
 
-    countMessages(plugin.messages);
+  if (plugin.isActive) {
+    if (plugin.isLightPlugin) {
+      updateCount(activeLight, 1, add);
+    } else if (plugin.isMediumPlugin) {
+      updateCount(activeMedium, 1, add);
+    } else {
+      updateCount(activeFull, 1, add);
+    }
   }
+  if (plugin.isDirty) {
+    updateCount(dirty, 1, add);
+  }
+
+  countMessages(plugin.messages, add);
 }
 
 void GeneralInformationCounters::countMessages(
-    const std::vector<SourcedMessage>& messages) {
+    const std::vector<SourcedMessage>& messages,
+    bool add) {
   for (const auto& message : messages) {
     if (message.type == MessageType::warn) {
-      warnings += 1;
+      updateCount(warnings, 1, add);
     } else if (message.type == MessageType::error) {
-      errors += 1;
+      updateCount(errors, 1, add);
     }
   }
 
-  totalMessages += messages.size();
+  updateCount(totalMessages, messages.size(), add);
 }
 }
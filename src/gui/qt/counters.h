@@ -44,8 +44,22 @@ struct GeneralInformationCounters {
   size_t dirty{0};
   size_t totalPlugins{0};
 
+  // Whether a message is hidden depends on the card content filters, so this
+  // isn't updated by the functions below and is instead maintained by
+  // PluginItemModel.
+  size_t hiddenMessages{0};
+
+  // These allow the counters to be kept up to date as plugins and messages
+  // change, without recounting everything. Removing a plugin or messages
+  // that were never added gives meaningless counts.
+  void addPlugin(const PluginItem& plugin);
+  void removePlugin(const PluginItem& plugin);
+  void addMessages(const std::vector<SourcedMessage>& messages);
+  void removeMessages(const std::vector<SourcedMessage>& messages);
+
 private:
-  void countMessages(const std::vector<SourcedMessage>& messages);
+  void countPlugin(const PluginItem& plugin, bool add);
+  void countMessages(const std::vector<SourcedMessage>& messages, bool add);
 };
 }
 
@@ -0,0 +1,77 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/diagnostics_dialog.h"
+
+#include <QtGui/QFontDatabase>
+#include <QtWidgets/QVBoxLayout>
+
+#include "gui/qt/helpers.h"
+
+namespace loot {
+DiagnosticsDialog::DiagnosticsDialog(QWidget* parent) : QDialog(parent) {
+  setupUi();
+}
+
+void DiagnosticsDialog::setReport(const DiagnosticsReport& report) {
+  reportText->setPlainText(
+      QString::fromStdString(formatDiagnosticsReport(report)));
+}
+
+void DiagnosticsDialog::setupUi() {
+  static constexpr int MINIMUM_WIDTH = 600;
+  static constexpr int MINIMUM_HEIGHT = 500;
+
+  setMinimumSize(MINIMUM_WIDTH, MINIMUM_HEIGHT);
+
+  reportText->setReadOnly(true);
+  reportText->setLineWrapMode(QPlainTextEdit::LineWrapMode::NoWrap);
+  reportText->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+
+  copyButton->setObjectName("copyButton");
+  buttonBox->addButton(copyButton, QDialogButtonBox::ButtonRole::ActionRole);
+
+  auto dialogLayout = new QVBoxLayout();
+
+  dialogLayout->addWidget(reportText);
+  dialogLayout->addWidget(buttonBox);
+
+  setLayout(dialogLayout);
+
+  translateUi();
+
+  QMetaObject::connectSlotsByName(this);
+
+  connect(buttonBox, &QDialogButtonBox::rejected, this, &QDialog::reject);
+}
+
+void DiagnosticsDialog::translateUi() {
+  setWindowTitle(qTranslate("Diagnostics"));
+
+  copyButton->setText(qTranslate("Copy to Clipboard"));
+}
+
+void DiagnosticsDialog::on_copyButton_clicked() {
+  copyToClipboard(reportText->toPlainText().toStdString());
+}
+}
@@ -0,0 +1,57 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_DIAGNOSTICS_DIALOG
+#define LOOT_GUI_QT_DIAGNOSTICS_DIALOG
+
+#include <QtWidgets/QDialog>
+#include <QtWidgets/QDialogButtonBox>
+#include <QtWidgets/QPlainTextEdit>
+#include <QtWidgets/QPushButton>
+#include <QtWidgets/QWidget>
+
+#include "gui/qt/diagnostics_report.h"
+
+namespace loot {
+class DiagnosticsDialog : public QDialog {
+  Q_OBJECT
+public:
+  explicit DiagnosticsDialog(QWidget* parent);
+
+  void setReport(const DiagnosticsReport& report);
+
+private:
+  QPlainTextEdit* reportText{new QPlainTextEdit(this)};
+  QDialogButtonBox* buttonBox{
+      new QDialogButtonBox(QDialogButtonBox::StandardButton::Close, this)};
+  QPushButton* copyButton{new QPushButton(this)};
+
+  void setupUi();
+  void translateUi();
+
+private slots:
+  void on_copyButton_clicked();
+};
+}
+
+#endif
@@ -0,0 +1,192 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/diagnostics_report.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <boost/algorithm/string/join.hpp>
+
+#include "gui/version.h"
+
+namespace {
+using loot::CacheStats;
+using loot::StageTiming;
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+
+std::string formatDuration(const std::optional<milliseconds>& duration) {
+  if (!duration.has_value()) {
+    return "not run this session";
+  }
+
+  return fmt::format("{} ms", duration->count());
+}
+
+std::string formatMemory(const std::optional<uint64_t>& bytes) {
+  static constexpr double BYTES_PER_MIB = 1024.0 * 1024.0;
+
+  if (!bytes.has_value()) {
+    return "unknown";
+  }
+
+  return fmt::format("{:.1f} MiB", static_cast<double>(*bytes) / BYTES_PER_MIB);
+}
+
+std::string formatHitRate(const CacheStats& stats) {
+  const auto hitRate = stats.getHitRate();
+  if (!hitRate.has_value()) {
+    return "not used";
+  }
+
+  static constexpr double PERCENT = 100.0;
+
+  return fmt::format("{:.1f}% ({} hits, {} misses)",
+                     *hitRate * PERCENT,
+                     stats.hits,
+                     stats.misses);
+}
+
+std::string formatStageTimings(const std::vector<StageTiming>& timings) {
+  if (timings.empty()) {
+    return "  No stages were recorded.\n";
+  }
+
+  const auto firstStart =
+      std::min_element(timings.begin(),
+                       timings.end(),
+                       [](const StageTiming& lhs, const StageTiming& rhs) {
+                         return lhs.start < rhs.start;
+                       })
+          ->start;
+
+  std::string text;
+  for (const auto& timing : timings) {
+    text += fmt::format(
+        "  {}: started at {} ms, took {} ms\n",
+        timing.name,
+        duration_cast<milliseconds>(timing.start - firstStart).count(),
+        timing.getDuration().count());
+  }
+
+  return text;
+}
+}
+
+namespace loot {
+PluginTypeCounts::PluginTypeCounts(const std::vector<PluginItem>& plugins) {
+  for (const auto& plugin : plugins) {
+    total += 1;
+
+    if (plugin.isActive) {
+      active += 1;
+    }
+
+    if (plugin.isLightPlugin) {
+      light += 1;
+    } else if (plugin.isMediumPlugin) {
+      medium += 1;
+    } else {
+      full += 1;
+    }
+
+    if (plugin.isMaster) {
+      master += 1;
+    }
+
+    if (plugin.isEmpty) {
+      empty += 1;
+    }
+  }
+}
+
+std::string formatDiagnosticsReport(const DiagnosticsReport& report) {
+  std::string text = fmt::format(
+      "LOOT {} (build {})\n", getLootVersion(), getLootRevision());
+
+  text += fmt::format("Resident memory: {}\n",
+                      formatMemory(report.residentMemoryBytes));
+
+  text += "\nStartup stages:\n";
+  text += formatStageTimings(report.startupStageTimings);
+  if (!report.slowestStartupPath.empty()) {
+    text += fmt::format("  Slowest path: {}\n",
+                        boost::join(report.slowestStartupPath, " -> "));
+  }
+
+  text += fmt::format("\nLast game data load: {}\n",
+                      formatDuration(report.lastLoadDuration));
+  text += fmt::format("Last sort: {}\n",
+                      formatDuration(report.lastSortDuration));
+
+  const auto& counts = report.pluginCounts;
+  text += fmt::format(
+      "\nPlugins: {} total, {} active\n"
+      "  Full: {}\n"
+      "  Medium: {}\n"
+      "  Light: {}\n"
+      "  Master-flagged: {}\n"
+      "  Empty: {}\n",
+      counts.total,
+      counts.active,
+      counts.full,
+      counts.medium,
+      counts.light,
+      counts.master,
+      counts.empty);
+
+  text += fmt::format(
+      "\nCard caches:\n"
+      "  Size hint entries: {}\n"
+      "  Rendered card entries: {}\n",
+      report.sizeHintCacheEntries,
+      report.pixmapCacheEntries);
+
+  text += "\nCache hit rates:\n";
+  if (report.cacheStats.empty()) {
+    text += "  No caches have been used.\n";
+  }
+  for (const auto& [name, stats] : report.cacheStats) {
+    text += fmt::format("  {}: {}\n", name, formatHitRate(stats));
+  }
+
+  text += fmt::format("\nTask scheduler: {} threads, {} tasks running\n",
+                      report.schedulerThreadCount,
+                      report.schedulerRunningTaskCount);
+  for (size_t i = 0; i < report.schedulerLaneStats.size(); i += 1) {
+    const auto& stats = report.schedulerLaneStats.at(i);
+    text += fmt::format(
+        "  {}: {} waiting, {} started, {} ms total wait, {} ms max wait, {} "
+        "deduplicated\n",
+        TaskScheduler::getLaneName(i),
+        stats.queueDepth,
+        stats.startedCount,
+        stats.totalWaitTime.count(),
+        stats.maxWaitTime.count(),
+        stats.deduplicatedCount);
+  }
+
+  return text;
+}
+}
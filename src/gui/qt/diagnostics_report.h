@@ -0,0 +1,79 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_DIAGNOSTICS_REPORT
+#define LOOT_GUI_QT_DIAGNOSTICS_REPORT
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gui/plugin_item.h"
+#include "gui/qt/tasks/task_scheduler.h"
+#include "gui/state/diagnostics.h"
+#include "gui/state/stage_graph.h"
+
+namespace loot {
+struct PluginTypeCounts {
+  PluginTypeCounts() = default;
+  explicit PluginTypeCounts(const std::vector<PluginItem>& plugins);
+
+  size_t total{0};
+  size_t active{0};
+  size_t full{0};
+  size_t medium{0};
+  size_t light{0};
+  size_t master{0};
+  size_t empty{0};
+};
+
+struct DiagnosticsReport {
+  std::vector<StageTiming> startupStageTimings;
+  std::vector<std::string> slowestStartupPath;
+
+  std::optional<std::chrono::milliseconds> lastLoadDuration;
+  std::optional<std::chrono::milliseconds> lastSortDuration;
+
+  PluginTypeCounts pluginCounts;
+
+  std::optional<uint64_t> residentMemoryBytes;
+
+  size_t sizeHintCacheEntries{0};
+  size_t pixmapCacheEntries{0};
+  std::map<std::string, CacheStats> cacheStats;
+
+  size_t schedulerThreadCount{0};
+  size_t schedulerRunningTaskCount{0};
+  std::array<TaskLaneStats, TaskScheduler::LANE_COUNT> schedulerLaneStats;
+};
+
+// The report isn't translated because it's intended to be pasted into bug
+// reports.
+std::string formatDiagnosticsReport(const DiagnosticsReport& report);
+}
+
+#endif
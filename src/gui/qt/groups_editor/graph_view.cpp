@@ -25,9 +25,11 @@
 
 #include <math.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtGui/QGuiApplication>
 #include <QtGui/QKeyEvent>
 #include <QtWidgets/QStyle>
+#include <memory>
 #include <set>
 
 #include "gui/qt/groups_editor/edge.h"
@@ -280,6 +282,8 @@ bool GraphView::hasUnsavedLayoutChanges() const {
   return hasUnsavedLayoutChanges_;
 }
 
+bool GraphView::isLayoutInProgress() const { return isLayoutInProgress_; }
+
 bool GraphView::isUserGroup(const std::string& name) const {
   auto qName = QString::fromStdString(name);
 
@@ -339,6 +343,10 @@ void GraphView::wheelEvent(QWheelEvent* event) {
 #endif
 
 void GraphView::doLayout(const std::vector<GroupNodePosition>& nodePositions) {
+  // Any layout that is still being calculated is now out of date.
+  layoutId += 1;
+  setLayoutInProgress(false);
+
   std::vector<Node*> nodes;
   for (const auto item : scene()->items()) {
     auto node = qgraphicsitem_cast<Node*>(item);
@@ -368,18 +376,84 @@ void GraphView::doLayout(const std::vector<GroupNodePosition>& nodePositions) {
     }
   }
 
+  auto input = getGraphLayoutInput(nodes);
+
+  const auto cachedNodePositions = getCachedGraphLayout(input);
+  if (cachedNodePositions.has_value()) {
+    if (logger) {
+      logger->debug("Graph layout loaded from cache");
+    }
+
+    applyLayout(cachedNodePositions.value());
+    return;
+  }
+
   if (logger) {
-    logger->debug("Calculating new graph layout");
+    logger->debug("Calculating new graph layout for {} nodes",
+                  input.nodeNames.size());
   }
 
-  const auto calculatedNodePositions = calculateGraphLayout(nodes);
-  for (const auto& [node, position] : calculatedNodePositions) {
-    if (node == nullptr) {
-      throw std::logic_error(
-          "calculated node positions map contains a null node pointer");
+  // Calculating a layout can take several seconds for large graphs, so do it
+  // on a worker thread so that the dialog stays responsive.
+  setLayoutInProgress(true);
+
+  const auto id = layoutId;
+  auto sharedInput = std::make_shared<GraphLayoutInput>(std::move(input));
+
+  QtConcurrent::run([sharedInput]() {
+    return calculateGraphLayout(*sharedInput);
+  })
+      .then(this,
+            [this, id, sharedInput](
+                std::map<std::string, QPointF> calculatedPositions) {
+              cacheGraphLayout(*sharedInput, calculatedPositions);
+
+              if (id != layoutId) {
+                // The graph has changed since this layout was started.
+                return;
+              }
+
+              applyLayout(calculatedPositions);
+              setLayoutInProgress(false);
+            })
+      .onFailed(this, [this, id](const std::exception& e) {
+        const auto logger = getLogger();
+        if (logger) {
+          logger->error("Failed to calculate graph layout: {}", e.what());
+        }
+
+        if (id == layoutId) {
+          setLayoutInProgress(false);
+        }
+      });
+}
+
+void GraphView::applyLayout(
+    const std::map<std::string, QPointF>& nodePositions) {
+  for (const auto item : scene()->items()) {
+    auto node = qgraphicsitem_cast<Node*>(item);
+    if (!node) {
+      continue;
+    }
+
+    const auto it = nodePositions.find(node->getName().toStdString());
+    if (it != nodePositions.end()) {
+      node->setPosition(it->second);
     }
+  }
+}
+
+void GraphView::setLayoutInProgress(bool inProgress) {
+  if (isLayoutInProgress_ == inProgress) {
+    return;
+  }
+
+  isLayoutInProgress_ = inProgress;
 
-    node->setPosition(position);
+  if (inProgress) {
+    emit layoutStarted();
+  } else {
+    emit layoutFinished();
   }
 }
 }
@@ -27,6 +27,7 @@
 #include <loot/metadata/group.h>
 
 #include <QtWidgets/QGraphicsView>
+#include <map>
 #include <set>
 
 #include "gui/state/game/group_node_positions.h"
@@ -59,6 +60,7 @@ public:
   std::vector<Group> getUserGroups() const;
   std::vector<GroupNodePosition> getNodePositions() const;
   bool hasUnsavedLayoutChanges() const;
+  bool isLayoutInProgress() const;
   bool isUserGroup(const std::string& name) const;
 
   void handleGroupRemoved(const QString& name);
@@ -73,6 +75,8 @@ public:
 signals:
   void groupRemoved(const QString name);
   void groupSelected(const QString& name);
+  void layoutStarted();
+  void layoutFinished();
 
 protected:
 #if QT_CONFIG(wheelevent)
@@ -86,8 +90,12 @@ private:
   QColor userColor;
   QColor backgroundColor;
   bool hasUnsavedLayoutChanges_{false};
+  bool isLayoutInProgress_{false};
+  unsigned int layoutId{0};
 
   void doLayout(const std::vector<GroupNodePosition>& nodePositions);
+  void applyLayout(const std::map<std::string, QPointF>& nodePositions);
+  void setLayoutInProgress(bool inProgress);
 };
 }
 
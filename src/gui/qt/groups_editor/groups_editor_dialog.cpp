@@ -25,6 +25,8 @@
 
 #include <fmt/base.h>
 
+#include <algorithm>
+
 #include <QtWidgets/QCompleter>
 #include <QtWidgets/QDialogButtonBox>
 #include <QtWidgets/QFormLayout>
@@ -98,6 +100,10 @@ void ListWithTitle::addItem(QListWidgetItem* item) {
   listWidget->addItem(item);
 }
 
+void ListWithTitle::addItems(const QStringList& labels) {
+  listWidget->addItems(labels);
+}
+
 void ListWithTitle::clear() { listWidget->clear(); }
 
 void ListWithTitle::setSelectionMode(
@@ -130,6 +136,27 @@ GroupsEditorDialog::GroupsEditorDialog(QWidget* parent,
         Qt::Dialog | Qt::WindowMinMaxButtonsHint | Qt::WindowCloseButtonHint),
     pluginItemModel(pluginItemModel) {
   setupUi();
+
+  // The plugin indices would be invalidated if the model's plugins changed
+  // while the dialog is open, so rebuild them if that happens.
+  const auto rebuildIfVisible = [this]() {
+    if (isVisible()) {
+      updatePluginIndices();
+    }
+  };
+
+  connect(pluginItemModel,
+          &QAbstractItemModel::modelReset,
+          this,
+          rebuildIfVisible);
+  connect(pluginItemModel,
+          &QAbstractItemModel::rowsInserted,
+          this,
+          rebuildIfVisible);
+  connect(pluginItemModel,
+          &QAbstractItemModel::rowsRemoved,
+          this,
+          rebuildIfVisible);
 }
 
 void GroupsEditorDialog::setGroups(
@@ -153,6 +180,8 @@ void GroupsEditorDialog::setGroups(
   initialNodePositions = nodePositions;
   selectedGroupName = std::nullopt;
   newPluginGroups.clear();
+
+  updatePluginIndices();
 }
 
 std::vector<Group> loot::GroupsEditorDialog::getUserGroups() const {
@@ -224,9 +253,18 @@ void GroupsEditorDialog::setupUi() {
 
   autoArrangeButton->setObjectName("autoArrangeButton");
 
-  auto buttonBox = new QDialogButtonBox(
-      QDialogButtonBox::Save | QDialogButtonBox::Cancel, this);
+  layoutProgressLabel->setObjectName("layoutProgressLabel");
+  layoutProgressLabel->setVisible(false);
+
+  layoutProgressBar->setObjectName("layoutProgressBar");
+  layoutProgressBar->setTextVisible(false);
+  layoutProgressBar->setMinimum(0);
+  layoutProgressBar->setMaximum(0);
+  layoutProgressBar->setVisible(false);
+
   buttonBox->setObjectName("dialogButtons");
+  buttonBox->setStandardButtons(QDialogButtonBox::Save |
+                                QDialogButtonBox::Cancel);
 
   auto dialogLayout = new QVBoxLayout();
   auto mainLayout = new QHBoxLayout();
@@ -250,6 +288,8 @@ void GroupsEditorDialog::setupUi() {
   sidebarLayout->addLayout(formLayout);
   sidebarLayout->addWidget(divider2);
   sidebarLayout->addWidget(autoArrangeButton);
+  sidebarLayout->addWidget(layoutProgressLabel);
+  sidebarLayout->addWidget(layoutProgressBar);
 
   mainLayout->addWidget(graphView, 1);
   mainLayout->addLayout(sidebarLayout);
@@ -284,6 +324,7 @@ void GroupsEditorDialog::translateUi() {
   addGroupButton->setText(qTranslate("Add a new group"));
   renameGroupButton->setText(qTranslate("Rename current group"));
   autoArrangeButton->setText(qTranslate("Auto arrange groups"));
+  layoutProgressLabel->setText(qTranslate("Arranging groups…"));
 }
 
 void GroupsEditorDialog::closeEvent(QCloseEvent* event) {
@@ -366,20 +407,41 @@ void GroupsEditorDialog::refreshPluginLists() {
     defaultPluginsCheckBox->setChecked(false);
   }
 
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    const auto pluginGroup = getPluginGroup(plugin);
+  const auto& plugins = pluginItemModel->getPluginItems();
+  const auto& groupIndices = getGroupPluginIndices(groupName);
+
+  QStringList groupPluginNames;
+  for (const auto index : groupIndices) {
+    groupPluginNames.append(QString::fromStdString(plugins.at(index).name));
+  }
 
-    if (pluginGroup == groupName) {
-      groupPluginsList->addItem(QString::fromStdString(plugin.name));
-    } else if (!defaultPluginsCheckBox->isChecked() ||
-               pluginGroup == Group::DEFAULT_NAME) {
-      nonGroupPluginsList->addItem(QString::fromStdString(plugin.name));
+  QStringList otherPluginNames;
+  if (defaultPluginsCheckBox->isChecked()) {
+    const auto& defaultIndices =
+        getGroupPluginIndices(std::string(Group::DEFAULT_NAME));
+    for (const auto index : defaultIndices) {
+      otherPluginNames.append(QString::fromStdString(plugins.at(index).name));
+    }
+  } else {
+    // Both sequences are in ascending order, so walk them together to skip
+    // the plugins that are in the selected group.
+    auto groupIndexIt = groupIndices.begin();
+    for (size_t index = 0; index < plugins.size(); index += 1) {
+      if (groupIndexIt != groupIndices.end() && *groupIndexIt == index) {
+        ++groupIndexIt;
+        continue;
+      }
 
-      // Add plugins that aren't in the current group to the combo box.
-      pluginComboBox->addItem(QString::fromStdString(plugin.name));
+      otherPluginNames.append(QString::fromStdString(plugins[index].name));
     }
   }
 
+  groupPluginsList->addItems(groupPluginNames);
+  nonGroupPluginsList->addItems(otherPluginNames);
+
+  // Add plugins that aren't in the current group to the combo box.
+  pluginComboBox->addItems(otherPluginNames);
+
   if (groupPluginsList->count() == 0) {
     auto text = qTranslate("No plugins are in this group.");
 
@@ -401,9 +463,62 @@ void GroupsEditorDialog::refreshPluginLists() {
   addPluginButton->setEnabled(false);
 }
 
+void GroupsEditorDialog::updatePluginIndices() {
+  pluginIndices.clear();
+  groupPluginIndices.clear();
+
+  const auto& plugins = pluginItemModel->getPluginItems();
+  pluginIndices.reserve(plugins.size());
+
+  for (size_t index = 0; index < plugins.size(); index += 1) {
+    pluginIndices.emplace(plugins[index].name, index);
+    groupPluginIndices[getPluginGroup(plugins[index])].push_back(index);
+  }
+}
+
+const std::vector<size_t>& GroupsEditorDialog::getGroupPluginIndices(
+    const std::string& groupName) const {
+  static const std::vector<size_t> NO_INDICES;
+
+  const auto it = groupPluginIndices.find(groupName);
+
+  return it == groupPluginIndices.end() ? NO_INDICES : it->second;
+}
+
+void GroupsEditorDialog::movePluginToGroup(size_t pluginIndex,
+                                           const std::string& oldGroupName,
+                                           const std::string& newGroupName) {
+  if (oldGroupName == newGroupName) {
+    return;
+  }
+
+  auto& oldIndices = groupPluginIndices[oldGroupName];
+  const auto oldIt =
+      std::lower_bound(oldIndices.begin(), oldIndices.end(), pluginIndex);
+  if (oldIt != oldIndices.end() && *oldIt == pluginIndex) {
+    oldIndices.erase(oldIt);
+  }
+
+  auto& newIndices = groupPluginIndices[newGroupName];
+  const auto newIt =
+      std::lower_bound(newIndices.begin(), newIndices.end(), pluginIndex);
+  if (newIt == newIndices.end() || *newIt != pluginIndex) {
+    newIndices.insert(newIt, pluginIndex);
+  }
+}
+
 const PluginItem* GroupsEditorDialog::getPluginItem(
     const std::string& pluginName) const {
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
+  const auto& plugins = pluginItemModel->getPluginItems();
+
+  const auto indexIt = pluginIndices.find(pluginName);
+  if (indexIt != pluginIndices.end() && indexIt->second < plugins.size()) {
+    return &plugins[indexIt->second];
+  }
+
+  // Plugin names that are typed into the combo box may not match the case of
+  // the plugin's filename, so fall back to a case-insensitive search.
+  for (const auto& plugin : plugins) {
     if (compareFilenames(plugin.name, pluginName) == 0) {
       return &plugin;
     }
@@ -423,21 +538,7 @@ const std::string GroupsEditorDialog::getPluginGroup(
 
 bool GroupsEditorDialog::containsMoreThanOnePlugin(
     const std::string& groupName) const {
-  size_t pluginsCount = 0;
-
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    const auto pluginGroup = getPluginGroup(plugin);
-
-    if (pluginGroup == groupName) {
-      if (pluginsCount == 1) {
-        return true;
-      }
-
-      pluginsCount += 1;
-    }
-  }
-
-  return false;
+  return getGroupPluginIndices(groupName).size() > 1;
 }
 
 void GroupsEditorDialog::handleException(const std::exception& exception) {
@@ -551,6 +652,33 @@ void GroupsEditorDialog::on_graphView_groupSelected(const QString& name) {
   }
 }
 
+void GroupsEditorDialog::on_graphView_layoutStarted() {
+  // Don't allow the graph to be edited or saved until its nodes have been
+  // positioned.
+  graphView->setEnabled(false);
+  autoArrangeButton->setEnabled(false);
+  groupNameInput->setEnabled(false);
+  addGroupButton->setEnabled(false);
+  renameGroupButton->setEnabled(false);
+  buttonBox->button(QDialogButtonBox::Save)->setEnabled(false);
+
+  layoutProgressLabel->setVisible(true);
+  layoutProgressBar->setVisible(true);
+}
+
+void GroupsEditorDialog::on_graphView_layoutFinished() {
+  graphView->setEnabled(true);
+  autoArrangeButton->setEnabled(true);
+  groupNameInput->setEnabled(true);
+  buttonBox->button(QDialogButtonBox::Save)->setEnabled(true);
+
+  // Restore the add and rename buttons' states for the current input.
+  on_groupNameInput_textChanged(groupNameInput->text());
+
+  layoutProgressLabel->setVisible(false);
+  layoutProgressBar->setVisible(false);
+}
+
 void GroupsEditorDialog::on_groupPluginsList_customContextMenuRequested(
     const QPoint& position) {
   try {
@@ -637,6 +765,9 @@ void GroupsEditorDialog::on_addPluginButton_clicked() {
         newPluginGroups.insert_or_assign(pluginItem->name, groupName);
       }
 
+      movePluginToGroup(
+          pluginIndices.at(pluginItem->name), currentPluginGroup, groupName);
+
       // Update whether or not the plugin's old group still contains any
       // plugins.
       graphView->setGroupContainsInstalledPlugins(currentPluginGroup,
@@ -655,7 +786,7 @@ void GroupsEditorDialog::on_addPluginButton_clicked() {
 
 void GroupsEditorDialog::on_addGroupButton_clicked() {
   try {
-    if (groupNameInput->text().isEmpty()) {
+    if (groupNameInput->text().isEmpty() || graphView->isLayoutInProgress()) {
       return;
     }
 
@@ -675,7 +806,8 @@ void GroupsEditorDialog::on_addGroupButton_clicked() {
 void GroupsEditorDialog::on_renameGroupButton_clicked() {
   try {
     if (groupNameInput->text().isEmpty() || !selectedGroupName.has_value() ||
-        !graphView->isUserGroup(selectedGroupName.value())) {
+        !graphView->isUserGroup(selectedGroupName.value()) ||
+        graphView->isLayoutInProgress()) {
       return;
     }
 
@@ -695,12 +827,13 @@ void GroupsEditorDialog::on_renameGroupButton_clicked() {
     graphView->renameGroup(oldName, newName);
 
     // Update plugin groups (step 3).
-    for (const auto& plugin : pluginItemModel->getPluginItems()) {
-      const auto pluginGroup = getPluginGroup(plugin);
+    const auto& plugins = pluginItemModel->getPluginItems();
 
-      if (pluginGroup == oldName) {
-        newPluginGroups.insert_or_assign(plugin.name, newName);
-      }
+    // Copy the indices because moving plugins modifies the group's indices.
+    const auto oldGroupIndices = getGroupPluginIndices(oldName);
+    for (const auto index : oldGroupIndices) {
+      newPluginGroups.insert_or_assign(plugins.at(index).name, newName);
+      movePluginToGroup(index, oldName, newName);
     }
 
     // Update the stored selected group name.
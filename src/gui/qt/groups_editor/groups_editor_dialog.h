@@ -28,13 +28,17 @@
 #include <QtWidgets/QCheckBox>
 #include <QtWidgets/QComboBox>
 #include <QtWidgets/QDialog>
+#include <QtWidgets/QDialogButtonBox>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QLineEdit>
 #include <QtWidgets/QListWidget>
 #include <QtWidgets/QMenu>
+#include <QtWidgets/QProgressBar>
 #include <QtWidgets/QPushButton>
 #include <QtWidgets/QWidget>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "gui/qt/groups_editor/graph_view.h"
 #include "gui/qt/plugin_item_model.h"
@@ -47,6 +51,7 @@ public:
 
   void addItem(const QString& label);
   void addItem(QListWidgetItem* item);
+  void addItems(const QStringList& labels);
 
   void clear();
 
@@ -96,6 +101,8 @@ private:
   QPushButton* addPluginButton{new QPushButton(this)};
 
   QPushButton* autoArrangeButton{new QPushButton(this)};
+  QLabel* layoutProgressLabel{new QLabel(this)};
+  QProgressBar* layoutProgressBar{new QProgressBar(this)};
 
   QLabel* groupNameInputLabel{new QLabel(this)};
   QLineEdit* groupNameInput{new QLineEdit(this)};
@@ -105,6 +112,8 @@ private:
   QAction* actionCopyPluginNames{new QAction(this)};
   QMenu* menuPluginsList{new QMenu(this)};
 
+  QDialogButtonBox* buttonBox{new QDialogButtonBox(this)};
+
   PluginItemModel* pluginItemModel{nullptr};
 
   std::vector<Group> initialUserGroups;
@@ -112,6 +121,11 @@ private:
   std::optional<std::string> selectedGroupName;
   std::unordered_map<std::string, std::string> newPluginGroups;
 
+  // Plugins are identified by their index in pluginItemModel's plugin items,
+  // and each group's indices are kept sorted so that they're in load order.
+  std::unordered_map<std::string, size_t> pluginIndices;
+  std::unordered_map<std::string, std::vector<size_t>> groupPluginIndices;
+
   void setupUi();
   void translateUi();
 
@@ -121,6 +135,12 @@ private:
   bool hasUnsavedChanges();
 
   void refreshPluginLists();
+  void updatePluginIndices();
+  const std::vector<size_t>& getGroupPluginIndices(
+      const std::string& groupName) const;
+  void movePluginToGroup(size_t pluginIndex,
+                         const std::string& oldGroupName,
+                         const std::string& newGroupName);
   const PluginItem* getPluginItem(const std::string& pluginName) const;
   const std::string getPluginGroup(const PluginItem& pluginItem) const;
   bool containsMoreThanOnePlugin(const std::string& groupName) const;
@@ -135,6 +155,8 @@ private slots:
   void on_actionCopyPluginNames_triggered();
   void on_graphView_groupRemoved(const QString name);
   void on_graphView_groupSelected(const QString& name);
+  void on_graphView_layoutStarted();
+  void on_graphView_layoutFinished();
   void on_groupPluginsList_customContextMenuRequested(const QPoint& position);
   void on_nonGroupPluginsList_itemSelectionChanged();
   void on_defaultPluginsCheckBox_checkStateChanged();
@@ -21,21 +21,86 @@
     along with LOOT.  If not, see
     <https://www.gnu.org/licenses/>.
     */
-
 #include "gui/qt/groups_editor/layout.h"
 
 #include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/layered/BarycenterHeuristic.h>
+#include <ogdf/layered/FastHierarchyLayout.h>
+#include <ogdf/layered/LongestPathRanking.h>
 #include <ogdf/layered/MedianHeuristic.h>
 #include <ogdf/layered/OptimalHierarchyLayout.h>
 #include <ogdf/layered/OptimalRanking.h>
 #include <ogdf/layered/SugiyamaLayout.h>
 
 #include "gui/qt/groups_editor/edge.h"
+#include "gui/state/tracing.h"
 
-namespace loot {
+namespace {
 constexpr double LAYER_SPACING = 30.0;
+constexpr int LARGE_GRAPH_SUGIYAMA_RUNS = 3;
+
+void configureLayout(ogdf::SugiyamaLayout& layout, size_t nodeCount) {
+  if (!loot::shouldUseHeuristicLayout(nodeCount)) {
+    layout.setRanking(new ogdf::OptimalRanking);
+    layout.setCrossMin(new ogdf::MedianHeuristic);
+
+    ogdf::OptimalHierarchyLayout* ohl = new ogdf::OptimalHierarchyLayout;
+    ohl->layerDistance(LAYER_SPACING);
+    ohl->nodeDistance(loot::NODE_SPACING);
+    layout.setLayout(ohl);
+    return;
+  }
+
+  // OptimalRanking and OptimalHierarchyLayout both solve linear programs that
+  // get very slow as the graph grows, so use heuristics that give slightly
+  // less tidy results in a fraction of the time.
+  layout.setRanking(new ogdf::LongestPathRanking);
+  layout.setCrossMin(new ogdf::BarycenterHeuristic);
+  layout.runs(LARGE_GRAPH_SUGIYAMA_RUNS);
+
+  ogdf::FastHierarchyLayout* fhl = new ogdf::FastHierarchyLayout;
+  fhl->layerDistance(LAYER_SPACING);
+  fhl->nodeDistance(loot::NODE_SPACING);
+  layout.setLayout(fhl);
+}
+}
+
+namespace loot {
+GraphLayoutInput getGraphLayoutInput(const std::vector<Node*>& nodes) {
+  std::vector<GraphLayoutNode> layoutNodes;
+  for (const auto node : nodes) {
+    if (node == nullptr) {
+      throw std::invalid_argument("nodes vector contains a null pointer");
+    }
+
+    GraphLayoutNode layoutNode;
+    layoutNode.name = node->getName().toStdString();
+    layoutNode.size = node->boundingRect().marginsRemoved(Node::MARGINS).size();
+
+    for (const auto outEdge : node->getOutEdges()) {
+      if (outEdge == nullptr) {
+        throw std::invalid_argument("nodes vector contains a null pointer");
+      }
+
+      layoutNode.outEdgeNodeNames.push_back(
+          outEdge->getDestNode()->getName().toStdString());
+    }
+
+    layoutNodes.push_back(std::move(layoutNode));
+  }
+
+  return getGraphLayoutInput(std::move(layoutNodes));
+}
+
+std::map<std::string, QPointF> calculateGraphLayout(
+    const GraphLayoutInput& input) {
+  TraceSpan span("layout", "Calculate groups graph layout");
+
+  if (input.nodeNames.size() != input.nodeSizes.size()) {
+    throw std::invalid_argument(
+        "Graph layout input has mismatched node names and sizes");
+  }
 
-std::map<Node*, QPointF> calculateGraphLayout(const std::vector<Node*>& nodes) {
   ogdf::Graph graph;
   ogdf::GraphAttributes graphAttributes(
       graph,
@@ -48,78 +113,43 @@ std::map<Node*, QPointF> calculateGraphLayout(const std::vector<Node*>& nodes) {
   graphAttributes.directed() = true;
 
   // Add all nodes to the graph.
-  std::map<Node*, ogdf::node> graphNodes;
-  std::map<ogdf::node, Node*> sceneNodes;
-  for (const auto node : nodes) {
-    if (node == nullptr) {
-      throw std::invalid_argument("nodes vector contains a null pointer");
-    }
-
+  std::vector<ogdf::node> graphNodes;
+  graphNodes.reserve(input.nodeSizes.size());
+  for (const auto& size : input.nodeSizes) {
     const auto graphNode = graph.newNode();
-    const auto boundingRect =
-        node->boundingRect().marginsRemoved(Node::MARGINS);
 
     // The height and width are transposed because the layout algorithm
     // arranges layers vertically, and the result is then rotated to get a
     // horizontal layout.
-    graphAttributes.width(graphNode) = boundingRect.height();
-    graphAttributes.height(graphNode) = boundingRect.width();
+    graphAttributes.width(graphNode) = size.height();
+    graphAttributes.height(graphNode) = size.width();
 
-    graphNodes.emplace(node, graphNode);
-    sceneNodes.emplace(graphNode, node);
+    graphNodes.push_back(graphNode);
   }
 
-  // Now add all edges to the graph, without having to worry if the nodes
-  // already exist or not.
-  for (const auto node : nodes) {
-    const auto fromGraphNode = graphNodes.find(node);
-    if (fromGraphNode == graphNodes.end()) {
+  for (const auto& [from, to] : input.edges) {
+    if (from >= graphNodes.size() || to >= graphNodes.size()) {
       throw std::logic_error("Node is not in graph");
     }
 
-    if (node == nullptr) {
-      throw std::invalid_argument("nodes vector contains a null pointer");
-    }
-
-    for (const auto outEdge : node->getOutEdges()) {
-      if (outEdge == nullptr) {
-        throw std::invalid_argument("nodes vector contains a null pointer");
-      }
-
-      const auto toGraphNode = graphNodes.find(outEdge->getDestNode());
-      if (toGraphNode == graphNodes.end()) {
-        throw std::logic_error("Node is not in graph");
-      }
-
-      graph.newEdge(fromGraphNode->second, toGraphNode->second);
-    }
+    graph.newEdge(graphNodes[from], graphNodes[to]);
   }
 
   ogdf::SugiyamaLayout SL;
-  SL.setRanking(new ogdf::OptimalRanking);
-  SL.setCrossMin(new ogdf::MedianHeuristic);
-
-  ogdf::OptimalHierarchyLayout* ohl = new ogdf::OptimalHierarchyLayout;
-  ohl->layerDistance(LAYER_SPACING);
-  ohl->nodeDistance(NODE_SPACING);
-  SL.setLayout(ohl);
+  configureLayout(SL, graphNodes.size());
 
   SL.call(graphAttributes);
 
   // Now rotate the layout to get a layers arranged horizontally.
   graphAttributes.rotateLeft90();
 
-  std::map<Node*, QPointF> nodePositions;
-
-  for (const auto node : graph.nodes) {
-    QPointF position(graphAttributes.x(node), graphAttributes.y(node));
+  std::map<std::string, QPointF> nodePositions;
 
-    const auto sceneNode = sceneNodes.find(node);
-    if (sceneNode == sceneNodes.end()) {
-      throw std::logic_error("Node is not in scene");
-    }
+  for (size_t i = 0; i < graphNodes.size(); i += 1) {
+    QPointF position(graphAttributes.x(graphNodes[i]),
+                     graphAttributes.y(graphNodes[i]));
 
-    nodePositions.emplace(sceneNode->second, position);
+    nodePositions.emplace(input.nodeNames[i], position);
   }
 
   return nodePositions;
@@ -26,14 +26,19 @@
 
 #include <QtCore/QPoint>
 #include <map>
+#include <string>
 #include <vector>
 
+#include "gui/qt/groups_editor/layout_input.h"
 #include "gui/qt/groups_editor/node.h"
 
 namespace loot {
 constexpr qreal NODE_SPACING = 70;
 
-std::map<Node*, QPointF> calculateGraphLayout(const std::vector<Node*>& nodes);
+GraphLayoutInput getGraphLayoutInput(const std::vector<Node*>& nodes);
+
+std::map<std::string, QPointF> calculateGraphLayout(
+    const GraphLayoutInput& input);
 }
 
 #endif
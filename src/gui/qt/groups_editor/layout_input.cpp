@@ -0,0 +1,147 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/groups_editor/layout_input.h"
+
+#include <algorithm>
+#include <boost/container_hash/hash.hpp>
+#include <stdexcept>
+
+#include "gui/state/diagnostics.h"
+
+namespace {
+loot::GraphLayoutCache& getSharedGraphLayoutCache() {
+  static loot::GraphLayoutCache cache;
+
+  return cache;
+}
+}
+
+namespace loot {
+bool operator==(const GraphLayoutInput& lhs, const GraphLayoutInput& rhs) {
+  return lhs.nodeNames == rhs.nodeNames && lhs.nodeSizes == rhs.nodeSizes &&
+         lhs.edges == rhs.edges;
+}
+
+GraphLayoutInput getGraphLayoutInput(std::vector<GraphLayoutNode> nodes) {
+  // Sort the nodes so that the same graph always produces the same input,
+  // independent of the order that the scene lists its items in.
+  std::sort(nodes.begin(),
+            nodes.end(),
+            [](const GraphLayoutNode& lhs, const GraphLayoutNode& rhs) {
+              return lhs.name < rhs.name;
+            });
+
+  GraphLayoutInput input;
+  std::map<std::string, size_t> nodeIndices;
+  for (const auto& node : nodes) {
+    nodeIndices.emplace(node.name, input.nodeNames.size());
+    input.nodeNames.push_back(node.name);
+    input.nodeSizes.push_back(node.size);
+  }
+
+  for (const auto& node : nodes) {
+    const auto fromIndex = nodeIndices.at(node.name);
+
+    for (const auto& toName : node.outEdgeNodeNames) {
+      const auto toIndex = nodeIndices.find(toName);
+      if (toIndex == nodeIndices.end()) {
+        throw std::logic_error("Node is not in graph");
+      }
+
+      input.edges.emplace_back(fromIndex, toIndex->second);
+    }
+  }
+
+  std::sort(input.edges.begin(), input.edges.end());
+
+  return input;
+}
+
+size_t hashGraphLayoutInput(const GraphLayoutInput& input) {
+  size_t hash = 0;
+
+  for (size_t i = 0; i < input.nodeNames.size(); i += 1) {
+    boost::hash_combine(hash, input.nodeNames[i]);
+    boost::hash_combine(hash, input.nodeSizes[i].width());
+    boost::hash_combine(hash, input.nodeSizes[i].height());
+  }
+
+  for (const auto& [from, to] : input.edges) {
+    boost::hash_combine(hash, from);
+    boost::hash_combine(hash, to);
+  }
+
+  return hash;
+}
+
+bool shouldUseHeuristicLayout(size_t nodeCount) {
+  return nodeCount >= LARGE_GRAPH_NODE_COUNT;
+}
+
+GraphLayoutCache::GraphLayoutCache(Hasher hasher) :
+    hasher_(std::move(hasher)) {}
+
+std::optional<std::map<std::string, QPointF>> GraphLayoutCache::get(
+    const GraphLayoutInput& input) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  const auto it = layouts_.find(hasher_(input));
+
+  // Compare the inputs in case of a hash collision.
+  if (it == layouts_.end() || !(it->second.input == input)) {
+    return std::nullopt;
+  }
+
+  return it->second.nodePositions;
+}
+
+void GraphLayoutCache::insert(
+    const GraphLayoutInput& input,
+    const std::map<std::string, QPointF>& nodePositions) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  // Layouts are only reused while the same graph is edited, so there's no
+  // point keeping many around: just start again when the cache fills up.
+  if (layouts_.size() >= MAX_CACHED_GRAPH_LAYOUTS) {
+    layouts_.clear();
+  }
+
+  layouts_.insert_or_assign(hasher_(input), CachedLayout{input, nodePositions});
+}
+
+std::optional<std::map<std::string, QPointF>> getCachedGraphLayout(
+    const GraphLayoutInput& input) {
+  auto nodePositions = getSharedGraphLayoutCache().get(input);
+
+  getSessionDiagnostics().recordCacheLookup("group layouts",
+                                            nodePositions.has_value());
+
+  return nodePositions;
+}
+
+void cacheGraphLayout(const GraphLayoutInput& input,
+                      const std::map<std::string, QPointF>& nodePositions) {
+  getSharedGraphLayoutCache().insert(input, nodePositions);
+}
+}
@@ -0,0 +1,105 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_GUI_QT_GROUPS_EDITOR_LAYOUT_INPUT
+#define LOOT_GUI_QT_GROUPS_EDITOR_LAYOUT_INPUT
+
+#include <QtCore/QPoint>
+#include <QtCore/QSize>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace loot {
+// Graphs with at least this many nodes are laid out using cheaper heuristics,
+// as the optimal ranking and positioning algorithms scale poorly.
+constexpr size_t LARGE_GRAPH_NODE_COUNT = 150;
+
+constexpr size_t MAX_CACHED_GRAPH_LAYOUTS = 8;
+
+// A node in the group graph, as given to getGraphLayoutInput().
+struct GraphLayoutNode {
+  std::string name;
+  QSizeF size;
+  std::vector<std::string> outEdgeNodeNames;
+};
+
+// A snapshot of the group graph that holds everything needed to calculate
+// a layout, so that the calculation can happen away from the UI thread.
+// Nodes are sorted by name and edges are pairs of node indices.
+struct GraphLayoutInput {
+  std::vector<std::string> nodeNames;
+  std::vector<QSizeF> nodeSizes;
+  std::vector<std::pair<size_t, size_t>> edges;
+};
+
+bool operator==(const GraphLayoutInput& lhs, const GraphLayoutInput& rhs);
+
+GraphLayoutInput getGraphLayoutInput(std::vector<GraphLayoutNode> nodes);
+
+size_t hashGraphLayoutInput(const GraphLayoutInput& input);
+
+bool shouldUseHeuristicLayout(size_t nodeCount);
+
+// Holds the node positions calculated for recently laid out graphs. Lookups
+// compare the whole input, so inputs with the same hash don't get each
+// other's layouts.
+class GraphLayoutCache {
+public:
+  using Hasher = std::function<size_t(const GraphLayoutInput&)>;
+
+  explicit GraphLayoutCache(Hasher hasher = hashGraphLayoutInput);
+
+  std::optional<std::map<std::string, QPointF>> get(
+      const GraphLayoutInput& input) const;
+
+  void insert(const GraphLayoutInput& input,
+              const std::map<std::string, QPointF>& nodePositions);
+
+private:
+  struct CachedLayout {
+    GraphLayoutInput input;
+    std::map<std::string, QPointF> nodePositions;
+  };
+
+  Hasher hasher_;
+  mutable std::mutex mutex_;
+  std::unordered_map<size_t, CachedLayout> layouts_;
+};
+
+// These use a cache that is shared by all graph views, and record lookups in
+// the session diagnostics.
+std::optional<std::map<std::string, QPointF>> getCachedGraphLayout(
+    const GraphLayoutInput& input);
+
+void cacheGraphLayout(const GraphLayoutInput& input,
+                      const std::map<std::string, QPointF>& nodePositions);
+}
+
+#endif
@@ -54,8 +54,17 @@ namespace {
 using loot::getLogger;
 
 static constexpr const char* METADATA_ID_KEY = "blob_sha1";
+static constexpr const char* METADATA_BLOB_SIZE_KEY = "blob_size";
 static constexpr const char* METADATA_DATE_KEY = "update_timestamp";
+static constexpr const char* METADATA_SIZE_KEY = "file_size";
+static constexpr const char* METADATA_MTIME_KEY = "file_mtime";
+static constexpr const char* METADATA_ETAG_KEY = "etag";
+static constexpr const char* METADATA_LAST_MODIFIED_KEY = "last_modified";
+static constexpr const char* METADATA_VALIDATORS_URL_KEY = "validators_url";
+static constexpr qint64 HASH_CHUNK_SIZE = 64 * 1024;
 static constexpr int SHORT_HASH_LENGTH = 7;
+static constexpr int HTTP_STATUS_OK = 200;
+static constexpr int HTTP_STATUS_BAD_REQUEST = 400;
 
 std::filesystem::path getFileMetadataPath(std::filesystem::path filePath) {
   static constexpr const char* METADATA_PATH_SUFFIX = ".metadata.toml";
@@ -64,9 +73,67 @@ std::filesystem::path getFileMetadataPath(std::filesystem::path filePath) {
   return filePath;
 }
 
+int64_t getFileModificationTime(const std::filesystem::path& filePath) {
+  return static_cast<int64_t>(
+      std::filesystem::last_write_time(filePath).time_since_epoch().count());
+}
+
+toml::table parseFileMetadata(const std::filesystem::path& filePath) {
+  auto metadataPath = getFileMetadataPath(filePath);
+
+  // Don't use toml::parse_file() as it just uses a std stream,
+  // which don't support UTF-8 paths on Windows.
+  std::ifstream in(metadataPath);
+  if (!in.is_open()) {
+    throw std::runtime_error(metadataPath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  return toml::parse(in, metadataPath.u8string());
+}
+
+// Checks if the file's size and modification time match those recorded in
+// the given table, i.e. if it's likely to be unchanged since they were
+// recorded.
+bool isFileUnchangedSinceMetadataWritten(const std::filesystem::path& filePath,
+                                         const toml::table& metadata) {
+  const auto size = metadata[METADATA_SIZE_KEY].value<int64_t>();
+  const auto mtime = metadata[METADATA_MTIME_KEY].value<int64_t>();
+
+  return size.has_value() && mtime.has_value() &&
+         size.value() ==
+             static_cast<int64_t>(std::filesystem::file_size(filePath)) &&
+         mtime.value() == getFileModificationTime(filePath);
+}
+
+void insertFileStamp(const std::filesystem::path& filePath,
+                     toml::table& table) {
+  table.insert_or_assign(
+      METADATA_SIZE_KEY,
+      static_cast<int64_t>(std::filesystem::file_size(filePath)));
+  table.insert_or_assign(METADATA_MTIME_KEY, getFileModificationTime(filePath));
+}
+
+void writeFileMetadata(const std::filesystem::path& filePath,
+                       const toml::table& table) {
+  auto metadataPath = getFileMetadataPath(filePath);
+
+  std::ofstream out(metadataPath);
+  if (!out.is_open()) {
+    throw std::runtime_error(metadataPath.u8string() +
+                             " could not be opened for writing");
+  }
+
+  out << table;
+}
+
+// The blob size is the size of the content that the ID hashes, i.e. after
+// line endings have been normalised, if it's known.
 void writeFileRevision(const std::filesystem::path& filePath,
                        const std::string& id,
-                       const std::string& date) {
+                       const std::string& date,
+                       const loot::HttpValidators& validators,
+                       const std::optional<int64_t>& blobSize) {
   auto metadataPath = getFileMetadataPath(filePath);
 
   auto logger = getLogger();
@@ -77,16 +144,88 @@ void writeFileRevision(const std::filesystem::path& filePath,
                  date);
   }
 
-  const auto table =
-      toml::table{{METADATA_ID_KEY, id}, {METADATA_DATE_KEY, date}};
+  auto table = toml::table{{METADATA_ID_KEY, id}, {METADATA_DATE_KEY, date}};
 
-  std::ofstream out(metadataPath);
-  if (!out.is_open()) {
-    throw std::runtime_error(metadataPath.u8string() +
-                             " could not be opened for writing");
+  if (std::filesystem::is_regular_file(filePath)) {
+    insertFileStamp(filePath, table);
   }
 
-  out << table;
+  if (blobSize.has_value()) {
+    table.insert(METADATA_BLOB_SIZE_KEY, blobSize.value());
+  }
+
+  if (!validators.etag.empty()) {
+    table.insert(METADATA_ETAG_KEY, validators.etag);
+  }
+
+  if (!validators.lastModified.empty()) {
+    table.insert(METADATA_LAST_MODIFIED_KEY, validators.lastModified);
+  }
+
+  if (!validators.isEmpty() && !validators.url.empty()) {
+    table.insert(METADATA_VALIDATORS_URL_KEY, validators.url);
+  }
+
+  writeFileMetadata(filePath, table);
+}
+
+// Gets the file's Git blob hash, reusing the hash recorded in its metadata if
+// the file hasn't changed since the hash was recorded. The metadata is only
+// written when a file is updated, so this never writes to it, as it may be
+// called while another thread reads the same file's revision.
+std::string getGitBlobHash(const std::filesystem::path& filePath,
+                           const toml::table& metadata) {
+  if (isFileUnchangedSinceMetadataWritten(filePath, metadata)) {
+    const auto hash = metadata[METADATA_ID_KEY].value<std::string>();
+    if (hash.has_value()) {
+      return hash.value();
+    }
+  }
+
+  return loot::calculateGitBlobHash(filePath);
+}
+
+struct RecordedBlob {
+  std::string hash;
+  int64_t size{0};
+};
+
+// Gets the blob hash and normalised size recorded in the file's metadata, if
+// the file hasn't changed since they were recorded. Metadata written before
+// blob sizes were recorded only has the file's size, which is the normalised
+// size unless the file has CRLF line endings.
+std::optional<RecordedBlob> getRecordedBlob(
+    const std::filesystem::path& filePath) {
+  if (!std::filesystem::is_regular_file(filePath) ||
+      !std::filesystem::exists(getFileMetadataPath(filePath))) {
+    return std::nullopt;
+  }
+
+  try {
+    const auto metadata = parseFileMetadata(filePath);
+    if (!isFileUnchangedSinceMetadataWritten(filePath, metadata)) {
+      return std::nullopt;
+    }
+
+    const auto hash = metadata[METADATA_ID_KEY].value<std::string>();
+    const auto size = metadata[METADATA_BLOB_SIZE_KEY].value<int64_t>();
+    if (!hash.has_value()) {
+      return std::nullopt;
+    }
+
+    return RecordedBlob{
+        hash.value(),
+        size.value_or(metadata[METADATA_SIZE_KEY].value_or(int64_t{0}))};
+  } catch (const std::exception& e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->debug("Could not read the recorded blob hash for {}: {}",
+                    filePath.u8string(),
+                    e.what());
+    }
+
+    return std::nullopt;
+  }
 }
 
 bool isFileUpToDate(const std::filesystem::path& filePath,
@@ -98,7 +237,10 @@ bool isFileUpToDate(const std::filesystem::path& filePath,
   auto logger = getLogger();
 
   try {
-    auto existingFileHash = loot::calculateGitBlobHash(filePath);
+    const auto existingFileHash =
+        std::filesystem::exists(getFileMetadataPath(filePath))
+            ? getGitBlobHash(filePath, parseFileMetadata(filePath))
+            : loot::calculateGitBlobHash(filePath);
 
     if (logger) {
       logger->debug("Calculated blob hash for file at {}: {}",
@@ -118,9 +260,80 @@ bool isFileUpToDate(const std::filesystem::path& filePath,
     return false;
   }
 }
+
+void addGitBlobHeader(QCryptographicHash& hasher, qint64 size) {
+  static constexpr QByteArrayView HEADER_PREFIX = QByteArrayView("blob ");
+
+  const auto sizeString = std::to_string(size);
+
+  hasher.addData(HEADER_PREFIX);
+  hasher.addData(QByteArrayView(sizeString.c_str(),
+                                static_cast<qsizetype>(sizeString.size()) + 1));
+}
+
+// Replaces CRLF line endings in the chunk with LF. A CR at the end of a chunk
+// is held back until it's known whether the next chunk starts with an LF, and
+// must be appended to the output if no chunk follows.
+void normaliseLineEndings(QByteArray& chunk, bool& pendingCarriageReturn) {
+  if (pendingCarriageReturn && !chunk.startsWith('\n')) {
+    chunk.prepend('\r');
+  }
+
+  pendingCarriageReturn = chunk.endsWith('\r');
+  if (pendingCarriageReturn) {
+    chunk.chop(1);
+  }
+
+  chunk.replace(QByteArray("\r\n"), QByteArray("\n"));
+}
+
+// Reads the file in fixed-size chunks, replacing CRLF line endings with LF,
+// and passes each chunk to the given function.
+template <typename Function>
+void readNormalisedChunks(const std::filesystem::path& filePath,
+                          Function function) {
+  QFile file(QString::fromStdString(filePath.u8string()));
+
+  if (!file.open(QIODevice::ReadOnly)) {
+    throw std::runtime_error(filePath.u8string() + " is not a regular file");
+  }
+
+  auto pendingCarriageReturn = false;
+  while (!file.atEnd()) {
+    auto chunk = file.read(HASH_CHUNK_SIZE);
+    if (chunk.isEmpty()) {
+      if (file.error() != QFileDevice::NoError) {
+        throw std::runtime_error("Failed to read " + filePath.u8string() +
+                                 ": " + file.errorString().toStdString());
+      }
+      break;
+    }
+
+    normaliseLineEndings(chunk, pendingCarriageReturn);
+
+    function(chunk);
+  }
+
+  if (pendingCarriageReturn) {
+    function(QByteArray("\r"));
+  }
+}
+
+qint64 getNormalisedSize(const std::filesystem::path& filePath) {
+  qint64 normalisedSize = 0;
+  readNormalisedChunks(filePath, [&](const QByteArray& chunk) {
+    normalisedSize += chunk.size();
+  });
+
+  return normalisedSize;
+}
 }
 
 namespace loot {
+bool HttpValidators::isEmpty() const {
+  return etag.empty() && lastModified.empty();
+}
+
 FileRevisionSummary::FileRevisionSummary(const FileRevision& fileRevision) :
     id(fileRevision.id.substr(0, SHORT_HASH_LENGTH)), date(fileRevision.date) {
   if (fileRevision.is_modified) {
@@ -138,6 +351,95 @@ FileRevisionSummary::FileRevisionSummary(const std::string& id,
                                          const std::string& date) :
     id(id), date(date) {}
 
+DownloadedFileWriter::DownloadedFileWriter(
+    const std::filesystem::path& filePath) :
+    filePath(filePath), file(QString::fromStdString(filePath.u8string())) {
+  // Only the existing file's metadata is read, as the data written is
+  // compared against the blob hash recorded there.
+  const auto recordedBlob = getRecordedBlob(filePath);
+  if (recordedBlob.has_value()) {
+    expectedHash = recordedBlob.value().hash;
+    expectedSize = recordedBlob.value().size;
+    addGitBlobHeader(hasher, expectedSize.value());
+  }
+
+  if (!file.open(QIODevice::WriteOnly)) {
+    throw std::runtime_error("Failed to open a temporary file for " +
+                             filePath.u8string() + ": " +
+                             file.errorString().toStdString());
+  }
+}
+
+void DownloadedFileWriter::write(const QByteArray& data) {
+  if (data.isEmpty()) {
+    return;
+  }
+
+  if (file.write(data) != data.size()) {
+    throw std::runtime_error("Failed to write data for " + filePath.u8string() +
+                             ": " + file.errorString().toStdString());
+  }
+
+  // Hash the data with the line endings that calculateGitBlobHash() would
+  // see once it's been written to the file.
+  auto chunk = data;
+  normaliseLineEndings(chunk, pendingCarriageReturn);
+
+  normalisedSize += chunk.size();
+  if (expectedSize.has_value()) {
+    hasher.addData(chunk);
+  }
+}
+
+bool DownloadedFileWriter::commit(const HttpValidators& validators) {
+  const auto logger = getLogger();
+
+  if (pendingCarriageReturn) {
+    if (expectedSize.has_value()) {
+      hasher.addData(QByteArrayView("\r"));
+    }
+    normalisedSize += 1;
+    pendingCarriageReturn = false;
+  }
+
+  // The hash calculated so far is only valid if the blob header that it
+  // started with has the right size.
+  std::string newHash;
+  if (expectedSize == normalisedSize) {
+    newHash = QString(hasher.result().toHex()).toStdString();
+  }
+
+  const auto hasChanged = newHash.empty() || newHash != expectedHash;
+
+  if (hasChanged) {
+    if (!file.commit()) {
+      throw std::runtime_error("Failed to replace " + filePath.u8string() +
+                               ": " + file.errorString().toStdString());
+    }
+
+    // The size of the new data wasn't known when it started being written,
+    // so it can only be hashed now.
+    if (newHash.empty()) {
+      newHash = calculateGitBlobHash(filePath);
+    }
+  } else {
+    file.cancelWriting();
+  }
+
+  if (logger) {
+    auto logMessage = hasChanged ? "Updated file at {}, new blob hash is {}"
+                                 : "{} is already up to date with blob hash {}";
+    logger->debug(logMessage, filePath.u8string(), newHash);
+  }
+
+  const auto updateTimestamp =
+      QDate::currentDate().toString(Qt::ISODate).toStdString();
+  writeFileRevision(
+      filePath, newHash, updateTimestamp, validators, normalisedSize);
+
+  return hasChanged;
+}
+
 QString qTranslate(const char* text) {
   return QString::fromStdString(translate(text));
 }
@@ -153,14 +455,9 @@ void scaleCardHeading(QLabel& label) {
 }
 
 std::string calculateGitBlobHash(const QByteArray& data) {
-  auto sizeString = std::to_string(data.size());
   auto hasher = QCryptographicHash(QCryptographicHash::Sha1);
 
-  static constexpr QByteArrayView HEADER_PREFIX = QByteArrayView("blob ");
-
-  hasher.addData(HEADER_PREFIX);
-  hasher.addData(QByteArrayView(sizeString.c_str(),
-                                static_cast<qsizetype>(sizeString.size()) + 1));
+  addGitBlobHeader(hasher, data.size());
 
   hasher.addData(data);
 
@@ -168,41 +465,43 @@ std::string calculateGitBlobHash(const QByteArray& data) {
 }
 
 std::string calculateGitBlobHash(const std::filesystem::path& filePath) {
-  QFile file(QString::fromStdString(filePath.u8string()));
-
-  auto result = file.open(QIODevice::ReadOnly);
-  if (!result) {
-    throw std::runtime_error(filePath.u8string() + " is not a regular file");
-  }
-
-  QByteArray fileContent = file.readAll();
-
   // Files in LOOT's repositories are committed with LF line endings, but if the
   // file being read is from the working directory of a local Git repository
   // that has autocrlf enabled, it will have CRLF line endings, so the
   // hash won't match the value calculated by Git unless the line endings
   // are replaced.
-  fileContent.replace(QByteArray("\r\n"), QByteArray("\n"));
-
-  return calculateGitBlobHash(fileContent);
-}
+  //
+  // The blob header includes the size of the normalised content, so unless
+  // the file fits in a single chunk it's read twice: once to get that size
+  // and once to hash its content.
+  std::error_code errorCode;
+  const auto fileSize = std::filesystem::file_size(filePath, errorCode);
+  if (!errorCode && fileSize <= static_cast<uintmax_t>(HASH_CHUNK_SIZE)) {
+    QByteArray fileContent;
+    readNormalisedChunks(
+        filePath, [&](const QByteArray& chunk) { fileContent += chunk; });
+
+    return calculateGitBlobHash(fileContent);
+  }
 
-FileRevision getFileRevision(const std::filesystem::path& filePath) {
-  FileRevision revision;
+  auto hasher = QCryptographicHash(QCryptographicHash::Sha1);
+  addGitBlobHeader(hasher, getNormalisedSize(filePath));
 
-  revision.id = calculateGitBlobHash(filePath);
+  readNormalisedChunks(
+      filePath, [&](const QByteArray& chunk) { hasher.addData(chunk); });
 
-  auto metadataPath = getFileMetadataPath(filePath);
+  return QString(hasher.result().toHex()).toStdString();
+}
 
-  // Don't use toml::parse_file() as it just uses a std stream,
-  // which don't support UTF-8 paths on Windows.
-  std::ifstream in(metadataPath);
-  if (!in.is_open()) {
-    throw std::runtime_error(metadataPath.u8string() +
-                             " could not be opened for parsing");
+FileRevision getFileRevision(const std::filesystem::path& filePath) {
+  if (!std::filesystem::is_regular_file(filePath)) {
+    throw std::runtime_error(filePath.u8string() + " is not a regular file");
   }
 
-  const auto metadata = toml::parse(in, metadataPath.u8string());
+  const auto metadata = parseFileMetadata(filePath);
+
+  FileRevision revision;
+  revision.id = getGitBlobHash(filePath, metadata);
 
   auto hash = metadata[METADATA_ID_KEY].value<std::string>();
   auto timestamp = metadata[METADATA_DATE_KEY].value<std::string>();
@@ -260,7 +559,8 @@ FileRevisionSummary getFileRevisionSummary(
 }
 
 bool updateFileWithData(const std::filesystem::path& filePath,
-                        const QByteArray& data) {
+                        const QByteArray& data,
+                        const HttpValidators& validators) {
   auto logger = getLogger();
 
   auto newHash = calculateGitBlobHash(data);
@@ -291,11 +591,133 @@ bool updateFileWithData(const std::filesystem::path& filePath,
   // update timestamp may have changed.
   auto updateTimestamp =
       QDate::currentDate().toString(Qt::ISODate).toStdString();
-  writeFileRevision(filePath, newHash, updateTimestamp);
+  writeFileRevision(filePath,
+                    newHash,
+                    updateTimestamp,
+                    validators,
+                    static_cast<int64_t>(data.size()));
 
   return hasChanged;
 }
 
+HttpValidators getHttpValidators(const std::filesystem::path& filePath,
+                                 const QUrl& url) {
+  if (!std::filesystem::is_regular_file(filePath)) {
+    return HttpValidators();
+  }
+
+  auto logger = getLogger();
+
+  try {
+    const auto metadata = parseFileMetadata(filePath);
+
+    // If the file has been edited, fetch it again to overwrite the edits.
+    if (!isFileUnchangedSinceMetadataWritten(filePath, metadata)) {
+      if (logger) {
+        logger->debug(
+            "{} may have changed since it was last updated, not making a "
+            "conditional request for it",
+            filePath.u8string());
+      }
+      return HttpValidators();
+    }
+
+    // If the file was downloaded from a different URL (e.g. because the
+    // masterlist source has changed), its validators say nothing about
+    // whether the file at the new URL has changed.
+    const auto validatorsUrl =
+        metadata[METADATA_VALIDATORS_URL_KEY].value_or(std::string());
+    if (validatorsUrl != url.toString(QUrl::FullyEncoded).toStdString()) {
+      if (logger) {
+        logger->debug(
+            "{} was last downloaded from a different URL, not making a "
+            "conditional request for it",
+            filePath.u8string());
+      }
+      return HttpValidators();
+    }
+
+    return HttpValidators{
+        metadata[METADATA_ETAG_KEY].value_or(std::string()),
+        metadata[METADATA_LAST_MODIFIED_KEY].value_or(std::string()),
+        validatorsUrl};
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->debug("Could not read HTTP validators for {}: {}",
+                    filePath.u8string(),
+                    e.what());
+    }
+
+    return HttpValidators();
+  }
+}
+
+HttpValidators getHttpValidators(const QNetworkReply& reply) {
+  return HttpValidators{
+      reply.rawHeader("ETag").toStdString(),
+      reply.rawHeader("Last-Modified").toStdString(),
+      reply.request().url().toString(QUrl::FullyEncoded).toStdString()};
+}
+
+void setConditionalRequestHeaders(QNetworkRequest& request,
+                                  const HttpValidators& validators) {
+  if (!validators.etag.empty()) {
+    request.setRawHeader("If-None-Match",
+                         QByteArray::fromStdString(validators.etag));
+  }
+
+  if (!validators.lastModified.empty()) {
+    request.setRawHeader("If-Modified-Since",
+                         QByteArray::fromStdString(validators.lastModified));
+  }
+}
+
+bool isNotModifiedResponse(const QNetworkReply& reply) {
+  static constexpr int HTTP_STATUS_NOT_MODIFIED = 304;
+
+  return reply.attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() ==
+         HTTP_STATUS_NOT_MODIFIED;
+}
+
+void updateFileRevisionDate(const std::filesystem::path& filePath,
+                            const HttpValidators& validators) {
+  const auto metadata = parseFileMetadata(filePath);
+
+  const auto hash = metadata[METADATA_ID_KEY].value<std::string>();
+  if (!hash.has_value()) {
+    throw std::runtime_error("blob_sha1 field is missing");
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->debug("{} is already up to date with blob hash {}",
+                  filePath.u8string(),
+                  hash.value());
+  }
+
+  // A 304 response may omit validators that haven't changed.
+  auto newValidators = validators;
+  if (newValidators.etag.empty()) {
+    newValidators.etag = metadata[METADATA_ETAG_KEY].value_or(std::string());
+  }
+  if (newValidators.lastModified.empty()) {
+    newValidators.lastModified =
+        metadata[METADATA_LAST_MODIFIED_KEY].value_or(std::string());
+  }
+  if (newValidators.url.empty()) {
+    newValidators.url =
+        metadata[METADATA_VALIDATORS_URL_KEY].value_or(std::string());
+  }
+
+  const auto updateTimestamp =
+      QDate::currentDate().toString(Qt::ISODate).toStdString();
+  writeFileRevision(filePath,
+                    hash.value(),
+                    updateTimestamp,
+                    newValidators,
+                    metadata[METADATA_BLOB_SIZE_KEY].value<int64_t>());
+}
+
 bool updateFile(const std::filesystem::path& source,
                 const std::filesystem::path& destination) {
   const auto logger = getLogger();
@@ -328,7 +750,8 @@ bool updateFile(const std::filesystem::path& source,
   // update timestamp may have changed.
   const auto updateTimestamp =
       QDate::currentDate().toString(Qt::ISODate).toStdString();
-  writeFileRevision(destination, newHash, updateTimestamp);
+  writeFileRevision(
+      destination, newHash, updateTimestamp, HttpValidators(), std::nullopt);
 
   return hasChanged;
 }
@@ -340,6 +763,24 @@ bool isValidUrl(const std::string& location) {
          (scheme == "http" || scheme == "https");
 }
 
+bool hasSuccessfulStatus(const QNetworkReply& reply) {
+  const auto statusCode =
+      reply.attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+
+  if (statusCode < HTTP_STATUS_OK || statusCode >= HTTP_STATUS_BAD_REQUEST) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Unexpected HTTP response status code {} for {}",
+                    statusCode,
+                    reply.url().toString().toStdString());
+    }
+
+    return false;
+  }
+
+  return true;
+}
+
 std::optional<QByteArray> readHttpResponse(QNetworkReply* reply) {
   auto statusCode =
       reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
@@ -347,9 +788,6 @@ std::optional<QByteArray> readHttpResponse(QNetworkReply* reply) {
   auto data = reply->readAll();
   reply->deleteLater();
 
-  static constexpr int HTTP_STATUS_OK = 200;
-  static constexpr int HTTP_STATUS_BAD_REQUEST = 400;
-
   if (statusCode < HTTP_STATUS_OK || statusCode >= HTTP_STATUS_BAD_REQUEST) {
     auto logger = getLogger();
     if (logger) {
@@ -27,11 +27,15 @@
 #include <loot/metadata/message_content.h>
 
 #include <QtCore/QByteArray>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QMetaType>
+#include <QtCore/QSaveFile>
 #include <QtCore/QString>
+#include <QtCore/QUrl>
 #include <QtNetwork/QNetworkReply>
 #include <QtWidgets/QLabel>
 #include <filesystem>
+#include <optional>
 #include <vector>
 
 #include "gui/state/game/game_settings.h"
@@ -45,6 +49,18 @@ struct FileRevision {
   bool is_modified{false};
 };
 
+// The validators that a server sent with a file, which are stored with the
+// file's revision metadata so that it can be requested conditionally.
+struct HttpValidators {
+  std::string etag;
+  std::string lastModified;
+  // The URL that the validators were sent for, as they're only meaningful
+  // for requests to that URL.
+  std::string url;
+
+  bool isEmpty() const;
+};
+
 struct FileRevisionSummary {
   FileRevisionSummary() = default;
   explicit FileRevisionSummary(const FileRevision& fileRevision);
@@ -54,6 +70,33 @@ struct FileRevisionSummary {
   std::string date;
 };
 
+// Writes a downloaded file's data to a temporary file next to it as the data
+// is received, so that the file is only replaced once the download has
+// completed. The data's Git blob hash is calculated as it is received, with
+// CRLF line endings replaced by LF as calculateGitBlobHash() does, on the
+// assumption that its normalised size is the same as the one recorded in the
+// existing file's revision metadata, which is true when the file is already
+// up to date. The existing file's content is never read.
+class DownloadedFileWriter {
+public:
+  explicit DownloadedFileWriter(const std::filesystem::path& filePath);
+
+  void write(const QByteArray& data);
+
+  // Replaces the file with the data written if their hashes differ, then
+  // updates the file's revision metadata. Returns true if the file changed.
+  bool commit(const HttpValidators& validators);
+
+private:
+  std::filesystem::path filePath;
+  QSaveFile file;
+  QCryptographicHash hasher{QCryptographicHash::Sha1};
+  std::string expectedHash;
+  std::optional<qint64> expectedSize;
+  qint64 normalisedSize{0};
+  bool pendingCarriageReturn{false};
+};
+
 QString qTranslate(const char* text);
 
 void scaleCardHeading(QLabel& label);
@@ -69,13 +112,34 @@ FileRevisionSummary getFileRevisionSummary(
     FileType fileType);
 
 bool updateFileWithData(const std::filesystem::path& filePath,
-                        const QByteArray& data);
+                        const QByteArray& data,
+                        const HttpValidators& validators = HttpValidators());
+
+// Gets the validators stored for the given file, or no validators if the
+// file has changed since they were stored or they were sent for a different
+// URL.
+HttpValidators getHttpValidators(const std::filesystem::path& filePath,
+                                 const QUrl& url);
+
+HttpValidators getHttpValidators(const QNetworkReply& reply);
+
+void setConditionalRequestHeaders(QNetworkRequest& request,
+                                  const HttpValidators& validators);
+
+bool isNotModifiedResponse(const QNetworkReply& reply);
+
+// Updates the revision metadata of a file that a conditional request has
+// found to be up to date.
+void updateFileRevisionDate(const std::filesystem::path& filePath,
+                            const HttpValidators& validators);
 
 bool updateFile(const std::filesystem::path& source,
                 const std::filesystem::path& destination);
 
 bool isValidUrl(const std::string& location);
 
+bool hasSuccessfulStatus(const QNetworkReply& reply);
+
 std::optional<QByteArray> readHttpResponse(QNetworkReply* reply);
 
 void showInvalidRegexTooltip(QWidget& widget, const std::string& details);
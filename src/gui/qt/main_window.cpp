@@ -28,6 +28,8 @@
 
 #include <fmt/base.h>
 
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore/QPromise>
 #include <QtCore/QTimer>
 #include <QtCore/QUrl>
 #include <QtGui/QCloseEvent>
@@ -40,6 +42,7 @@
 #include <QtWidgets/QProgressDialog>
 #include <QtWidgets/QScrollBar>
 #include <boost/algorithm/string/predicate.hpp>
+#include <chrono>
 
 #include "gui/backup.h"
 #include "gui/qt/helpers.h"
@@ -48,6 +51,7 @@
 #include "gui/qt/sidebar_plugin_name_delegate.h"
 #include "gui/qt/style.h"
 #include "gui/qt/tasks/check_for_update_task.h"
+#include "gui/qt/tasks/task_scheduler.h"
 #include "gui/qt/tasks/update_masterlist_task.h"
 #include "gui/query/types/apply_sort_query.h"
 #include "gui/query/types/cancel_sort_query.h"
@@ -56,7 +60,12 @@
 #include "gui/query/types/clear_plugin_metadata_query.h"
 #include "gui/query/types/get_game_data_query.h"
 #include "gui/query/types/get_overlapping_plugins_query.h"
+#include "gui/query/types/reload_metadata_query.h"
 #include "gui/query/types/sort_plugins_query.h"
+#include "gui/state/diagnostics.h"
+#include "gui/state/game/game_snapshot.h"
+#include "gui/state/game/helpers.h"
+#include "gui/state/stage_graph.h"
 #include "gui/translate.h"
 #include "gui/version.h"
 
@@ -65,6 +74,30 @@ using loot::GameId;
 using loot::LootSettings;
 using loot::LootState;
 using loot::qTranslate;
+using loot::Task;
+
+QFuture<bool> makeFinishedFuture(bool result) {
+  QPromise<bool> promise;
+  promise.start();
+  promise.addResult(result);
+  promise.finish();
+  return promise.future();
+}
+
+QFuture<void> makeFinishedFuture() {
+  QPromise<void> promise;
+  promise.start();
+  promise.finish();
+  return promise.future();
+}
+
+// Network tasks run in the main thread, so delete them once they're done.
+void deleteTasksWhenDone(const std::vector<Task*>& tasks) {
+  for (const auto task : tasks) {
+    QObject::connect(task, &Task::finished, task, &QObject::deleteLater);
+    QObject::connect(task, &Task::error, task, &QObject::deleteLater);
+  }
+}
 
 void showAmbiguousLoadOrderSetWarning(QWidget* parent, const LootState& state) {
   const auto maybeSTestFile =
@@ -382,6 +415,11 @@ MainWindow::MainWindow(LootState& state, QWidget* parent) :
 
   setupUi();
   refreshGamesDropdown();
+
+  connect(&TaskScheduler::instance(),
+          &TaskScheduler::idle,
+          this,
+          &MainWindow::applyPendingInstalledGames);
 }
 
 void MainWindow::initialise() {
@@ -393,7 +431,8 @@ void MainWindow::initialise() {
     }
 
     if (state->hasCurrentGame()) {
-      state->initCurrentGame();
+      getStartupStageTimings().record(runStage(
+          "game init", {"detection"}, [this]() { state->initCurrentGame(); }));
     }
 
     std::vector<SourcedMessage> initMessages = state->getInitMessages();
@@ -406,6 +445,7 @@ void MainWindow::initialise() {
     pluginItemModel->setGeneralMessages(std::move(initMessages));
 
     if (initHasErrored) {
+      getStartupStageTimings().finish();
       return;
     }
 
@@ -533,6 +573,14 @@ void MainWindow::setupUi() {
   // Set up status bar.
   setStatusBar(statusbar);
 
+  static constexpr int RELOAD_PROGRESS_BAR_WIDTH = 100;
+  reloadProgressBar->setTextVisible(false);
+  reloadProgressBar->setMinimum(0);
+  reloadProgressBar->setMaximum(0);
+  reloadProgressBar->setMaximumWidth(RELOAD_PROGRESS_BAR_WIDTH);
+  reloadProgressBar->hide();
+  statusbar->addPermanentWidget(reloadProgressBar);
+
   setupMenuBar();
   setupToolBar();
 
@@ -624,6 +672,15 @@ void MainWindow::setupUi() {
           this,
           &MainWindow::handleLinkColorChanged);
 
+  connect(contentSearch,
+          &ContentSearch::searchingChanged,
+          searchToolBar,
+          &SearchToolBar::setSearching);
+  connect(contentSearch,
+          &ContentSearch::searchFinished,
+          this,
+          &MainWindow::handleSearchFinished);
+
 #if !defined(_WIN32) && QT_VERSION >= QT_VERSION_CHECK(6, 5, 0)
   // Only run this on Linux, because it intentionally has no effect on Windows.
   connect(QGuiApplication::styleHints(),
@@ -652,6 +709,8 @@ void MainWindow::setupMenuBar() {
 
   actionJoinDiscordServer->setObjectName("actionJoinDiscordServer");
 
+  actionViewDiagnostics->setObjectName("actionViewDiagnostics");
+
   actionAbout->setObjectName("actionAbout");
 
   actionOpenGroupsEditor->setObjectName("actionOpenGroupsEditor");
@@ -739,6 +798,7 @@ void MainWindow::setupMenuBar() {
   menuHelp->addAction(actionOpenFAQs);
   menuHelp->addAction(actionJoinDiscordServer);
   menuHelp->addSeparator();
+  menuHelp->addAction(actionViewDiagnostics);
   menuHelp->addAction(actionAbout);
 
   menuGeneralInfo->addAction(actionUnhideGeneralMessages);
@@ -841,6 +901,10 @@ void MainWindow::setupViews() {
   auto cardDelegate = new CardDelegate(pluginCardsView, cardSizingCache);
   pluginCardsView->setItemDelegate(cardDelegate);
 
+  // Laying out every card's text is slow for large load orders, so only do
+  // it for cards that are near the viewport.
+  cardDelegate->setEstimateOffscreenSizes(true);
+
   connect(cardDelegate,
           &CardDelegate::hideMessage,
           this,
@@ -948,6 +1012,8 @@ void MainWindow::translateUi() {
   /* translators: This string is an action in the Help menu. */
   actionJoinDiscordServer->setText(qTranslate("&Join Discord Server"));
   /* translators: This string is an action in the Help menu. */
+  actionViewDiagnostics->setText(qTranslate("View &Diagnostics"));
+  /* translators: This string is an action in the Help menu. */
   actionAbout->setText(qTranslate("&About"));
 
   // Translate sidebar.
@@ -1088,6 +1154,30 @@ void MainWindow::exitSortingState() {
   actionRefreshContent->setDisabled(false);
 }
 
+void MainWindow::enterReloadingState() {
+  // The plugin cards stay visible and scrollable, but nothing that reads or
+  // writes the game's metadata can be used until it has been reloaded.
+  disableGameActions();
+
+  actionSettings->setDisabled(true);
+  actionUpdateMasterlists->setDisabled(true);
+  gameComboBox->setDisabled(true);
+  actionRefreshContent->setDisabled(true);
+
+  statusbar->showMessage(qTranslate("Reloading metadata…"));
+  reloadProgressBar->show();
+}
+
+void MainWindow::exitReloadingState() {
+  actionSettings->setDisabled(false);
+  actionUpdateMasterlists->setDisabled(false);
+  gameComboBox->setDisabled(false);
+  actionRefreshContent->setDisabled(false);
+
+  statusbar->clearMessage();
+  reloadProgressBar->hide();
+}
+
 void MainWindow::loadGame(bool isOnLOOTStartup) {
   auto progressUpdater = new ProgressUpdater();
 
@@ -1105,18 +1195,23 @@ void MainWindow::loadGame(bool isOnLOOTStartup) {
                            ? &MainWindow::handleStartupGameDataLoaded
                            : &MainWindow::handleRefreshGameDataLoaded;
 
-  executeBackgroundQuery(std::move(query), handler, progressUpdater);
+  // Don't load the same game's data twice if it's requested again before the
+  // first load finishes.
+  const auto deduplicationKey =
+      "GetGameDataQuery:" +
+      state->getCurrentGame().getSettings().getFolderName();
+
+  executeBackgroundQuery(
+      std::move(query), handler, progressUpdater, deduplicationKey);
 }
 
-void MainWindow::updateCounts(
-    const std::vector<SourcedMessage>& generalMessages,
-    const std::vector<PluginItem>& plugins) {
-  const auto counters = GeneralInformationCounters(generalMessages, plugins);
-  const auto hiddenMessageCount = pluginItemModel->countHiddenMessages();
+void MainWindow::updateCounts() {
+  const auto& counters = pluginItemModel->getCounters();
   const auto hiddenPluginCount =
       counters.totalPlugins - static_cast<size_t>(proxyModel->rowCount()) + 1;
 
-  filtersWidget->setMessageCounts(hiddenMessageCount, counters.totalMessages);
+  filtersWidget->setMessageCounts(counters.hiddenMessages,
+                                  counters.totalMessages);
   filtersWidget->setPluginCounts(hiddenPluginCount, counters.totalPlugins);
 }
 
@@ -1134,8 +1229,7 @@ void MainWindow::updateGeneralInformation() {
   const auto masterlistInfo = getFileRevisionSummary(
       state->getCurrentGame().getMasterlistPath(), FileType::Masterlist);
 
-  const auto gameMessages = state->getCurrentGame().getMessages(
-      state->getSettings().getLanguage(),
+  const auto gameMessages = state->getCurrentGame().getGeneralMessages(
       state->getSettings().isWarnOnCaseSensitiveGamePathsEnabled());
   initMessages.insert(
       initMessages.end(), gameMessages.begin(), gameMessages.end());
@@ -1150,8 +1244,7 @@ void MainWindow::updateGeneralInformation() {
 
 void MainWindow::updateGeneralMessages() {
   std::vector<SourcedMessage> initMessages = state->getInitMessages();
-  auto gameMessages = state->getCurrentGame().getMessages(
-      state->getSettings().getLanguage(),
+  auto gameMessages = state->getCurrentGame().getGeneralMessages(
       state->getSettings().isWarnOnCaseSensitiveGamePathsEnabled());
   initMessages.insert(
       initMessages.end(), gameMessages.begin(), gameMessages.end());
@@ -1213,8 +1306,7 @@ void MainWindow::updateSidebarColumnWidths() {
 void MainWindow::setFiltersState(PluginFiltersState&& filtersState) {
   proxyModel->setFiltersState(std::move(filtersState));
 
-  updateCounts(pluginItemModel->getGeneralMessages(),
-               pluginItemModel->getPluginItems());
+  updateCounts();
   refreshSearch();
 }
 
@@ -1224,8 +1316,7 @@ void MainWindow::setFiltersState(
   proxyModel->setFiltersState(std::move(filtersState),
                               std::move(overlappingPluginNames));
 
-  updateCounts(pluginItemModel->getGeneralMessages(),
-               pluginItemModel->getPluginItems());
+  updateCounts();
   refreshSearch();
 }
 
@@ -1250,6 +1341,8 @@ void MainWindow::refreshPluginRawData(const std::string& pluginName) {
           state->getCurrentGame().isPluginActive(plugin->GetName()),
           state->getSettings().getLanguage());
 
+      state->getCurrentGame().publishSnapshotUpdate({newPluginItem});
+
       const auto indexData = QVariant::fromValue(newPluginItem);
       pluginItemModel->setData(index, indexData, RawDataRole);
       break;
@@ -1258,10 +1351,7 @@ void MainWindow::refreshPluginRawData(const std::string& pluginName) {
 }
 
 bool MainWindow::hasErrorMessages() const {
-  const auto counters = GeneralInformationCounters(
-      pluginItemModel->getGeneralMessages(), pluginItemModel->getPluginItems());
-
-  return counters.errors != 0;
+  return pluginItemModel->getCounters().errors != 0;
 }
 
 void MainWindow::sortPlugins(bool isAutoSort) {
@@ -1299,23 +1389,43 @@ void MainWindow::sortPlugins(bool isAutoSort) {
 
   auto sortTask = new QueryTask(std::move(sortPluginsQuery));
 
+  // The scheduler doesn't own tasks that it's given, so delete the sort task
+  // once it's done.
+  connect(sortTask, &Task::finished, sortTask, &QObject::deleteLater);
+  connect(sortTask, &Task::error, sortTask, &QObject::deleteLater);
+
   const auto sortHandler = isAutoSort ? &MainWindow::handlePluginsAutoSorted
                                       : &MainWindow::handlePluginsManualSorted;
 
-  auto updatesFuture =
-      whenAllTasks(updateTasks)
-          .then(this,
-                [this](const QList<QFuture<QueryResult>> futures) {
-                  std::vector<QueryResult> results;
-                  for (const auto& future : futures) {
-                    results.push_back(future.result());
-                  }
-
-                  handleMasterlistUpdated(results);
+  whenAllTasks(updateTasks)
+      .then(this,
+            [this](const QList<QFuture<QueryResult>> futures) {
+              std::vector<QueryResult> results;
+              for (const auto& future : futures) {
+                results.push_back(future.result());
+              }
+
+              // Wait for any metadata reload to finish before sorting.
+              return handleMasterlistUpdated(results, true);
+            })
+      .unwrap()
+      .onFailed(this,
+                [this](const std::exception& e) {
+                  handleError(e.what());
+                  return true;
                 })
-          .onFailed(this,
-                    [this](const std::exception& e) { handleError(e.what()); })
-          .then(this, [sortTask]() { executeBackgroundTask(sortTask); });
+      .then(this, [this, sortTask, progressUpdater](bool canSort) {
+        if (canSort) {
+          executeBackgroundTask(sortTask);
+          return;
+        }
+
+        // The metadata failed to reload, so don't sort using it. The sort
+        // task never runs, so clean up what its handlers would have.
+        progressDialog->reset();
+        sortTask->deleteLater();
+        progressUpdater->deleteLater();
+      });
 
   auto sortFuture =
       taskFuture(sortTask)
@@ -1330,7 +1440,9 @@ void MainWindow::sortPlugins(bool isAutoSort) {
             progressUpdater->deleteLater();
           });
 
-  executeConcurrentBackgroundTasks(updateTasks, updatesFuture);
+  deleteTasksWhenDone(updateTasks);
+  executeNetworkTasks(updateTasks,
+                      state->getSettings().getMaxConcurrentDownloads());
 }
 
 void MainWindow::showFirstRunDialog() {
@@ -1529,7 +1641,13 @@ void MainWindow::closeEvent(QCloseEvent* event) {
 void MainWindow::executeBackgroundQuery(
     std::unique_ptr<Query> query,
     void (MainWindow::*onComplete)(QueryResult),
-    ProgressUpdater* progressUpdater) {
+    ProgressUpdater* progressUpdater,
+    const std::string& deduplicationKey) {
+  // If an identical query is already waiting or running, this is its future,
+  // so the given handler is still run when that query finishes.
+  auto future = loot::executeBackgroundQuery(
+      std::move(query), TaskPriority::interactive, deduplicationKey);
+
   if (progressUpdater != nullptr) {
     connect(progressUpdater,
             &ProgressUpdater::progressUpdate,
@@ -1537,7 +1655,7 @@ void MainWindow::executeBackgroundQuery(
             &MainWindow::handleProgressUpdate);
   }
 
-  loot::executeBackgroundQuery(std::move(query))
+  future
       .then(this,
             [this, onComplete](QueryResult result) {
               (this->*onComplete)(result);
@@ -1582,23 +1700,99 @@ void MainWindow::handleQueryException(const Query& query,
   handleError(query.getErrorMessage());
 }
 
-void MainWindow::handleGameDataLoaded(QueryResult result) {
+QFuture<void> MainWindow::handleGameDataLoaded(QueryResult result) {
   progressDialog->reset();
 
-  pluginItemModel->setPluginItems(std::move(std::get<PluginItems>(result)));
+  return loadPluginItems(std::move(std::get<PluginItems>(result)))
+      .then(this, [this](bool wereLoaded) {
+        if (wereLoaded) {
+          enableGameActions();
+        }
+      });
+}
+
+// The returned future's result is false if newer plugin items were loaded
+// first, in which case the given items are discarded.
+QFuture<bool> MainWindow::loadPluginItems(std::vector<PluginItem>&& items) {
+  auto pluginItems =
+      std::make_shared<std::vector<PluginItem>>(std::move(items));
+
+  // Set the old messages first so that the precomputed sizes account for
+  // them.
   pluginItemModel->setOldMessages(
       readOldMessages(state->getCurrentGame().getOldMessagesPath()));
 
-  updateGeneralInformation();
+  // Size all the new cards up front so that the view doesn't need to size
+  // them one at a time once they've been added to the model.
+  const auto cardDelegate =
+      qobject_cast<CardDelegate*>(pluginCardsView->itemDelegate());
+  auto sizesPrecomputed =
+      cardDelegate
+          ? cardDelegate->precomputeSizeHints(
+                pluginItemModel->getFilteredContent(*pluginItems),
+                pluginItemModel->getHasHiddenMessages(*pluginItems))
+          : makeFinishedFuture();
+
+  const auto loadId = ++latestGameDataLoadId;
 
-  filtersWidget->setGroups(GetGroupNames(state->getCurrentGame()));
-  filtersWidget->showCreationClubPluginsFilter(
-      hadCreationClub(state->getCurrentGame().getSettings().getId()));
+  return sizesPrecomputed.then(this, [this, loadId, pluginItems]() {
+    if (loadId != latestGameDataLoadId) {
+      // Newer game data has been loaded since, so don't overwrite it.
+      return false;
+    }
+
+    pluginItemModel->setPluginItems(std::move(*pluginItems));
+
+    updateGeneralInformation();
 
-  pluginEditorWidget->setBashTagCompletions(
-      state->getCurrentGame().getKnownBashTags());
+    filtersWidget->setGroups(GetGroupNames(state->getCurrentGame()));
+    filtersWidget->showCreationClubPluginsFilter(
+        hadCreationClub(state->getCurrentGame().getSettings().getId()));
 
-  enableGameActions();
+    pluginEditorWidget->setBashTagCompletions(
+        state->getCurrentGame().getKnownBashTags());
+
+    return true;
+  });
+}
+
+// The returned future's result is false if the metadata could not be reloaded.
+// When the reload is part of sorting, the sort keeps showing its progress
+// dialog throughout and restores the UI once it's done, so the reload leaves
+// both alone.
+QFuture<bool> MainWindow::reloadMetadata(bool isBeforeSort) {
+  writeOldMessages(state->getCurrentGame().getOldMessagesPath(),
+                   pluginItemModel->getCurrentMessages());
+
+  if (isBeforeSort) {
+    handleProgressUpdate(qTranslate("Reloading metadata…"));
+  } else {
+    progressDialog->reset();
+    enterReloadingState();
+  }
+
+  std::unique_ptr<Query> query = std::make_unique<ReloadMetadataQuery>(
+      state->getCurrentGame(), state->getSettings().getLanguage());
+
+  return loot::executeBackgroundQuery(std::move(query))
+      .then(this,
+            [this, isBeforeSort](QueryResult result) {
+              if (isBeforeSort) {
+                loadPluginItems(std::move(std::get<PluginItems>(result)));
+              } else {
+                exitReloadingState();
+                handleGameDataLoaded(result);
+              }
+              return true;
+            })
+      .onFailed(this, [this, isBeforeSort](const std::exception& e) {
+        if (!isBeforeSort) {
+          exitReloadingState();
+          enableGameActions();
+        }
+        handleException(e);
+        return false;
+      });
 }
 
 bool MainWindow::handlePluginsSorted(QueryResult result) {
@@ -1621,7 +1815,8 @@ bool MainWindow::handlePluginsSorted(QueryResult result) {
     return false;
   }
 
-  auto currentLoadOrder = state->getCurrentGame().getLoadOrder();
+  const auto currentLoadOrder =
+      state->getCurrentGame().getSnapshot()->loadOrder;
   const auto loadOrderHasChanged =
       hasLoadOrderChanged(currentLoadOrder, sortedPlugins);
 
@@ -1658,20 +1853,47 @@ std::optional<std::filesystem::path> MainWindow::createBackup() {
       QDateTime::currentDateTime().toString("yyyyMMddThhmmss").toStdString();
 
   auto sourceDir = state->getPaths().getLootDataPath();
-  auto destDir =
-      state->getPaths().getLootDataPath() / "backups" / backupBasename;
+  auto zipPath = state->getPaths().getLootDataPath() / "backups" /
+                 (backupBasename + ".zip");
 
-  loot::createBackup(sourceDir, destDir);
-
-  if (!std::filesystem::exists(destDir)) {
+  if (!loot::createBackup(sourceDir, zipPath).has_value()) {
     return std::nullopt;
   }
 
-  auto zipPath = compressDirectory(destDir);
+  return zipPath;
+}
 
-  std::filesystem::remove_all(destDir);
+DiagnosticsReport MainWindow::getDiagnosticsReport() const {
+  DiagnosticsReport report;
 
-  return zipPath;
+  const auto& startupStageTimings = getStartupStageTimings();
+  report.startupStageTimings = startupStageTimings.getTimings();
+  report.slowestStartupPath = startupStageTimings.getSlowestPath();
+
+  const auto& sessionDiagnostics = getSessionDiagnostics();
+  report.lastLoadDuration = sessionDiagnostics.getLastLoadDuration();
+  report.lastSortDuration = sessionDiagnostics.getLastSortDuration();
+  report.cacheStats = sessionDiagnostics.getCacheStats();
+
+  report.pluginCounts = PluginTypeCounts(pluginItemModel->getPluginItems());
+  report.residentMemoryBytes = getResidentMemoryBytes();
+
+  const auto cardDelegate =
+      qobject_cast<CardDelegate*>(pluginCardsView->itemDelegate());
+  if (cardDelegate) {
+    const auto cardCacheStats = cardDelegate->getCacheStats();
+    report.sizeHintCacheEntries = cardCacheStats.sizeHintCacheEntries;
+    report.pixmapCacheEntries = cardCacheStats.pixmapCacheEntries;
+    report.cacheStats.emplace("card size hints", cardCacheStats.sizeHints);
+    report.cacheStats.emplace("rendered cards", cardCacheStats.pixmaps);
+  }
+
+  const auto& scheduler = TaskScheduler::instance();
+  report.schedulerThreadCount = scheduler.getThreadCount();
+  report.schedulerRunningTaskCount = scheduler.getRunningTaskCount();
+  report.schedulerLaneStats = scheduler.getLaneStats();
+
+  return report;
 }
 
 void MainWindow::checkForAmbiguousLoadOrder() {
@@ -1716,6 +1938,64 @@ void MainWindow::refreshGamesDropdown() {
   }
 }
 
+void MainWindow::detectInstalledGames() {
+  // Detection can take several seconds, so run it in the background. If
+  // it's started again before it finishes, only the latest results are used.
+  const auto detectionId = ++latestGameDetectionId;
+
+  QtConcurrent::run([state = state,
+                     gamesSettings = state->getSettings().getGameSettings()]() {
+    return state->detectInstalledGames(gamesSettings);
+  })
+      .then(this,
+            [this, detectionId](const InstalledGames& installedGames) {
+              if (detectionId != latestGameDetectionId) {
+                return;
+              }
+
+              pendingInstalledGames = installedGames;
+              applyPendingInstalledGames();
+            })
+      .onFailed(this, [this](const std::exception& e) { handleException(e); });
+}
+
+void MainWindow::applyPendingInstalledGames() {
+  // Background queries hold references to games, so wait until none are
+  // waiting or running. This is called again when the scheduler next
+  // becomes idle.
+  if (!pendingInstalledGames.has_value() ||
+      !TaskScheduler::instance().isIdle()) {
+    return;
+  }
+
+  try {
+    const auto installedGames = std::move(pendingInstalledGames.value());
+    pendingInstalledGames.reset();
+
+    const auto gamesSettings = state->applyInstalledGames(installedGames);
+    state->getSettings().storeGameSettings(gamesSettings);
+
+    // The current game's hidden messages may have changed while detection was
+    // running.
+    if (state->hasCurrentGame()) {
+      recordCurrentGameHiddenMessages(state->getSettings(),
+                                      state->getCurrentGame().getSettings());
+    }
+
+    state->getSettings().save(state->getPaths().getSettingsPath());
+
+    refreshGamesDropdown();
+
+    if (state->hasCurrentGame()) {
+      updateGeneralMessages();
+    } else {
+      updateGeneralInformation();
+    }
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::setHiddenMessages(
     const std::vector<HiddenMessage>& hiddenMessages) {
   state->getCurrentGame().getSettings().setHiddenMessages(hiddenMessages);
@@ -1773,21 +2053,34 @@ void MainWindow::on_actionUpdateMasterlists_triggered() {
 
     handleProgressUpdate(qTranslate("Updating all masterlists…"));
 
-    auto whenAll = whenAllTasks(tasks)
-                       .then(this,
-                             [this](const QList<QFuture<QueryResult>> futures) {
-                               std::vector<QueryResult> results;
-                               for (const auto& future : futures) {
-                                 results.push_back(future.result());
-                               }
-
-                               handleMasterlistsUpdated(results);
-                             })
-                       .onFailed(this, [this](const std::exception& e) {
-                         handleError(e.what());
-                       });
-
-    executeConcurrentBackgroundTasks(tasks, whenAll);
+    const auto startTime = std::chrono::steady_clock::now();
+
+    whenAllTasks(tasks)
+        .then(this,
+              [this, startTime](const QList<QFuture<QueryResult>> futures) {
+                const auto logger = getLogger();
+                if (logger) {
+                  logger->info(
+                      "Updating {} files took {} ms",
+                      futures.size(),
+                      std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - startTime)
+                          .count());
+                }
+
+                std::vector<QueryResult> results;
+                for (const auto& future : futures) {
+                  results.push_back(future.result());
+                }
+
+                handleMasterlistsUpdated(results);
+              })
+        .onFailed(this,
+                  [this](const std::exception& e) { handleError(e.what()); });
+
+    deleteTasksWhenDone(tasks);
+    executeNetworkTasks(tasks,
+                        state->getSettings().getMaxConcurrentDownloads());
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -1890,7 +2183,7 @@ void MainWindow::on_actionRestoreLoadOrder_triggered() {
   try {
     const auto backups = state->getCurrentGame().findLoadOrderBackups();
     restoreBackupDialog->setCurrentLoadOrder(
-        state->getCurrentGame().getLoadOrder());
+        state->getCurrentGame().getSnapshot()->loadOrder);
     restoreBackupDialog->setLoadOrderBackups(backups);
     restoreBackupDialog->open();
 
@@ -2277,6 +2570,15 @@ void MainWindow::on_actionJoinDiscordServer_triggered() {
   QDesktopServices::openUrl(QUrl("https://loot.github.io/discord/"));
 }
 
+void MainWindow::on_actionViewDiagnostics_triggered() {
+  try {
+    diagnosticsDialog->setReport(getDiagnosticsReport());
+    diagnosticsDialog->open();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::on_actionAbout_triggered() {
   try {
     std::string textTemplate = R"(
@@ -2434,7 +2736,7 @@ void MainWindow::on_actionDiscardSort_triggered() {
 void MainWindow::on_actionCompareLoadOrders_triggered() {
   try {
     compareLoadOrdersDialog->setLoadOrders(
-        state->getCurrentGame().getLoadOrder(),
+        state->getCurrentGame().getSnapshot()->loadOrder,
         pluginItemModel->getPluginNames());
     compareLoadOrdersDialog->open();
 
@@ -2453,20 +2755,21 @@ void MainWindow::on_actionUpdateMasterlist_triggered() {
 
     const std::vector<Task*> tasks{preludeTask, masterlistTask};
 
-    auto whenAll =
-        whenAllTasks(tasks)
-            .then(this,
-                  [this](const QList<QFuture<QueryResult>> futures) {
-                    auto preludeResult = futures[0].result();
-                    auto masterlistResult = futures[1].result();
-
-                    handleMasterlistUpdated({preludeResult, masterlistResult});
-                  })
-            .onFailed(this, [this](const std::exception& e) {
-              handleError(e.what());
-            });
-
-    executeConcurrentBackgroundTasks(tasks, whenAll);
+    whenAllTasks(tasks)
+        .then(this,
+              [this](const QList<QFuture<QueryResult>> futures) {
+                auto preludeResult = futures[0].result();
+                auto masterlistResult = futures[1].result();
+
+                handleMasterlistUpdated({preludeResult, masterlistResult},
+                                        false);
+              })
+        .onFailed(this,
+                  [this](const std::exception& e) { handleError(e.what()); });
+
+    deleteTasksWhenDone(tasks);
+    executeNetworkTasks(tasks,
+                        state->getSettings().getMaxConcurrentDownloads());
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2583,8 +2886,7 @@ void MainWindow::on_pluginItemModel_dataChanged(const QModelIndex& topLeft,
 
   if (roles.isEmpty() || roles.contains(RawDataRole) ||
       roles.contains(FilteredContentRole)) {
-    updateCounts(pluginItemModel->getGeneralMessages(),
-                 pluginItemModel->getPluginItems());
+    updateCounts();
     refreshSearch();
   }
 
@@ -2603,6 +2905,9 @@ void MainWindow::on_pluginItemModel_rowsInserted(const QModelIndex&,
                                                  int first,
                                                  int last) {
   cardSizingCache.update(pluginItemModel, first, last);
+
+  // Any existing search results are for the old rows, so search again.
+  refreshSearch();
 }
 
 void MainWindow::on_pluginEditorWidget_accepted(PluginMetadata userMetadata) {
@@ -2671,8 +2976,11 @@ void MainWindow::on_filtersWidget_overlapFilterChanged(
         state->getSettings().getLanguage(),
         targetPluginName.value());
 
-    executeBackgroundQuery(
-        std::move(query), &MainWindow::handleOverlapFilterChecked, nullptr);
+    executeBackgroundQuery(std::move(query),
+                           &MainWindow::handleOverlapFilterChecked,
+                           nullptr,
+                           "GetOverlappingPluginsQuery:" +
+                               targetPluginName.value());
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2702,6 +3010,8 @@ void MainWindow::on_settingsDialog_accepted() {
     if (state->getSettings().getTheme() != currentTheme) {
       applyTheme();
     }
+
+    detectInstalledGames();
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2748,28 +3058,20 @@ void MainWindow::on_searchToolBar_textChanged(const QVariant& text) {
        text.toRegularExpression().pattern().isEmpty());
 
   if (isEmpty) {
-    proxyModel->clearSearchResults();
+    contentSearch->cancel();
+    pluginItemModel->clearSearchResults();
     return;
   }
 
   if (text.userType() == QMetaType::QRegularExpression &&
       !text.toRegularExpression().isValid()) {
     // Do nothing if given an invalid regex.
+    return;
   }
 
-  const auto flags = text.userType() == QMetaType::QRegularExpression
-                         ? Qt::MatchRegularExpression | Qt::MatchWrap
-                         : Qt::MatchContains | Qt::MatchWrap;
-
-  auto results =
-      proxyModel->match(proxyModel->index(0, PluginItemModel::CARDS_COLUMN),
-                        ContentSearchRole,
-                        text,
-                        -1,
-                        flags);
-
-  proxyModel->setSearchResults(results);
-  searchToolBar->setSearchResults(static_cast<size_t>(results.size()));
+  // Matching is done on a worker thread once typing pauses, and the results
+  // are applied by handleSearchFinished().
+  contentSearch->search(text);
 }
 
 void MainWindow::on_searchToolBar_currentResultChanged(size_t resultIndex) {
@@ -2779,6 +3081,15 @@ void MainWindow::on_searchToolBar_currentResultChanged(size_t resultIndex) {
   pluginCardsView->scrollTo(proxyIndex, QAbstractItemView::PositionAtTop);
 }
 
+void MainWindow::handleSearchFinished(const std::vector<int>& sourceRows) {
+  try {
+    pluginItemModel->setSearchResults(sourceRows);
+    searchToolBar->setSearchResults(sourceRows.size());
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::on_backupDialog_accepted() {
   try {
     auto name = backupDialog->getBackupName();
@@ -2815,7 +3126,7 @@ void MainWindow::on_restoreBackupDialog_accepted() {
 
       // Before restoring the backup first remove any plugins that are no longer
       // installed.
-      std::vector<std::string> loadOrder = backup.value().loadOrder;
+      auto loadOrder = readLoadOrderBackup(backup.value());
       for (auto it = loadOrder.begin(); it != loadOrder.end();) {
         if (!state->getCurrentGame().fileExists(*it)) {
           it = loadOrder.erase(it);
@@ -2842,9 +3153,8 @@ void MainWindow::handleGameChanged(QueryResult result) {
     filtersWidget->resetOverlapAndGroupsFilters();
     disablePluginActions();
 
-    handleGameDataLoaded(result);
-
-    updateSidebarColumnWidths();
+    handleGameDataLoaded(result).then(
+        this, [this]() { updateSidebarColumnWidths(); });
 
     // Perform ambiguous load order check because load order state was refreshed
     // when loading the new game's data.
@@ -2868,21 +3178,28 @@ void MainWindow::handleRefreshGameDataLoaded(QueryResult result) {
 
 void MainWindow::handleStartupGameDataLoaded(QueryResult result) {
   try {
-    handleGameDataLoaded(result);
-
-    if (state->getSettings().isAutoSortEnabled()) {
-      if (hasErrorMessages()) {
-        state->getCurrentGame().appendMessage(createPlainTextSourcedMessage(
-            MessageType::error,
-            MessageSource::autoSortCancellation,
-            translate("Auto-sort has been cancelled as there is at "
-                      "least one error message displayed.")));
-
-        updateGeneralMessages();
-      } else {
-        sortPlugins(true);
+    const auto renderStart = std::chrono::steady_clock::now();
+
+    handleGameDataLoaded(result).then(this, [this, renderStart]() {
+      const auto renderEnd = std::chrono::steady_clock::now();
+      getStartupStageTimings().record(
+          StageTiming{"render", {"derive items"}, renderStart, renderEnd});
+      getStartupStageTimings().finish();
+
+      if (state->getSettings().isAutoSortEnabled()) {
+        if (hasErrorMessages()) {
+          state->getCurrentGame().appendMessage(createPlainTextSourcedMessage(
+              MessageType::error,
+              MessageSource::autoSortCancellation,
+              translate("Auto-sort has been cancelled as there is at "
+                        "least one error message displayed.")));
+
+          updateGeneralMessages();
+        } else {
+          sortPlugins(true);
+        }
       }
-    }
+    });
 
     // Perform ambiguous load order check because load order state was refreshed
     // when loading game data.
@@ -2922,10 +3239,12 @@ void MainWindow::handlePluginsAutoSorted(QueryResult result) {
   }
 }
 
-void MainWindow::handleMasterlistUpdated(std::vector<QueryResult> results) {
+QFuture<bool> MainWindow::handleMasterlistUpdated(
+    std::vector<QueryResult> results,
+    bool isBeforeSort) {
   try {
     if (results.empty()) {
-      return;
+      return makeFinishedFuture(true);
     }
 
     const auto wasPreludeUpdated = std::get<bool>(results.at(0));
@@ -2933,35 +3252,32 @@ void MainWindow::handleMasterlistUpdated(std::vector<QueryResult> results) {
         std::get<MasterlistUpdateResult>(results.at(1)).second;
 
     if (!wasPreludeUpdated && !wasMasterlistUpdated) {
-      progressDialog->reset();
+      if (!isBeforeSort) {
+        progressDialog->reset();
+      }
       showNotification(qTranslate("No masterlist update was necessary."));
 
       // Update general info as the timestamp may have changed and if metadata
       // was previously missing it can now be displayed.
       updateGeneralInformation();
-      return;
+      return makeFinishedFuture(true);
     }
 
-    writeOldMessages(state->getCurrentGame().getOldMessagesPath(),
-                     pluginItemModel->getCurrentMessages());
-
-    state->getCurrentGame().loadMetadata();
-
-    const auto pluginItems =
-        getPluginItems(state->getCurrentGame().getLoadOrder(),
-                       state->getCurrentGame(),
-                       state->getSettings().getLanguage());
-
-    handleGameDataLoaded(pluginItems);
-
     auto masterlistInfo = getFileRevisionSummary(
         state->getCurrentGame().getMasterlistPath(), FileType::Masterlist);
     auto infoText = fmt::format(
         translate("Masterlist updated to revision {0}."), masterlistInfo.id);
 
-    showNotification(QString::fromStdString(infoText));
+    return reloadMetadata(isBeforeSort)
+        .then(this, [this, infoText](bool wasReloaded) {
+          if (wasReloaded) {
+            showNotification(QString::fromStdString(infoText));
+          }
+          return wasReloaded;
+        });
   } catch (const std::exception& e) {
     handleException(e);
+    return makeFinishedFuture(true);
   }
 }
 
@@ -3029,18 +3345,8 @@ void MainWindow::handleMasterlistsUpdated(std::vector<QueryResult> results) {
     }
 
     if (wasCurrentGameMasterlistUpdated) {
-      writeOldMessages(state->getCurrentGame().getOldMessagesPath(),
-                       pluginItemModel->getCurrentMessages());
-
       // Need to reload the current game data.
-      state->getCurrentGame().loadMetadata();
-
-      const auto pluginItems =
-          getPluginItems(state->getCurrentGame().getLoadOrder(),
-                         state->getCurrentGame(),
-                         state->getSettings().getLanguage());
-
-      handleGameDataLoaded(pluginItems);
+      reloadMetadata(false);
     } else {
       progressDialog->reset();
     }
@@ -3079,10 +3385,13 @@ void MainWindow::handleOverlapFilterChecked(QueryResult result) {
       gameDataLoadedResult.push_back(pluginPair.first);
     }
 
-    handleGameDataLoaded(gameDataLoadedResult);
-
-    setFiltersState(filtersWidget->getPluginFiltersState(),
-                    std::move(overlappingPluginNames));
+    handleGameDataLoaded(gameDataLoadedResult)
+        .then(this,
+              [this, overlappingPluginNames =
+                         std::move(overlappingPluginNames)]() mutable {
+                setFiltersState(filtersWidget->getPluginFiltersState(),
+                                std::move(overlappingPluginNames));
+              });
 
     // Load order state was refreshed when plugins were loaded, so check for
     // ambiguity.
@@ -3171,6 +3480,14 @@ void MainWindow::handleLinkColorChanged() {
   auto palette = qApp->palette();
   palette.setColor(QPalette::Active, QPalette::Link, linkColor);
   qApp->setPalette(palette);
+
+  const auto cardDelegate =
+      qobject_cast<CardDelegate*>(pluginCardsView->itemDelegate());
+
+  if (cardDelegate) {
+    // Cached card renders use the old link colour.
+    cardDelegate->invalidatePixmapCache();
+  }
 }
 
 #if QT_VERSION >= QT_VERSION_CHECK(6, 5, 0)
@@ -3191,8 +3508,7 @@ void MainWindow::handleHideMessage(const std::string& pluginName,
       actionUnhideGeneralMessages->setEnabled(true);
     }
 
-    updateCounts(pluginItemModel->getGeneralMessages(),
-                 pluginItemModel->getPluginItems());
+    updateCounts();
   } catch (const std::exception& e) {
     handleException(e);
   }
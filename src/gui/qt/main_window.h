@@ -37,6 +37,7 @@
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QMenuBar>
+#include <QtWidgets/QProgressBar>
 #include <QtWidgets/QProgressDialog>
 #include <QtWidgets/QPushButton>
 #include <QtWidgets/QScrollArea>
@@ -54,6 +55,8 @@
 #include "gui/qt/back_up_load_order_dialog.h"
 #include "gui/qt/card_delegate.h"
 #include "gui/qt/compare_load_orders_dialog.h"
+#include "gui/qt/content_search.h"
+#include "gui/qt/diagnostics_dialog.h"
 #include "gui/qt/filters_widget.h"
 #include "gui/qt/groups_editor/groups_editor_dialog.h"
 #include "gui/qt/plugin_editor/plugin_editor_widget.h"
@@ -111,6 +114,7 @@ private:
   QAction* actionOpenFAQs{new QAction(this)};
   QAction* actionOpenLOOTDataFolder{new QAction(this)};
   QAction* actionJoinDiscordServer{new QAction(this)};
+  QAction* actionViewDiagnostics{new QAction(this)};
   QAction* actionAbout{new QAction(this)};
   QAction* actionQuit{new QAction(this)};
   QAction* actionOpenGroupsEditor{new QAction(this)};
@@ -146,6 +150,7 @@ private:
   SearchToolBar* searchToolBar{new SearchToolBar(this)};
 
   QProgressDialog* progressDialog{new QProgressDialog(this)};
+  QProgressBar* reloadProgressBar{new QProgressBar(statusbar)};
 
   QSplitter* sidebarSplitter{new QSplitter(this)};
   QToolBox* toolBox{new QToolBox(sidebarSplitter)};
@@ -167,9 +172,11 @@ private:
 
   CompareLoadOrdersDialog* compareLoadOrdersDialog{
       new CompareLoadOrdersDialog(this)};
+  DiagnosticsDialog* diagnosticsDialog{new DiagnosticsDialog(this)};
 
   PluginItemModel* pluginItemModel{new PluginItemModel(this)};
   PluginItemFilterModel* proxyModel{new PluginItemFilterModel(this)};
+  ContentSearch* contentSearch{new ContentSearch(this, *proxyModel)};
   CardSizingCache cardSizingCache{pluginCardsView->viewport()};
 
   GroupsEditorDialog* groupsEditor{
@@ -190,6 +197,12 @@ private:
 
   std::string initialQtStyleName;
 
+  uint64_t latestGameDetectionId{0};
+  uint64_t latestGameDataLoadId{0};
+  // Detected games are only applied once no background tasks are waiting or
+  // running, as applying them may recreate games that the tasks are using.
+  std::optional<InstalledGames> pendingInstalledGames;
+
   void setupUi();
   void setupMenuBar();
   void setupToolBar();
@@ -209,9 +222,11 @@ private:
   void enterSortingState();
   void exitSortingState();
 
+  void enterReloadingState();
+  void exitReloadingState();
+
   void loadGame(bool isOnLOOTStartup);
-  void updateCounts(const std::vector<SourcedMessage>& generalMessages,
-                    const std::vector<PluginItem>& plugins);
+  void updateCounts();
   void updateGeneralInformation();
   void updateGeneralMessages();
   void updateSidebarColumnWidths();
@@ -233,25 +248,34 @@ private:
 
   void closeEvent(QCloseEvent* event) override;
 
-  void executeBackgroundQuery(std::unique_ptr<Query> query,
-                              void (MainWindow::*onComplete)(QueryResult),
-                              ProgressUpdater* progressUpdater);
+  void executeBackgroundQuery(
+      std::unique_ptr<Query> query,
+      void (MainWindow::*onComplete)(QueryResult),
+      ProgressUpdater* progressUpdater,
+      const std::string& deduplicationKey = std::string());
 
   void handleError(const std::string& message);
   void handleException(const std::exception& exception);
   void handleQueryException(const Query& query,
                             const std::exception& exception);
 
-  void handleGameDataLoaded(QueryResult result);
+  // The returned future finishes once the loaded plugins have been given to
+  // the model, which happens after their card sizes have been calculated.
+  QFuture<void> handleGameDataLoaded(QueryResult result);
+  QFuture<bool> loadPluginItems(std::vector<PluginItem>&& items);
+  QFuture<bool> reloadMetadata(bool isBeforeSort);
   bool handlePluginsSorted(QueryResult result);
 
   QMenu* createPopupMenu() override;
 
   std::optional<std::filesystem::path> createBackup();
 
+  DiagnosticsReport getDiagnosticsReport() const;
+
   void checkForAmbiguousLoadOrder();
 
   void refreshGamesDropdown();
+  void detectInstalledGames();
 
   void setHiddenMessages(const std::vector<HiddenMessage>& hiddenMessages);
 
@@ -282,6 +306,7 @@ private slots:
   void on_actionOpenFAQs_triggered();
   void on_actionOpenLOOTDataFolder_triggered();
   void on_actionJoinDiscordServer_triggered();
+  void on_actionViewDiagnostics_triggered();
   void on_actionAbout_triggered();
 
   void on_gameComboBox_activated(int index);
@@ -319,6 +344,7 @@ private slots:
 
   void on_searchToolBar_textChanged(const QVariant& text);
   void on_searchToolBar_currentResultChanged(size_t resultIndex);
+  void handleSearchFinished(const std::vector<int>& sourceRows);
 
   void on_backupDialog_accepted();
 
@@ -327,7 +353,8 @@ private slots:
   void handleStartupGameDataLoaded(QueryResult result);
   void handlePluginsManualSorted(QueryResult result);
   void handlePluginsAutoSorted(QueryResult result);
-  void handleMasterlistUpdated(std::vector<QueryResult> results);
+  QFuture<bool> handleMasterlistUpdated(std::vector<QueryResult> results,
+                                        bool isBeforeSort);
   void handleMasterlistsUpdated(std::vector<QueryResult> results);
   void handleOverlapFilterChecked(QueryResult result);
   void handleProgressUpdate(const QString& message);
@@ -339,6 +366,8 @@ private slots:
   void handleLinkColorChanged();
 #if QT_VERSION >= QT_VERSION_CHECK(6, 5, 0)
   void handleColorSchemeChanged();
+
+  void applyPendingInstalledGames();
 #endif
 
   void handleHideMessage(const std::string& pluginName,
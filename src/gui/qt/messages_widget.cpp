@@ -23,18 +23,23 @@
 
 #include "gui/qt/messages_widget.h"
 
+#include <QtCore/QCache>
 #include <QtGui/QTextDocument>
 #include <QtWidgets/QGridLayout>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QStyle>
+#include <mutex>
+#include <optional>
 
 #include "gui/qt/helpers.h"
 #include "gui/qt/icon_factory.h"
 #include "gui/sourced_message.h"
+#include "gui/state/diagnostics.h"
 #include "gui/state/logging.h"
 
 namespace {
 using loot::BareMessage;
+using loot::getSessionDiagnostics;
 using loot::MessageType;
 
 static constexpr int COLUMN_COUNT = 2;
@@ -54,7 +59,7 @@ QString getPropertyValue(MessageType messageType) {
   }
 }
 
-QString getHtmlText(const std::string& markdownText) {
+QString convertMarkdownToHtml(const std::string& markdownText) {
   QTextDocument document;
 
   document.setMarkdown(QString::fromStdString(markdownText),
@@ -73,6 +78,44 @@ QString getHtmlText(const std::string& markdownText) {
   return html;
 }
 
+// Converting Markdown to HTML is relatively slow, and the same message text
+// often appears on many cards, so cache the results. The cache is shared by
+// all MessagesWidgets, and is safe to use from any thread.
+QString getHtmlText(const std::string& markdownText) {
+  static constexpr qsizetype MAX_CACHED_HTML_TEXTS = 4096;
+  static std::mutex cacheMutex;
+  static QCache<QString, QString> cache(MAX_CACHED_HTML_TEXTS);
+
+  const auto key = QString::fromStdString(markdownText);
+
+  std::optional<QString> cachedHtml;
+  {
+    std::lock_guard<std::mutex> guard(cacheMutex);
+    const auto cachedObject = cache.object(key);
+    if (cachedObject != nullptr) {
+      cachedHtml = *cachedObject;
+    }
+  }
+
+  getSessionDiagnostics().recordCacheLookup("message HTML",
+                                            cachedHtml.has_value());
+
+  if (cachedHtml.has_value()) {
+    return cachedHtml.value();
+  }
+
+  // Convert outside the lock so that other threads aren't blocked while
+  // parsing.
+  auto html = convertMarkdownToHtml(markdownText);
+
+  {
+    std::lock_guard<std::mutex> guard(cacheMutex);
+    cache.insert(key, new QString(html));
+  }
+
+  return html;
+}
+
 QLabel* createBulletPointLabel() {
   auto label = new QLabel();
   label->setTextFormat(Qt::TextFormat::PlainText);
@@ -25,6 +25,8 @@
 
 #include <fmt/base.h>
 
+#include <QtGui/QFontMetrics>
+#include <QtWidgets/QGridLayout>
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QStyle>
 #include <QtWidgets/QVBoxLayout>
@@ -50,6 +52,23 @@ QString getTagsText(const std::vector<std::string> tags) {
   return tagsList.join(", ");
 }
 
+QString getLocationsText(const std::vector<Location>& locations) {
+  std::vector<std::string> locationLinks;
+  std::transform(locations.begin(),
+                 locations.end(),
+                 std::back_inserter(locationLinks),
+                 [](const auto& location) {
+                   return "[" + location.GetName() + "](" + location.GetURL() +
+                          ")";
+                 });
+
+  std::string locationsText =
+      locations.size() == 1 ? translate("Source:") : translate("Sources:");
+  locationsText += "  " + boost::join(locationLinks, u8" \uFF5C ");
+
+  return QString::fromStdString(locationsText);
+}
+
 PluginCard::PluginCard(QWidget* parent) : Card(parent, true) { setupUi(); }
 
 void PluginCard::setIcons() {
@@ -119,21 +138,7 @@ void PluginCard::setContent(const PluginItem& plugin, bool hasHiddenMessages) {
 
   const auto showLocations = !plugin.locations.empty();
   if (showLocations) {
-    std::vector<std::string> locationLinks;
-    std::transform(plugin.locations.begin(),
-                   plugin.locations.end(),
-                   std::back_inserter(locationLinks),
-                   [](const auto& location) {
-                     return "[" + location.GetName() + "](" +
-                            location.GetURL() + ")";
-                   });
-
-    std::string locationsText = plugin.locations.size() == 1
-                                    ? translate("Source:")
-                                    : translate("Sources:");
-    locationsText += "  " + boost::join(locationLinks, u8" \uFF5C ");
-
-    locationsLabel->setText(QString::fromStdString(locationsText));
+    locationsLabel->setText(getLocationsText(plugin.locations));
   }
 
   locationsLabel->setVisible(showLocations);
@@ -175,6 +180,63 @@ void PluginCard::setSearchResult(bool isSearchResult,
   }
 }
 
+PluginCardLayoutMetrics PluginCard::getLayoutMetrics() const {
+  ensurePolished();
+  tagsGroupBox->ensurePolished();
+  messagesWidget->ensurePolished();
+
+  PluginCardLayoutMetrics metrics;
+
+  // A QFrame's contents margins include its frame width.
+  metrics.cardMargins = contentsMargins() + layout()->contentsMargins();
+  metrics.cardSpacing = layout()->spacing();
+
+  metrics.nameFont = nameLabel->font();
+  metrics.crcFont = crcLabel->font();
+  metrics.versionFont = versionLabel->font();
+  metrics.headerHeight =
+      std::max({nameLabel->minimumHeight(),
+                ATTRIBUTE_ICON_HEIGHT,
+                QFontMetrics(metrics.nameFont).height(),
+                QFontMetrics(metrics.crcFont).height(),
+                QFontMetrics(metrics.versionFont).height()});
+  metrics.headerSpacing = layout()->itemAt(0)->layout()->spacing();
+  metrics.iconWidth = isActiveLabel->sizeHint().width();
+
+  // Message labels are created on demand, so get their margins the same way
+  // that MessagesWidget does.
+  const auto style = messagesWidget->style();
+  metrics.messageFont = messagesWidget->font();
+  metrics.messageMargins =
+      QMargins(style->pixelMetric(QStyle::PM_LayoutLeftMargin),
+               style->pixelMetric(QStyle::PM_LayoutTopMargin),
+               style->pixelMetric(QStyle::PM_LayoutRightMargin),
+               style->pixelMetric(QStyle::PM_LayoutBottomMargin));
+  metrics.bulletColumnWidth =
+      metrics.messageMargins.left() + metrics.messageMargins.right() +
+      QFontMetrics(metrics.messageFont).horizontalAdvance(QString(u8"\u2022"));
+
+  // A QGroupBox's contents margins include the space taken by its title.
+  const auto tagsLayout = qobject_cast<QGridLayout*>(tagsGroupBox->layout());
+  metrics.tagsFont = currentTagsLabel->font();
+  metrics.tagsMargins =
+      tagsGroupBox->contentsMargins() + tagsLayout->contentsMargins();
+  metrics.tagsHorizontalSpacing = tagsLayout->horizontalSpacing();
+  metrics.tagsVerticalSpacing = tagsLayout->verticalSpacing();
+
+  const auto getHeaderWidth = [](const QLabel* label) {
+    return label->contentsMargins().left() + label->contentsMargins().right() +
+           QFontMetrics(label->font()).horizontalAdvance(label->text());
+  };
+  metrics.currentTagsHeaderWidth = getHeaderWidth(currentTagsHeaderLabel);
+  metrics.addTagsHeaderWidth = getHeaderWidth(addTagsHeaderLabel);
+  metrics.removeTagsHeaderWidth = getHeaderWidth(removeTagsHeaderLabel);
+
+  metrics.locationsFont = locationsLabel->font();
+
+  return metrics;
+}
+
 void PluginCard::setupUi() {
   crcLabel->setObjectName("plugin-crc");
   versionLabel->setObjectName("plugin-version");
@@ -30,12 +30,15 @@
 
 #include "gui/plugin_item.h"
 #include "gui/qt/card.h"
+#include "gui/qt/card_height_calculator.h"
 #include "gui/qt/filters_states.h"
 #include "gui/qt/messages_widget.h"
 
 namespace loot {
 QString getTagsText(const std::vector<std::string> tags);
 
+QString getLocationsText(const std::vector<Location>& locations);
+
 class PluginCard : public Card {
   Q_OBJECT
 public:
@@ -47,6 +50,8 @@ public:
 
   void setSearchResult(bool isSearchResult, bool isCurrentSearchResult);
 
+  PluginCardLayoutMetrics getLayoutMetrics() const;
+
 signals:
   void hideMessage(const std::string& pluginName,
                    const std::string& messageText);
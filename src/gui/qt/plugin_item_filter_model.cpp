@@ -119,24 +119,6 @@ void PluginItemFilterModel::setFiltersState(
 #endif
 }
 
-void PluginItemFilterModel::setSearchResults(QModelIndexList results) {
-  std::set<int> resultRows;
-  for (const auto& result : results) {
-    resultRows.insert(result.row());
-  }
-
-  for (int row = 1; row < rowCount(); row += 1) {
-    const auto index = this->index(row, PluginItemModel::CARDS_COLUMN);
-    const auto isNewResult = resultRows.find(row) != resultRows.end();
-
-    // When setting new search results, there is no initial current result.
-    const SearchResultData newValue(isNewResult, false);
-    setData(index, QVariant::fromValue(newValue), SearchResultRole);
-  }
-}
-
-void PluginItemFilterModel::clearSearchResults() { setSearchResults({}); }
-
 bool PluginItemFilterModel::filterAcceptsRow(
     int sourceRow,
     const QModelIndex& sourceParent) const {
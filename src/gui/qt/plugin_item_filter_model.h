@@ -38,9 +38,6 @@ public:
   void setFiltersState(PluginFiltersState&& state,
                        std::vector<std::string>&& overlappingPluginNames);
 
-  void setSearchResults(QModelIndexList results);
-  void clearSearchResults();
-
 protected:
   bool filterAcceptsRow(int sourceRow,
                         const QModelIndex& sourceParent) const override;
@@ -228,6 +228,11 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
     return QVariant::fromValue(items.at(itemsIndex));
   }
 
+  if (role == ContentRevisionRole) {
+    return QVariant::fromValue(
+        contentRevisions.at(static_cast<size_t>(index.row())));
+  }
+
   // Filtered content can be retrieved for any row and column.
   if (role == FilteredContentRole) {
     if (index.row() == 0) {
@@ -267,8 +272,6 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
 
   if (index.row() == 0) {
     if (index.column() == CARDS_COLUMN && role == CountersRole) {
-      const auto counters =
-          GeneralInformationCounters(generalInformation.generalMessages, items);
       return QVariant::fromValue(counters);
     }
   } else {
@@ -326,7 +329,7 @@ QVariant PluginItemModel::data(const QModelIndex& index, int role) const {
       }
       case CARDS_COLUMN: {
         if (role == ContentSearchRole) {
-          return QString::fromStdString(plugin.getContentToSearch());
+          return searchContents.at(static_cast<qsizetype>(itemsIndex));
         } else if (role == SearchResultRole) {
           const size_t searchResultsIndex =
               static_cast<size_t>(index.row()) - 1;
@@ -468,13 +471,27 @@ bool PluginItemModel::setData(const QModelIndex& index,
 
   if (index.row() == 0) {
     // The zeroth row is a special row for the general information card.
+    removeGeneralMessageCounts();
     generalInformation = value.value<GeneralInformation>();
+    addGeneralMessageCounts();
   } else {
     const size_t itemsIndex = static_cast<size_t>(index.row()) - 1;
+    auto& item = items.at(itemsIndex);
 
-    items.at(itemsIndex) = value.value<PluginItem>();
+    counters.removePlugin(item);
+    counters.hiddenMessages -= countHiddenMessages(item);
+    item = value.value<PluginItem>();
+    searchContents[static_cast<qsizetype>(itemsIndex)] =
+        QString::fromStdString(item.getContentToSearch());
+    counters.addPlugin(item);
+    counters.hiddenMessages += countHiddenMessages(item);
+
+    updateContentRevision(index.row());
   }
 
+  // The general information card displays the counters, so it changes too.
+  updateContentRevision(0);
+
   // The RawDataRole data changed, emit dataChanged for all columns.
   const auto topLeft = index.siblingAtColumn(0);
   const auto bottomRight = index.siblingAtColumn(columnCount() - 1);
@@ -514,11 +531,45 @@ std::unordered_map<std::string, int> PluginItemModel::getPluginNameToRowMap()
   return nameToRowMap;
 }
 
+std::vector<PluginItem> PluginItemModel::getFilteredContent(
+    const std::vector<PluginItem>& pluginItems) const {
+  std::vector<PluginItem> filteredItems;
+  filteredItems.reserve(pluginItems.size());
+
+  for (const auto& item : pluginItems) {
+    filteredItems.push_back(filterContent(item,
+                                          cardContentFiltersState,
+                                          hiddenMessagesByPluginName,
+                                          oldMessagesByPluginName));
+  }
+
+  return filteredItems;
+}
+
+std::vector<bool> PluginItemModel::getHasHiddenMessages(
+    const std::vector<PluginItem>& pluginItems) const {
+  std::vector<bool> hasHiddenMessagesFlags;
+  hasHiddenMessagesFlags.reserve(pluginItems.size());
+
+  for (const auto& item : pluginItems) {
+    hasHiddenMessagesFlags.push_back(
+        hasHiddenMessages(item,
+                          cardContentFiltersState,
+                          hiddenMessagesByPluginName,
+                          oldMessagesByPluginName));
+  }
+
+  return hasHiddenMessagesFlags;
+}
+
 void PluginItemModel::setPluginItems(std::vector<PluginItem>&& newItems) {
   if (!items.empty()) {
     beginRemoveRows(QModelIndex(), 1, static_cast<int>(items.size()));
 
     items.clear();
+    searchContents.clear();
+    contentRevisions.resize(1);
+    resetCounters();
     searchResults.clear();
     currentSearchResultIndex = std::nullopt;
 
@@ -529,10 +580,24 @@ void PluginItemModel::setPluginItems(std::vector<PluginItem>&& newItems) {
     beginInsertRows(QModelIndex(), 1, static_cast<int>(newItems.size()));
 
     std::swap(items, newItems);
+
+    searchContents.reserve(static_cast<qsizetype>(items.size()));
+    for (const auto& item : items) {
+      searchContents.append(QString::fromStdString(item.getContentToSearch()));
+    }
+
+    contentRevisions.resize(items.size() + 1);
+    resetCounters();
     searchResults.resize(items.size(), false);
 
     endInsertRows();
   }
+
+  updateAllContentRevisions();
+}
+
+QStringList PluginItemModel::getSearchContents() const {
+  return searchContents;
 }
 
 void PluginItemModel::setEditorPluginName(
@@ -558,7 +623,12 @@ void PluginItemModel::setGeneralInformation(
   generalInformation.gameSupportsMediumPlugins = gameSupportsMediumPlugins;
   generalInformation.masterlistRevision = masterlistRevision;
   generalInformation.preludeRevision = preludeRevision;
+
+  removeGeneralMessageCounts();
   generalInformation.generalMessages = messages;
+  addGeneralMessageCounts();
+
+  updateContentRevision(0);
 
   emit dataChanged(infoIndex, infoIndex, {RawDataRole});
 }
@@ -568,13 +638,20 @@ void PluginItemModel::setPreludeRevision(
   const auto infoIndex = index(0, CARDS_COLUMN);
   generalInformation.preludeRevision = preludeRevision;
 
+  updateContentRevision(0);
+
   emit dataChanged(infoIndex, infoIndex, {RawDataRole});
 }
 
 void PluginItemModel::setGeneralMessages(
     std::vector<SourcedMessage>&& messages) {
   const auto infoIndex = index(0, CARDS_COLUMN);
+
+  removeGeneralMessageCounts();
   generalInformation.generalMessages = std::move(messages);
+  addGeneralMessageCounts();
+
+  updateContentRevision(0);
 
   emit dataChanged(infoIndex, infoIndex, {RawDataRole});
 }
@@ -587,9 +664,16 @@ const GeneralInformation& PluginItemModel::getGeneralInfo() const {
   return generalInformation;
 }
 
+const GeneralInformationCounters& PluginItemModel::getCounters() const {
+  return counters;
+}
+
 void PluginItemModel::setCardContentFiltersState(
     CardContentFiltersState&& state) {
   cardContentFiltersState = std::move(state);
+  counters.hiddenMessages = countHiddenMessages();
+
+  updateAllContentRevisions();
 
   const auto startIndex = index(0, CARDS_COLUMN);
   const auto endIndex = index(rowCount() - 1, CARDS_COLUMN);
@@ -609,6 +693,10 @@ void PluginItemModel::setHiddenMessages(
     }
   }
 
+  counters.hiddenMessages = countHiddenMessages();
+
+  updateAllContentRevisions();
+
   const auto startIndex = index(0, CARDS_COLUMN);
   const auto endIndex = index(rowCount() - 1, CARDS_COLUMN);
   emit dataChanged(startIndex, endIndex, {FilteredContentRole});
@@ -617,15 +705,22 @@ void PluginItemModel::setHiddenMessages(
 void PluginItemModel::handleHideMessage(const std::string& pluginName,
                                         const std::string& text) {
   if (pluginName.empty()) {
+    counters.hiddenMessages -= countHiddenGeneralMessages();
     hideGeneralMessage(text);
+    counters.hiddenMessages += countHiddenGeneralMessages();
+    updateContentRevision(0);
 
     auto index = this->index(0, CARDS_COLUMN);
     emit dataChanged(index, index, {FilteredContentRole});
   } else {
-    hideMessage(pluginName, text);
-
     for (size_t i = 0; i < items.size(); i += 1) {
       if (items.at(i).name == pluginName) {
+        counters.hiddenMessages -= countHiddenMessages(items.at(i));
+        hideMessage(pluginName, text);
+        counters.hiddenMessages += countHiddenMessages(items.at(i));
+        updateContentRevision(static_cast<int>(i) + 1);
+        updateContentRevision(0);
+
         auto index = this->index(static_cast<int>(i) + 1, CARDS_COLUMN);
         emit dataChanged(index, index, {FilteredContentRole});
         break;
@@ -634,6 +729,45 @@ void PluginItemModel::handleHideMessage(const std::string& pluginName,
   }
 }
 
+void PluginItemModel::setSearchResults(const std::vector<int>& resultRows) {
+  std::vector<bool> newSearchResults(items.size(), false);
+  for (const auto row : resultRows) {
+    // Row 0 is the general information card, which is never a search result.
+    if (row > 0 && static_cast<size_t>(row) <= items.size()) {
+      newSearchResults.at(static_cast<size_t>(row) - 1) = true;
+    }
+  }
+
+  // Only emit one dataChanged signal, covering the range of rows that have
+  // actually changed.
+  std::optional<size_t> firstChanged;
+  std::optional<size_t> lastChanged;
+  for (size_t i = 0; i < newSearchResults.size(); i += 1) {
+    const auto isCurrentResult = currentSearchResultIndex.has_value() &&
+                                 currentSearchResultIndex.value() == i;
+
+    if (newSearchResults.at(i) != searchResults.at(i) || isCurrentResult) {
+      if (!firstChanged.has_value()) {
+        firstChanged = i;
+      }
+      lastChanged = i;
+    }
+  }
+
+  searchResults = std::move(newSearchResults);
+  currentSearchResultIndex = std::nullopt;
+
+  if (firstChanged.has_value() && lastChanged.has_value()) {
+    const auto topLeft =
+        index(static_cast<int>(firstChanged.value()) + 1, CARDS_COLUMN);
+    const auto bottomRight =
+        index(static_cast<int>(lastChanged.value()) + 1, CARDS_COLUMN);
+    emit dataChanged(topLeft, bottomRight, {SearchResultRole});
+  }
+}
+
+void PluginItemModel::clearSearchResults() { setSearchResults({}); }
+
 QModelIndex PluginItemModel::setCurrentSearchResult(size_t resultIndex) {
   size_t currentResultIndex = 0;
   for (size_t i = 0; i < searchResults.size(); i += 1) {
@@ -695,43 +829,80 @@ void PluginItemModel::setOldMessages(
     }
   }
 
+  counters.hiddenMessages = countHiddenMessages();
+
+  updateAllContentRevisions();
+
   const auto startIndex = index(0, CARDS_COLUMN);
   const auto endIndex = index(rowCount() - 1, CARDS_COLUMN);
   emit dataChanged(startIndex, endIndex, {FilteredContentRole});
 }
 
-size_t PluginItemModel::countHiddenMessages() {
-  size_t hidden = 0;
+size_t PluginItemModel::countHiddenGeneralMessages() const {
+  return std::count_if(generalInformation.generalMessages.begin(),
+                       generalInformation.generalMessages.end(),
+                       [&](const SourcedMessage& message) {
+                         return shouldFilterMessage(message,
+                                                    cardContentFiltersState,
+                                                    hiddenGeneralMessages,
+                                                    oldGeneralMessages);
+                       });
+}
 
-  hidden += std::count_if(generalInformation.generalMessages.begin(),
-                          generalInformation.generalMessages.end(),
-                          [&](const SourcedMessage& message) {
-                            return shouldFilterMessage(message,
-                                                       cardContentFiltersState,
-                                                       hiddenGeneralMessages,
-                                                       oldGeneralMessages);
-                          });
+size_t PluginItemModel::countHiddenMessages(const PluginItem& plugin) const {
+  if (cardContentFiltersState.hideAllPluginMessages) {
+    return plugin.messages.size();
+  }
 
-  for (const auto& plugin : items) {
-    if (cardContentFiltersState.hideAllPluginMessages) {
-      hidden += plugin.messages.size();
-      continue;
-    }
+  return std::count_if(plugin.messages.begin(),
+                       plugin.messages.end(),
+                       [&](const SourcedMessage& message) {
+                         return shouldFilterMessage(plugin.name,
+                                                    message,
+                                                    cardContentFiltersState,
+                                                    hiddenMessagesByPluginName,
+                                                    oldMessagesByPluginName);
+                       });
+}
 
-    hidden +=
-        std::count_if(plugin.messages.begin(),
-                      plugin.messages.end(),
-                      [&](const SourcedMessage& message) {
-                        return shouldFilterMessage(plugin.name,
-                                                   message,
-                                                   cardContentFiltersState,
-                                                   hiddenMessagesByPluginName,
-                                                   oldMessagesByPluginName);
-                      });
+size_t PluginItemModel::countHiddenMessages() const {
+  size_t hidden = countHiddenGeneralMessages();
+
+  for (const auto& plugin : items) {
+    hidden += countHiddenMessages(plugin);
   }
 
   return hidden;
 }
+
+void PluginItemModel::resetCounters() {
+  counters =
+      GeneralInformationCounters(generalInformation.generalMessages, items);
+  counters.hiddenMessages = countHiddenMessages();
+}
+
+void PluginItemModel::addGeneralMessageCounts() {
+  counters.addMessages(generalInformation.generalMessages);
+  counters.hiddenMessages += countHiddenGeneralMessages();
+}
+
+void PluginItemModel::removeGeneralMessageCounts() {
+  counters.removeMessages(generalInformation.generalMessages);
+  counters.hiddenMessages -= countHiddenGeneralMessages();
+}
+
+void PluginItemModel::updateContentRevision(int row) {
+  latestContentRevision += 1;
+  contentRevisions.at(static_cast<size_t>(row)) = latestContentRevision;
+}
+
+void PluginItemModel::updateAllContentRevisions() {
+  for (auto& revision : contentRevisions) {
+    latestContentRevision += 1;
+    revision = latestContentRevision;
+  }
+}
+
 void PluginItemModel::hideGeneralMessage(const std::string& text) {
   hiddenGeneralMessages.insert(text);
 }
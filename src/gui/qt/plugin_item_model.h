@@ -45,6 +45,9 @@ static constexpr int DragRole = Qt::UserRole + 7;
 static constexpr int SearchResultRole = Qt::UserRole + 8;
 static constexpr int FilteredContentRole = Qt::UserRole + 9;
 static constexpr int HasHiddenMessagesRole = Qt::UserRole + 10;
+// A number that changes whenever anything displayed on a row's card may have
+// changed, apart from its search result state. Numbers are never reused.
+static constexpr int ContentRevisionRole = Qt::UserRole + 11;
 
 struct SearchResultData {
   SearchResultData() = default;
@@ -94,6 +97,21 @@ public:
 
   void setPluginItems(std::vector<PluginItem>&& items);
 
+  // Get the content to search for each plugin item, in the same order as the
+  // items. The list is implicitly shared, so it's cheap to copy and can be
+  // read from another thread.
+  QStringList getSearchContents() const;
+
+  // Get the given plugin items as they would be displayed with the model's
+  // current card content filters and hidden messages.
+  std::vector<PluginItem> getFilteredContent(
+      const std::vector<PluginItem>& pluginItems) const;
+
+  // Get whether each of the given plugin items would have messages hidden
+  // with the model's current card content filters and hidden messages.
+  std::vector<bool> getHasHiddenMessages(
+      const std::vector<PluginItem>& pluginItems) const;
+
   void setEditorPluginName(const std::optional<std::string>& editorPluginName);
 
   void setGeneralInformation(bool gameSupportsLightPlugins,
@@ -110,6 +128,9 @@ public:
 
   const GeneralInformation& getGeneralInfo() const;
 
+  // The counters are kept up to date as the model's raw data changes.
+  const GeneralInformationCounters& getCounters() const;
+
   void setCardContentFiltersState(CardContentFiltersState&& state);
 
   void setHiddenMessages(const std::vector<HiddenMessage>& hiddenMessages);
@@ -117,17 +138,26 @@ public:
   void handleHideMessage(const std::string& pluginName,
                          const std::string& text);
 
+  // Replaces all search results in one batch. The given rows are the model
+  // rows of the search results, and there is no current result afterwards.
+  void setSearchResults(const std::vector<int>& resultRows);
+
+  void clearSearchResults();
+
   QModelIndex setCurrentSearchResult(size_t resultIndex);
 
   std::vector<HiddenMessage> getCurrentMessages() const;
 
   void setOldMessages(const std::vector<HiddenMessage>& oldMessages);
 
-  size_t countHiddenMessages();
-
 private:
   GeneralInformation generalInformation;
   std::vector<PluginItem> items;
+  QStringList searchContents;
+  // Indexed by row, so the first revision is the general information card's.
+  std::vector<uint64_t> contentRevisions{0};
+  uint64_t latestContentRevision{0};
+  GeneralInformationCounters counters;
   std::vector<bool> searchResults;
   std::optional<size_t> currentSearchResultIndex;
 
@@ -141,8 +171,19 @@ private:
       oldMessagesByPluginName;
   std::unordered_set<std::string> oldGeneralMessages;
 
+  void updateContentRevision(int row);
+  void updateAllContentRevisions();
+
   void hideGeneralMessage(const std::string& text);
   void hideMessage(const std::string& pluginName, const std::string& text);
+
+  size_t countHiddenGeneralMessages() const;
+  size_t countHiddenMessages(const PluginItem& plugin) const;
+  size_t countHiddenMessages() const;
+
+  void resetCounters();
+  void addGeneralMessageCounts();
+  void removeGeneralMessageCounts();
 };
 }
 
@@ -33,6 +33,7 @@
 #include <QtWidgets/QVBoxLayout>
 
 #include "gui/qt/helpers.h"
+#include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
 
 namespace loot {
@@ -68,6 +69,12 @@ void RestoreLoadOrderDialog::setLoadOrderBackups(
     timestampItem->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
     backupsTable->setItem(row, 1, timestampItem);
 
+    const auto pluginCount = static_cast<qulonglong>(backup.pluginCount);
+    auto pluginCountItem =
+        new QTableWidgetItem(QLocale::system().toString(pluginCount));
+    pluginCountItem->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
+    backupsTable->setItem(row, 2, pluginCountItem);
+
     row += 1;
   }
 
@@ -95,7 +102,7 @@ RestoreLoadOrderDialog::getSelectedLoadOrderBackup() const {
 void RestoreLoadOrderDialog::setupUi() {
   setSizeGripEnabled(true);
 
-  backupsTable->setColumnCount(2);
+  backupsTable->setColumnCount(3);
   backupsTable->setShowGrid(false);
   backupsTable->setSelectionMode(QAbstractItemView::SingleSelection);
   backupsTable->setSelectionBehavior(QAbstractItemView::SelectRows);
@@ -166,7 +173,7 @@ void RestoreLoadOrderDialog::translateUi() {
   selectedLoadOrderLabel->setText(qTranslate("Selected backup's load order"));
 
   backupsTable->setHorizontalHeaderLabels(
-      {qTranslate("Name"), qTranslate("Created At")});
+      {qTranslate("Name"), qTranslate("Created At"), qTranslate("Plugins")});
 
   deleteButton->setText(qTranslate("Delete Backup"));
 
@@ -181,8 +188,24 @@ void RestoreLoadOrderDialog::handleBackupSelectionChanged(
 
   const auto indexes = selected.indexes();
   if (!indexes.empty()) {
+    // Backups' load orders are only read when they're selected.
     const auto& backup = backups.at(static_cast<size_t>(indexes.front().row()));
-    for (const auto& plugin : backup.loadOrder) {
+    std::vector<std::string> backupLoadOrder;
+    try {
+      backupLoadOrder = readLoadOrderBackup(backup);
+    } catch (const std::exception& e) {
+      const auto logger = getLogger();
+      if (logger) {
+        logger->error("Failed to read the selected load order backup: {}",
+                      e.what());
+      }
+
+      QMessageBox::critical(this,
+                            qTranslate("Error"),
+                            qTranslate("Failed to read the selected backup."));
+    }
+
+    for (const auto& plugin : backupLoadOrder) {
       backupLoadOrderList->addItem(QString::fromStdString(plugin));
     }
 
@@ -192,7 +215,7 @@ void RestoreLoadOrderDialog::handleBackupSelectionChanged(
           currentLoadOrderList->item(i)->text().toStdString());
     }
 
-    identicalLabel->setHidden(backup.loadOrder != currentLoadOrder);
+    identicalLabel->setHidden(backupLoadOrder != currentLoadOrder);
     deleteButton->setEnabled(true);
   }
 }
@@ -206,7 +229,7 @@ void RestoreLoadOrderDialog::handleDeleteButtonClicked() {
 
     const auto row = selected.front()->row();
 
-    std::filesystem::remove(backups.at(static_cast<size_t>(row)).path);
+    deleteLoadOrderBackup(backups.at(static_cast<size_t>(row)));
 
     backups.erase(backups.begin() + row);
 
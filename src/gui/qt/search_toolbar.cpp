@@ -70,6 +70,23 @@ void SearchToolBar::setSearchResults(size_t resultsCount) {
   }
 }
 
+void SearchToolBar::setSearching(bool isSearching) {
+  searchInProgress = isSearching;
+
+  if (searchInProgress) {
+    countLabel->setText(qTranslate("Searching…"));
+
+    previousButton->setDisabled(true);
+    nextButton->setDisabled(true);
+  } else {
+    updateCountLabel();
+
+    const auto disableButtons = state.resultsCount < 2;
+    previousButton->setDisabled(disableButtons);
+    nextButton->setDisabled(disableButtons);
+  }
+}
+
 void SearchToolBar::setIcons() {
   regexButton->setIcon(IconFactory::getRegexIcon());
   previousButton->setIcon(IconFactory::getPreviousSearchResultIcon());
@@ -137,6 +154,10 @@ void SearchToolBar::translateUi() {
 }
 
 void SearchToolBar::updateCountLabel() {
+  if (searchInProgress) {
+    return;
+  }
+
   int index = -1;
   if (state.currentResultIndex.has_value()) {
     index = static_cast<int>(state.currentResultIndex.value());
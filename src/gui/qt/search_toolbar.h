@@ -45,6 +45,7 @@ public:
 
   void reset();
   void setSearchResults(size_t resultsCount);
+  void setSearching(bool isSearching);
 
   void setIcons();
 
@@ -60,6 +61,7 @@ private:
   QToolButton* nextButton{new QToolButton(this)};
 
   SearchState state;
+  bool searchInProgress{false};
 
   void setupUi();
   void translateUi();
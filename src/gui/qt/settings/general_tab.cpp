@@ -109,6 +109,7 @@ void GeneralTab::initialiseInputs(const LootSettings& settings,
       settings.isMasterlistUpdateBeforeSortEnabled());
   checkUpdatesCheckbox->setChecked(settings.isLootUpdateCheckEnabled());
   loggingCheckbox->setChecked(settings.isDebugLoggingEnabled());
+  tracingCheckbox->setChecked(settings.isTracingEnabled());
   useNoSortingChangesDialogCheckbox->setChecked(
       settings.isNoSortingChangesDialogEnabled());
   warnOnCaseSensitiveGamePathsCheckbox->setChecked(
@@ -127,6 +128,7 @@ void GeneralTab::recordInputValues(LootSettings& settings) {
       updateMasterlistCheckbox->isChecked();
   const auto checkForUpdates = checkUpdatesCheckbox->isChecked();
   const auto enableDebugLogging = loggingCheckbox->isChecked();
+  const auto enableTracing = tracingCheckbox->isChecked();
   const auto enableNoSortingChangesDialog =
       useNoSortingChangesDialogCheckbox->isChecked();
   const auto enableWarnOnCaseSensitiveGamePaths =
@@ -139,6 +141,7 @@ void GeneralTab::recordInputValues(LootSettings& settings) {
   settings.enableMasterlistUpdateBeforeSort(enableMasterlistUpdateBeforeSort);
   settings.enableLootUpdateCheck(checkForUpdates);
   settings.enableDebugLogging(enableDebugLogging);
+  settings.enableTracing(enableTracing);
   settings.enableNoSortingChangesDialog(enableNoSortingChangesDialog);
   settings.enableWarnOnCaseSensitiveGamePaths(
       enableWarnOnCaseSensitiveGamePaths);
@@ -170,6 +173,7 @@ void GeneralTab::setupUi() {
   generalLayout->addRow(updateMasterlistLabel, updateMasterlistCheckbox);
   generalLayout->addRow(checkUpdatesLabel, checkUpdatesCheckbox);
   generalLayout->addRow(loggingLabel, loggingCheckbox);
+  generalLayout->addRow(tracingLabel, tracingCheckbox);
   generalLayout->addRow(useNoSortingChangesDialogLabel,
                         useNoSortingChangesDialogCheckbox);
   generalLayout->addRow(warnOnCaseSensitiveGamePathsLabel,
@@ -189,6 +193,7 @@ void GeneralTab::translateUi() {
       qTranslate("Update masterlist before sorting"));
   checkUpdatesLabel->setText(qTranslate("Check for LOOT updates on startup"));
   loggingLabel->setText(qTranslate("Enable debug logging"));
+  tracingLabel->setText(qTranslate("Enable performance tracing"));
   preludeSourceLabel->setText(qTranslate("Masterlist prelude source"));
   useNoSortingChangesDialogLabel->setText(
       qTranslate("Display dialog when sorting makes no changes"));
@@ -197,6 +202,9 @@ void GeneralTab::translateUi() {
 
   loggingLabel->setToolTip(
       qTranslate("The output is logged to the LOOTDebugLog.txt file."));
+  tracingLabel->setToolTip(
+      qTranslate("Timings are recorded in the LOOTTrace.json file, which "
+                 "can be opened in a trace viewer such as Perfetto."));
 
   preludeSourceInput->setToolTip(qTranslate("A prelude source is required."));
 
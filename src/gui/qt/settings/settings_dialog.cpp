@@ -115,8 +115,8 @@ void SettingsDialog::recordInputValues(LootState& state) {
     gameSettings.push_back(gameTab->getGameSettings());
   }
 
-  gameSettings = state.loadInstalledGames(gameSettings);
-
+  // Installed games are detected separately once the settings have been
+  // recorded, as detection can take a while.
   state.getSettings().storeGameSettings(gameSettings);
 }
 
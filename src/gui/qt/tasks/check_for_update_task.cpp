@@ -100,12 +100,6 @@ std::optional<QDate> getDateFromCommitJson(const QJsonDocument& document,
 namespace loot {
 void CheckForUpdateTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
-    }
-
     // Reset the tag commit date in case this task is being run twice somehow.
     tagCommitDate = std::nullopt;
 
@@ -123,7 +117,7 @@ void CheckForUpdateTask::sendHttpRequest(
   request.setTransferTimeout(TRANSFER_TIMEOUT_MS);
   request.setRawHeader("Accept", "application/vnd.github.v3+json");
 
-  const auto reply = networkAccessManager->get(request);
+  const auto reply = getNetworkAccessManager().get(request);
 
   connect(reply, &QNetworkReply::finished, this, onFinished);
   connect(reply,
@@ -24,7 +24,8 @@
 #ifndef LOOT_GUI_QT_TASKS_CHECK_FOR_UPDATE_TASK
 #define LOOT_GUI_QT_TASKS_CHECK_FOR_UPDATE_TASK
 
-#include <QtNetwork/QNetworkAccessManager>
+#include <QtCore/QDate>
+#include <optional>
 
 #include "gui/qt/tasks/network_task.h"
 
@@ -35,7 +36,6 @@ public slots:
   void execute() override;
 
 private:
-  QNetworkAccessManager* networkAccessManager{nullptr};
   std::optional<QDate> tagCommitDate;
 
   void sendHttpRequest(const std::string& url,
@@ -23,8 +23,70 @@
 
 #include "gui/qt/tasks/network_task.h"
 
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QCoreApplication>
+#include <algorithm>
+#include <cctype>
+#include <deque>
+#include <memory>
+
+#include "gui/qt/helpers.h"
 #include "gui/translate.h"
 
+namespace {
+using loot::DownloadedFileWriter;
+using loot::Task;
+
+// The state of a download that's being written to disk. Writes are chained
+// so that they happen in the order the data was received, but each runs on a
+// worker thread.
+struct FileDownload {
+  std::unique_ptr<DownloadedFileWriter> writer;
+  QFuture<void> pendingWrites;
+};
+
+// Runs the function on a worker thread once all earlier writes have
+// finished.
+template <typename Function>
+void chainWrite(const std::shared_ptr<FileDownload>& download,
+                Function function) {
+  download->pendingWrites =
+      download->pendingWrites.then(QtFuture::Launch::Async, function);
+}
+
+struct NetworkTaskQueue {
+  std::deque<Task*> pendingTasks;
+  size_t runningTaskCount{0};
+  size_t maxConcurrentTasks{1};
+};
+
+void startPendingNetworkTasks(const std::shared_ptr<NetworkTaskQueue>& queue) {
+  while (queue->runningTaskCount < queue->maxConcurrentTasks &&
+         !queue->pendingTasks.empty()) {
+    const auto task = queue->pendingTasks.front();
+    queue->pendingTasks.pop_front();
+    queue->runningTaskCount += 1;
+
+    // A task may signal an error more than once, e.g. for a network error and
+    // then for the resulting unsuccessful response, but should only free up
+    // its slot once.
+    const auto onDone = [queue, isDone = std::make_shared<bool>(false)]() {
+      if (*isDone) {
+        return;
+      }
+      *isDone = true;
+
+      queue->runningTaskCount -= 1;
+      startPendingNetworkTasks(queue);
+    };
+    QObject::connect(task, &Task::finished, task, onDone);
+    QObject::connect(task, &Task::error, task, onDone);
+
+    task->execute();
+  }
+}
+}
+
 namespace loot {
 void NetworkTask::handleException(const std::exception& exception) {
   const auto logger = getLogger();
@@ -40,19 +102,140 @@ void NetworkTask::handleException(const std::exception& exception) {
   emit this->error(message);
 }
 
-void NetworkTask::onNetworkError(QNetworkReply::NetworkError networkError) {
-  try {
-    const auto reply = qobject_cast<QIODevice*>(sender());
-    const auto errorString = reply->errorString().toStdString();
+void NetworkTask::handleNetworkError(QNetworkReply::NetworkError networkError,
+                                     const std::string& errorString) {
+  const auto logger = getLogger();
+  if (logger) {
+    logger->error("Network error code {}, description is: {}",
+                  static_cast<int>(networkError),
+                  errorString);
+  }
 
-    const auto logger = getLogger();
+  emit error(errorString);
+}
+
+void NetworkTask::updateFileFromSource(
+    const std::string& source,
+    const std::filesystem::path& filePath,
+    const std::string& description,
+    const std::function<QueryResult(bool)>& getResult) {
+  if (!isValidUrl(source)) {
+    // Treat the source as a local path, and copy the file from there.
+    const auto sourcePath = std::filesystem::u8path(source);
+
+    QtConcurrent::run(
+        [sourcePath, filePath]() { return updateFile(sourcePath, filePath); })
+        .then(this,
+              [this, getResult](bool fileUpdated) {
+                emit finished(getResult(fileUpdated));
+              })
+        .onFailed(this,
+                  [this](const std::exception& e) { handleException(e); });
+    return;
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->trace(
+        "Sending a {} update request to GET {}", description, source);
+  }
+
+  QNetworkRequest request(QUrl(QString::fromStdString(source)));
+  request.setTransferTimeout(TRANSFER_TIMEOUT_MS);
+
+  const auto validators = getHttpValidators(filePath, request.url());
+  if (logger && !validators.isEmpty()) {
+    logger->trace(
+        "Making the {} update request conditional on ETag \"{}\" and "
+        "Last-Modified \"{}\"",
+        description,
+        validators.etag,
+        validators.lastModified);
+  }
+  setConditionalRequestHeaders(request, validators);
+
+  // Qt negotiates gzip and deflate content encodings and decompresses the
+  // response as it's received, so the body is written to disk in chunks
+  // instead of being held in memory.
+  const auto download = std::make_shared<FileDownload>();
+  download->pendingWrites = QtConcurrent::run([download, filePath]() {
+    download->writer = std::make_unique<DownloadedFileWriter>(filePath);
+  });
+
+  const auto reply = getNetworkAccessManager().get(request);
+
+  connect(reply, &QNetworkReply::readyRead, this, [reply, download]() {
+    chainWrite(download, [download, data = reply->readAll()]() {
+      download->writer->write(data);
+    });
+  });
+
+  connect(reply, &QNetworkReply::finished, this, [=]() {
     if (logger) {
-      logger->error("Network error code {}, description is: {}",
-                    static_cast<int>(networkError),
-                    errorString);
+      logger->trace("Finished receiving a response for {} update",
+                    description);
     }
 
-    emit error(errorString);
+    reply->deleteLater();
+
+    // The continuations below run after the reply has been deleted, so
+    // take everything they need from it now.
+    const auto responseValidators = getHttpValidators(*reply);
+    const auto isNotModified = isNotModifiedResponse(*reply);
+    const auto networkError = reply->error();
+    const auto errorString = reply->errorString().toStdString();
+    const auto isSuccessful =
+        networkError == QNetworkReply::NoError && hasSuccessfulStatus(*reply);
+    const auto data = isSuccessful ? reply->readAll() : QByteArray();
+
+    download->pendingWrites
+        .then(QtFuture::Launch::Async,
+              [=]() {
+                auto writer = std::move(download->writer);
+
+                if (isNotModified) {
+                  // The file hasn't changed since it was last fetched, so
+                  // there's no need to read or hash it.
+                  writer.reset();
+                  updateFileRevisionDate(filePath, responseValidators);
+                  return false;
+                }
+
+                // Discard the written data if the response is unsuccessful,
+                // so that the file is left as it was before the error is
+                // reported.
+                if (!isSuccessful) {
+                  return false;
+                }
+
+                writer->write(data);
+
+                return writer->commit(responseValidators);
+              })
+        .then(this,
+              [=](bool fileUpdated) {
+                if (isNotModified || isSuccessful) {
+                  emit finished(getResult(fileUpdated));
+                } else if (networkError != QNetworkReply::NoError) {
+                  handleNetworkError(networkError, errorString);
+                } else {
+                  auto message = description + " update response errored";
+                  message[0] = static_cast<char>(std::toupper(message[0]));
+                  emit error(message);
+                }
+              })
+        .onFailed(this, [this](const std::exception& e) {
+          handleException(e);
+        });
+  });
+
+  connect(reply, &QNetworkReply::sslErrors, this, &NetworkTask::onSSLError);
+}
+
+void NetworkTask::onNetworkError(QNetworkReply::NetworkError networkError) {
+  try {
+    const auto reply = qobject_cast<QIODevice*>(sender());
+    handleNetworkError(networkError, reply->errorString().toStdString());
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -81,4 +264,29 @@ void NetworkTask::onSSLError(const QList<QSslError>& errors) {
     handleException(e);
   }
 }
+
+QNetworkAccessManager& getNetworkAccessManager() {
+  // The manager is parented to the application so that it's destroyed before
+  // the application is.
+  static const auto manager =
+      new QNetworkAccessManager(QCoreApplication::instance());
+
+  return *manager;
+}
+
+void executeNetworkTasks(const std::vector<Task*>& tasks,
+                         size_t maxConcurrentTasks) {
+  const auto queue = std::make_shared<NetworkTaskQueue>();
+  queue->pendingTasks.assign(tasks.begin(), tasks.end());
+  queue->maxConcurrentTasks = std::max(maxConcurrentTasks, size_t{1});
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->debug("Running {} network tasks, up to {} at a time",
+                  tasks.size(),
+                  queue->maxConcurrentTasks);
+  }
+
+  startPendingNetworkTasks(queue);
+}
 }
@@ -24,22 +24,48 @@
 #ifndef LOOT_GUI_QT_TASKS_NETWORK_TASK
 #define LOOT_GUI_QT_TASKS_NETWORK_TASK
 
+#include <QtNetwork/QNetworkAccessManager>
 #include <QtNetwork/QNetworkReply>
+#include <filesystem>
+#include <functional>
 
 #include "gui/qt/tasks/tasks.h"
 
 namespace loot {
+// Network tasks only wait on I/O, so they run in the main thread and share
+// its network access manager, which reuses connections to the same host.
 class NetworkTask : public Task {
   Q_OBJECT
 protected:
   static constexpr int TRANSFER_TIMEOUT_MS{30000};
 
   void handleException(const std::exception& exception);
+  void handleNetworkError(QNetworkReply::NetworkError networkError,
+                          const std::string& errorString);
+
+  // Updates the file at the given path from the given source, which is either
+  // a URL or a local path, then emits finished() with the result that
+  // getResult gives for whether the file changed. Requests are made from this
+  // task's thread, but the file is read, written and hashed on worker
+  // threads. The description is used in log and error messages.
+  void updateFileFromSource(const std::string& source,
+                            const std::filesystem::path& filePath,
+                            const std::string& description,
+                            const std::function<QueryResult(bool)>& getResult);
 
 protected slots:
   void onNetworkError(QNetworkReply::NetworkError error);
   void onSSLError(const QList<QSslError>& errors);
 };
+
+// Gets the application's network access manager. It must only be used from
+// the main thread.
+QNetworkAccessManager& getNetworkAccessManager();
+
+// Executes the given network tasks in the current thread, with no more than
+// maxConcurrentTasks running at once. The tasks are not owned.
+void executeNetworkTasks(const std::vector<Task*>& tasks,
+                         size_t maxConcurrentTasks);
 }
 
 #endif
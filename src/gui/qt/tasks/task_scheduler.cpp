@@ -0,0 +1,291 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#include "gui/qt/tasks/task_scheduler.h"
+
+#include <QtCore/QCoreApplication>
+#include <algorithm>
+
+#include "gui/state/logging.h"
+#include "gui/state/tracing.h"
+
+namespace {
+using loot::TaskPriority;
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+size_t getLane(TaskPriority priority) { return static_cast<size_t>(priority); }
+}
+
+namespace loot {
+const char* TaskScheduler::getLaneName(size_t lane) {
+  switch (static_cast<TaskPriority>(lane)) {
+    case TaskPriority::interactive:
+      return "interactive";
+    case TaskPriority::background:
+      return "background";
+    case TaskPriority::speculative:
+      return "speculative";
+    default:
+      return "unknown";
+  }
+}
+
+TaskScheduler& TaskScheduler::instance() {
+  static constexpr int MIN_THREAD_COUNT = 2;
+  static constexpr int MAX_THREAD_COUNT = 8;
+
+  // Parent the scheduler to the application so that its threads are stopped
+  // before the application is destroyed.
+  static TaskScheduler* scheduler = new TaskScheduler(
+      QCoreApplication::instance(),
+      std::clamp(
+          QThread::idealThreadCount(), MIN_THREAD_COUNT, MAX_THREAD_COUNT));
+
+  return *scheduler;
+}
+
+TaskScheduler::TaskScheduler(QObject* parent, int threadCount) :
+    QObject(parent) {
+  const auto count = static_cast<size_t>(std::max(1, threadCount));
+
+  for (size_t i = 0; i < count; i += 1) {
+    auto thread = new QThread();
+    thread->setObjectName(QString("LOOT task worker %1").arg(i));
+    thread->start();
+
+    threads.push_back(thread);
+  }
+
+  runningTaskIds.resize(count);
+  runningTaskKeys.resize(count);
+}
+
+TaskScheduler::~TaskScheduler() {
+  for (auto thread : threads) {
+    thread->quit();
+    thread->wait();
+    delete thread;
+  }
+
+  // Tasks that never started won't emit the signals that would delete them.
+  for (auto& queue : lanes) {
+    for (const auto& pendingTask : queue) {
+      if (pendingTask.isOwned) {
+        delete pendingTask.task;
+      }
+    }
+  }
+}
+
+QFuture<QueryResult> TaskScheduler::execute(Task* task, TaskPriority priority) {
+  auto future = taskFuture(task);
+
+  enqueue(PendingTask{task, std::string(), steady_clock::now()}, priority);
+
+  return future;
+}
+
+QFuture<QueryResult> TaskScheduler::execute(
+    std::unique_ptr<Query> query,
+    TaskPriority priority,
+    const std::string& deduplicationKey) {
+  if (!deduplicationKey.empty()) {
+    const auto it = keyedTaskFutures.find(deduplicationKey);
+    if (it != keyedTaskFutures.end()) {
+      laneStats.at(getLane(priority)).deduplicatedCount += 1;
+
+      const auto logger = getLogger();
+      if (logger) {
+        logger->debug(
+            "Discarding task with key \"{}\" as an identical task is "
+            "already waiting to start or running",
+            deduplicationKey);
+      }
+
+      return it->second;
+    }
+  }
+
+  auto task = new QueryTask(std::move(query));
+
+  // The scheduler owns the task, so delete it once it's done.
+  connect(task, &Task::finished, task, &QObject::deleteLater);
+  connect(task, &Task::error, task, &QObject::deleteLater);
+
+  auto future = taskFuture(task);
+
+  if (!deduplicationKey.empty()) {
+    keyedTaskFutures.emplace(deduplicationKey, future);
+  }
+
+  enqueue(PendingTask{task, deduplicationKey, steady_clock::now(), true},
+          priority);
+
+  return future;
+}
+
+size_t TaskScheduler::getThreadCount() const { return threads.size(); }
+
+size_t TaskScheduler::getRunningTaskCount() const {
+  return static_cast<size_t>(
+      std::count_if(runningTaskIds.begin(),
+                    runningTaskIds.end(),
+                    [](const auto& taskId) { return taskId.has_value(); }));
+}
+
+std::array<TaskLaneStats, TaskScheduler::LANE_COUNT>
+TaskScheduler::getLaneStats() const {
+  auto stats = laneStats;
+  for (size_t lane = 0; lane < LANE_COUNT; lane += 1) {
+    stats.at(lane).queueDepth = lanes.at(lane).size();
+  }
+
+  return stats;
+}
+
+bool TaskScheduler::isIdle() const {
+  return getRunningTaskCount() == 0 &&
+         std::all_of(lanes.begin(), lanes.end(), [](const auto& queue) {
+           return queue.empty();
+         });
+}
+
+void TaskScheduler::enqueue(PendingTask&& pendingTask, TaskPriority priority) {
+  lanes.at(getLane(priority)).push_back(std::move(pendingTask));
+
+  startPendingTasks();
+}
+
+void TaskScheduler::startPendingTasks() {
+  for (size_t lane = 0; lane < LANE_COUNT; lane += 1) {
+    auto& queue = lanes.at(lane);
+
+    while (!queue.empty()) {
+      const auto idleThreadIt =
+          std::find(runningTaskIds.begin(), runningTaskIds.end(), std::nullopt);
+      if (idleThreadIt == runningTaskIds.end()) {
+        return;
+      }
+
+      // Don't let speculative work take the last idle thread, so that there's
+      // always one available for more important work.
+      const auto runningTaskCount = getRunningTaskCount();
+      if (lane == getLane(TaskPriority::speculative) && runningTaskCount > 0 &&
+          runningTaskCount + 1 >= threads.size()) {
+        return;
+      }
+
+      const auto pendingTask = std::move(queue.front());
+      queue.pop_front();
+
+      const auto threadIndex = static_cast<size_t>(
+          std::distance(runningTaskIds.begin(), idleThreadIt));
+
+      start(pendingTask, lane, threadIndex);
+    }
+  }
+}
+
+void TaskScheduler::start(const PendingTask& pendingTask,
+                          size_t lane,
+                          size_t threadIndex) {
+  const auto waitTime =
+      duration_cast<milliseconds>(steady_clock::now() - pendingTask.queuedAt);
+
+  auto& stats = laneStats.at(lane);
+  stats.startedCount += 1;
+  stats.totalWaitTime += waitTime;
+  stats.maxWaitTime = std::max(stats.maxWaitTime, waitTime);
+
+  const auto taskId = nextTaskId;
+  nextTaskId += 1;
+  runningTaskIds.at(threadIndex) = taskId;
+  runningTaskKeys.at(threadIndex) = pendingTask.deduplicationKey;
+
+  // Tasks signal when they're done instead of returning, as they may do
+  // asynchronous work using their thread's event loop.
+  const auto onDone = [this, threadIndex, taskId]() {
+    onTaskDone(threadIndex, taskId);
+  };
+  connect(pendingTask.task, &Task::finished, this, onDone);
+  connect(pendingTask.task, &Task::error, this, onDone);
+
+  if (isTracingEnabled()) {
+    // Record the task's span on its worker thread, which is where the task
+    // emits its signals from.
+    const auto recordSpan = [lane, startedAt = steady_clock::now()]() {
+      recordTraceEvent(
+          "task", getLaneName(lane), startedAt, steady_clock::now());
+    };
+    connect(pendingTask.task,
+            &Task::finished,
+            pendingTask.task,
+            recordSpan,
+            Qt::DirectConnection);
+    connect(pendingTask.task,
+            &Task::error,
+            pendingTask.task,
+            recordSpan,
+            Qt::DirectConnection);
+  }
+
+  pendingTask.task->moveToThread(threads.at(threadIndex));
+
+  QMetaObject::invokeMethod(pendingTask.task, "execute", Qt::QueuedConnection);
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->debug(
+        "Started {} task on worker thread {} after waiting {} ms, {} tasks "
+        "are still waiting in that lane",
+        getLaneName(lane),
+        threadIndex,
+        waitTime.count(),
+        lanes.at(lane).size());
+  }
+}
+
+void TaskScheduler::onTaskDone(size_t threadIndex, uint64_t taskId) {
+  // Ignore repeated signals from a task that has already finished.
+  if (runningTaskIds.at(threadIndex) != taskId) {
+    return;
+  }
+
+  runningTaskIds.at(threadIndex) = std::nullopt;
+
+  auto& taskKey = runningTaskKeys.at(threadIndex);
+  if (!taskKey.empty()) {
+    keyedTaskFutures.erase(taskKey);
+    taskKey.clear();
+  }
+
+  startPendingTasks();
+
+  if (isIdle()) {
+    emit idle();
+  }
+}
+}
@@ -0,0 +1,129 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_GUI_QT_TASKS_TASK_SCHEDULER
+#define LOOT_GUI_QT_TASKS_TASK_SCHEDULER
+
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+
+#include "gui/qt/tasks/tasks.h"
+
+namespace loot {
+struct TaskLaneStats {
+  // The number of tasks waiting to start.
+  size_t queueDepth{0};
+
+  // The number of tasks that have been started, and how long they waited to
+  // start in total and at most.
+  size_t startedCount{0};
+  std::chrono::milliseconds totalWaitTime{0};
+  std::chrono::milliseconds maxWaitTime{0};
+
+  // The number of tasks that were discarded because an identical task was
+  // already waiting to start or running.
+  size_t deduplicatedCount{0};
+};
+
+/**
+ * Runs tasks on a fixed pool of worker threads, each of which runs an event
+ * loop and executes at most one task at a time. Waiting tasks are started in
+ * priority order, and speculative tasks are only started if doing so leaves a
+ * thread free for more important work.
+ *
+ * The scheduler must only be used from the thread that it was created in.
+ */
+class TaskScheduler : public QObject {
+  Q_OBJECT
+public:
+  static constexpr size_t LANE_COUNT = 3;
+
+  // The scheduler that all the application's background work shares.
+  static TaskScheduler& instance();
+
+  // Lanes are indexed by TaskPriority.
+  static const char* getLaneName(size_t lane);
+
+  TaskScheduler(QObject* parent, int threadCount);
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler(TaskScheduler&&) = delete;
+  ~TaskScheduler() override;
+
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+  // The task is not owned by the scheduler.
+  QFuture<QueryResult> execute(Task* task, TaskPriority priority);
+
+  // If deduplicationKey is not empty and a query with the same key is already
+  // waiting to start or running, the given query is discarded and the future
+  // of the existing query is returned.
+  // The scheduler owns the task that it creates for the query.
+  QFuture<QueryResult> execute(std::unique_ptr<Query> query,
+                               TaskPriority priority,
+                               const std::string& deduplicationKey);
+
+  size_t getThreadCount() const;
+  size_t getRunningTaskCount() const;
+  std::array<TaskLaneStats, LANE_COUNT> getLaneStats() const;
+
+  // Returns true if no tasks are waiting to start or running.
+  bool isIdle() const;
+
+signals:
+  // Emitted when the last waiting or running task is done.
+  void idle();
+
+private:
+  struct PendingTask {
+    Task* task{nullptr};
+    std::string deduplicationKey;
+    std::chrono::steady_clock::time_point queuedAt;
+    bool isOwned{false};
+  };
+
+  std::vector<QThread*> threads;
+  // The ID of the task that each thread is running, if any.
+  std::vector<std::optional<uint64_t>> runningTaskIds;
+  // The deduplication key of the task that each thread is running, if any.
+  std::vector<std::string> runningTaskKeys;
+  // The futures of waiting and running tasks that have deduplication keys.
+  std::unordered_map<std::string, QFuture<QueryResult>> keyedTaskFutures;
+  uint64_t nextTaskId{0};
+  std::array<std::deque<PendingTask>, LANE_COUNT> lanes;
+  std::array<TaskLaneStats, LANE_COUNT> laneStats;
+
+  void enqueue(PendingTask&& pendingTask, TaskPriority priority);
+  void startPendingTasks();
+  void start(const PendingTask& pendingTask, size_t lane, size_t threadIndex);
+  void onTaskDone(size_t threadIndex, uint64_t taskId);
+};
+}
+
+#endif
@@ -23,7 +23,24 @@
 
 #include "gui/qt/tasks/tasks.h"
 
-#include <QtConcurrent/QtConcurrent>
+#include <boost/algorithm/string/erase.hpp>
+#include <boost/core/demangle.hpp>
+#include <typeinfo>
+
+#include "gui/qt/tasks/task_scheduler.h"
+#include "gui/state/tracing.h"
+
+namespace {
+std::string getQueryName(const loot::Query& query) {
+  auto name = boost::core::demangle(typeid(query).name());
+
+  // MSVC prefixes class names with "class ".
+  boost::erase_first(name, "class ");
+  boost::erase_first(name, "loot::");
+
+  return name;
+}
+}
 
 namespace loot {
 QueryTask::QueryTask(std::unique_ptr<Query> query) : query(std::move(query)) {}
@@ -35,7 +52,15 @@ void QueryTask::execute() {
           "Attempted to execute a query with no query set!");
     }
 
-    emit finished(query->executeLogic());
+    std::optional<TraceSpan> span;
+    if (isTracingEnabled()) {
+      span.emplace("query", getQueryName(*query));
+    }
+
+    auto result = query->executeLogic();
+    span.reset();
+
+    emit finished(result);
   } catch (const std::exception& e) {
     auto logger = getLogger();
     if (logger) {
@@ -50,32 +75,6 @@ void QueryTask::execute() {
   }
 }
 
-QFuture<QueryResult> executeBackgroundQuery(std::unique_ptr<Query> query) {
-  const auto sharedQuery = std::shared_ptr<Query>(std::move(query));
-
-  return QtConcurrent::run([sharedQuery]() {
-    if (sharedQuery == nullptr) {
-      throw std::runtime_error(
-          "Attempted to execute a query with no query set!");
-    }
-
-    try {
-      return sharedQuery->executeLogic();
-    } catch (const std::exception& e) {
-      const auto logger = getLogger();
-      if (logger) {
-        logger->error("Exception while executing query: {}", e.what());
-      }
-
-      const auto errorMessage = sharedQuery == nullptr
-                                    ? std::string(e.what())
-                                    : sharedQuery->getErrorMessage();
-
-      throw std::runtime_error(errorMessage.c_str());
-    }
-  });
-}
-
 QFuture<QueryResult> taskFuture(Task* task) {
   QFuture<QueryResult> taskFinishedFuture =
       QtFuture::connect(task, &Task::finished);
@@ -103,40 +102,15 @@ QFuture<QList<QFuture<QueryResult>>> whenAllTasks(
   return QtFuture::whenAll(futures.begin(), futures.end());
 }
 
-void executeConcurrentBackgroundTasks(const std::vector<Task*>& tasks,
-                                      QFuture<void> whenAll) {
-  QThread* workerThread = new QThread();
-
-  QObject::connect(
-      workerThread, &QThread::finished, workerThread, &QObject::deleteLater);
-
-  whenAll.then(workerThread, [workerThread]() { workerThread->quit(); });
-
-  workerThread->start();
-
-  for (auto task : tasks) {
-    task->moveToThread(workerThread);
-
-    QMetaObject::invokeMethod(task, "execute", Qt::QueuedConnection);
-  }
+QFuture<QueryResult> executeBackgroundQuery(
+    std::unique_ptr<Query> query,
+    TaskPriority priority,
+    const std::string& deduplicationKey) {
+  return TaskScheduler::instance().execute(
+      std::move(query), priority, deduplicationKey);
 }
 
-QFuture<QueryResult> executeBackgroundTask(Task* task) {
-  QThread* workerThread = new QThread();
-
-  QObject::connect(
-      workerThread, &QThread::finished, workerThread, &QObject::deleteLater);
-
-  workerThread->start();
-
-  task->moveToThread(workerThread);
-
-  QMetaObject::invokeMethod(task, "execute", Qt::QueuedConnection);
-
-  return taskFuture(task).then(workerThread,
-                               [workerThread](QueryResult result) {
-                                 workerThread->quit();
-                                 return result;
-                               });
+QFuture<QueryResult> executeBackgroundTask(Task* task, TaskPriority priority) {
+  return TaskScheduler::instance().execute(task, priority);
 }
 }
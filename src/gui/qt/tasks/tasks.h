@@ -61,17 +61,34 @@ private:
   std::unique_ptr<Query> query;
 };
 
-QFuture<QueryResult> executeBackgroundQuery(std::unique_ptr<Query> query);
+enum struct TaskPriority : size_t {
+  // Work that the user is waiting for.
+  interactive,
+  // Work that the user isn't waiting for.
+  background,
+  // Work that might turn out not to be needed.
+  speculative,
+};
 
 QFuture<QueryResult> taskFuture(Task* task);
 
 QFuture<QList<QFuture<QueryResult>>> whenAllTasks(
     const std::vector<Task*>& tasks);
 
-void executeConcurrentBackgroundTasks(const std::vector<Task*>& tasks,
-                                      QFuture<void> whenAll);
+// The functions below run their work using the application's shared
+// TaskScheduler.
+
+// If deduplicationKey is not empty and a query with the same key is already
+// waiting to start or running, the given query is discarded and the future of
+// the existing query is returned.
+QFuture<QueryResult> executeBackgroundQuery(
+    std::unique_ptr<Query> query,
+    TaskPriority priority = TaskPriority::interactive,
+    const std::string& deduplicationKey = std::string());
 
-QFuture<QueryResult> executeBackgroundTask(Task* task);
+QFuture<QueryResult> executeBackgroundTask(
+    Task* task,
+    TaskPriority priority = TaskPriority::interactive);
 }
 
 #endif
@@ -23,8 +23,6 @@
 
 #include "gui/qt/tasks/update_masterlist_task.h"
 
-#include "gui/qt/helpers.h"
-
 namespace loot {
 UpdatePreludeTask::UpdatePreludeTask(const LootState& state) :
     preludeSource(state.getSettings().getPreludeSource()),
@@ -32,68 +30,10 @@ UpdatePreludeTask::UpdatePreludeTask(const LootState& state) :
 
 void UpdatePreludeTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
-    }
-
-    if (!isValidUrl(preludeSource)) {
-      // Treat the source as a local path, and copy the file from there.
-      auto sourcePath = std::filesystem::u8path(preludeSource);
-
-      const auto preludeUpdated = updateFile(sourcePath, preludePath);
-
-      emit finished(preludeUpdated);
-      return;
-    }
-
-    auto logger = getLogger();
-    if (logger) {
-      logger->trace("Sending a prelude update request to GET {}",
-                    preludeSource);
-    }
-
-    QNetworkRequest request(QUrl(QString::fromStdString(preludeSource)));
-    request.setTransferTimeout(TRANSFER_TIMEOUT_MS);
-
-    const auto reply = networkAccessManager->get(request);
-
-    connect(reply,
-            &QNetworkReply::finished,
-            this,
-            &UpdatePreludeTask::onReplyFinished);
-
-    connect(reply,
-            &QNetworkReply::errorOccurred,
-            this,
-            &UpdatePreludeTask::onNetworkError);
-    connect(
-        reply, &QNetworkReply::sslErrors, this, &UpdatePreludeTask::onSSLError);
-  } catch (const std::exception& e) {
-    handleException(e);
-  }
-}
-
-void UpdatePreludeTask::onReplyFinished() {
-  try {
-    auto logger = getLogger();
-    if (logger) {
-      logger->trace("Finished receiving a response for prelude update");
-    }
-
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply*>(sender()));
-
-    if (!responseData.has_value()) {
-      emit error("Prelude update response errored");
-      return;
-    }
-
-    const auto preludeUpdated =
-        updateFileWithData(preludePath, responseData.value());
-
-    emit finished(preludeUpdated);
+    updateFileFromSource(preludeSource,
+                         preludePath,
+                         "prelude",
+                         [](bool preludeUpdated) { return preludeUpdated; });
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -114,70 +54,14 @@ UpdateMasterlistTask::UpdateMasterlistTask(
 
 void UpdateMasterlistTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
-    }
-
-    if (!isValidUrl(masterlistSource)) {
-      // Treat the source as a local path, and copy the file from there.
-      const auto sourcePath = std::filesystem::u8path(masterlistSource);
-
-      const auto masterlistUpdated = updateFile(sourcePath, masterlistPath);
-
-      emit finished(std::make_pair(gameFolderName, masterlistUpdated));
-      return;
-    }
-
-    auto logger = getLogger();
-    if (logger) {
-      logger->trace("Sending a masterlist update request to GET {}",
-                    masterlistSource);
-    }
-
-    QNetworkRequest request(QUrl(QString::fromStdString(masterlistSource)));
-    request.setTransferTimeout(TRANSFER_TIMEOUT_MS);
-
-    const auto reply = networkAccessManager->get(request);
-
-    connect(reply,
-            &QNetworkReply::finished,
-            this,
-            &UpdateMasterlistTask::onReplyFinished);
-
-    connect(reply,
-            &QNetworkReply::errorOccurred,
-            this,
-            &UpdateMasterlistTask::onNetworkError);
-    connect(reply,
-            &QNetworkReply::sslErrors,
-            this,
-            &UpdateMasterlistTask::onSSLError);
-  } catch (const std::exception& e) {
-    handleException(e);
-  }
-}
-
-void UpdateMasterlistTask::onReplyFinished() {
-  try {
-    auto logger = getLogger();
-    if (logger) {
-      logger->trace("Finished receiving a response for masterlist update");
-    }
-
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply*>(sender()));
-
-    if (!responseData.has_value()) {
-      emit error("Masterlist update response errored");
-      return;
-    }
-
-    const auto masterlistUpdated =
-        updateFileWithData(masterlistPath, responseData.value());
-
-    emit finished(std::make_pair(gameFolderName, masterlistUpdated));
+    updateFileFromSource(masterlistSource,
+                         masterlistPath,
+                         "masterlist",
+                         [gameFolderName = gameFolderName](
+                             bool masterlistUpdated) -> QueryResult {
+                           return std::make_pair(gameFolderName,
+                                                 masterlistUpdated);
+                         });
   } catch (const std::exception& e) {
     handleException(e);
   }
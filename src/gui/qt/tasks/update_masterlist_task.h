@@ -24,7 +24,8 @@
 #ifndef LOOT_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK
 #define LOOT_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK
 
-#include <QtNetwork/QNetworkAccessManager>
+#include <filesystem>
+#include <string>
 
 #include "gui/qt/tasks/network_task.h"
 
@@ -40,11 +41,6 @@ public slots:
 private:
   std::string preludeSource;
   std::filesystem::path preludePath;
-
-  QNetworkAccessManager* networkAccessManager{nullptr};
-
-private slots:
-  void onReplyFinished();
 };
 
 class UpdateMasterlistTask : public NetworkTask {
@@ -62,11 +58,6 @@ private:
   std::string gameFolderName;
   std::string masterlistSource;
   std::filesystem::path masterlistPath;
-
-  QNetworkAccessManager* networkAccessManager{nullptr};
-
-private slots:
-  void onReplyFinished();
 };
 }
 
@@ -42,7 +42,7 @@ public:
     }
 
     counter_->decrement();
-    game_->getSortCount().decrement();
+    game_->decrementSortCount();
 
     const std::function<std::pair<std::string, std::optional<short>>(
         std::shared_ptr<const PluginInterface>, std::optional<short>, bool)>
@@ -25,6 +25,7 @@
 #define LOOT_GUI_QUERY_CHANGE_GAME_QUERY
 
 #include "gui/query/types/get_game_data_query.h"
+#include "gui/state/game/game_snapshot.h"
 
 namespace loot {
 class ChangeGameQuery : public Query {
@@ -40,9 +41,40 @@ public:
 
   QueryResult executeLogic() override {
     gamesManager_->setCurrentGame(gameFolder_);
-    gamesManager_->getCurrentGame().init();
 
-    GetGameDataQuery subQuery(gamesManager_->getCurrentGame(),
+    auto& game = gamesManager_->getCurrentGame();
+    if (game.isInitialised() && !game.getPlugins().empty()) {
+      // The game's data is still loaded from when it was last the current
+      // game, so only reload what has changed since then.
+      sendProgressUpdate_(translate("Checking for changes…"));
+
+      const auto changes = game.reloadChangedData();
+
+      // The snapshot's messages are in the language that was current when it
+      // was published, so it can only be reused if that hasn't changed.
+      if (game.getSnapshotLanguage() == language_) {
+        if (!changes.hasChanges()) {
+          return game.getSnapshot()->pluginItems;
+        }
+
+        if (changes.onlyPluginsModified()) {
+          game.publishSnapshotUpdate(
+              getPluginItems(changes.modifiedPlugins, game, language_));
+
+          return game.getSnapshot()->pluginItems;
+        }
+      }
+
+      const auto pluginItems =
+          getPluginItems(game.getLoadOrder(), game, language_);
+      game.publishSnapshot(pluginItems, language_);
+
+      return pluginItems;
+    }
+
+    game.init();
+
+    GetGameDataQuery subQuery(game,
                               std::move(language_),
                               std::move(sendProgressUpdate_));
 
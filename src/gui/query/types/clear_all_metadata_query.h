@@ -73,7 +73,11 @@ private:
 
   std::vector<PluginItem> getDerivedMetadata(
       const std::vector<std::string>& userlistPlugins) const {
-    return getPluginItems(userlistPlugins, *game_, language_);
+    auto pluginItems = getPluginItems(userlistPlugins, *game_, language_);
+
+    game_->publishSnapshotUpdate(pluginItems);
+
+    return pluginItems;
   }
 };
 }
@@ -46,13 +46,17 @@ public:
 
     auto plugin = game_->getPlugin(pluginName_);
     if (plugin) {
-      return PluginItem(
+      auto pluginItem = PluginItem(
           game_->getSettings().getId(),
           *plugin,
           *game_,
           game_->getActiveLoadOrderIndex(*plugin, game_->getLoadOrder()),
           game_->isPluginActive(plugin->GetName()),
           language_);
+
+      game_->publishSnapshotUpdate({pluginItem});
+
+      return pluginItem;
     }
 
     return std::monostate();
@@ -25,7 +25,9 @@
 #define LOOT_GUI_QUERY_GET_GAME_DATA_QUERY
 
 #include "gui/query/query.h"
+#include "gui/state/diagnostics.h"
 #include "gui/state/game/game.h"
+#include "gui/state/stage_graph.h"
 #include "gui/translate.h"
 #include "loot/loot_version.h"
 
@@ -46,58 +48,51 @@ public:
        the game data, so also load the metadata lists. */
     bool isFirstLoad = game_->getPlugins().empty();
 
-    std::mutex exceptionMutex;
-    std::exception_ptr exceptionPointer;
-    std::vector<std::thread> threads;
-
-    threads.push_back(std::thread([&]() {
-      try {
-        game_->loadAllInstalledPlugins(true);
-      } catch (...) {
-        std::lock_guard<std::mutex> lock(exceptionMutex);
-        if (exceptionPointer == nullptr) {
-          exceptionPointer = std::current_exception();
-        }
-      }
-    }));
+    StageGraph stages({"game init"});
+
+    stages.addStage("plugin headers", {}, [this]() {
+      game_->loadAllInstalledPlugins(true);
+    });
+
+    stages.addStage("creation club", {}, [this]() {
+      game_->getCreationClubPlugins().load(game_->getSettings().getId(),
+                                           game_->getSettings().getGamePath());
+    });
+
+    std::vector<std::string> deriveItemsDependencies{"plugin headers",
+                                                     "creation club"};
 
     if (isFirstLoad) {
-      threads.push_back(std::thread([&]() {
-        try {
-          game_->loadMetadata();
-        } catch (...) {
-          std::lock_guard<std::mutex> lock(exceptionMutex);
-          if (exceptionPointer == nullptr) {
-            exceptionPointer = std::current_exception();
-          }
-        }
-      }));
+      // No groups can have been removed from a masterlist that hasn't been
+      // loaded before, so there's nothing for loadMetadata() to recover.
+      stages.addStage(
+          "masterlist parse", {}, [this]() { game_->loadMasterlist(); });
+
+      // The userlist is loaded into the same database as the masterlist, so
+      // wait for the masterlist to finish loading.
+      stages.addStage("userlist", {"masterlist parse"}, [this]() {
+        game_->loadUserlist();
+        game_->checkForRecoveredGroups();
+      });
+
+      deriveItemsDependencies.push_back("userlist");
     }
 
-    threads.push_back(std::thread([&]() {
-      try {
-        game_->getCreationClubPlugins().load(
-            game_->getSettings().getId(), game_->getSettings().getGamePath());
-      } catch (...) {
-        std::lock_guard<std::mutex> lock(exceptionMutex);
-        if (exceptionPointer == nullptr) {
-          exceptionPointer = std::current_exception();
-        }
-      }
-    }));
-
-    for (auto& thread : threads) {
-      if (thread.joinable()) {
-        thread.join();
-      }
-    }
+    std::vector<PluginItem> pluginItems;
+    stages.addStage("derive items", deriveItemsDependencies, [&]() {
+      // Sort plugins into their load order.
+      pluginItems = getPluginItems(game_->getLoadOrder(), *game_, language_);
 
-    if (exceptionPointer != nullptr) {
-      std::rethrow_exception(exceptionPointer);
-    }
+      game_->publishSnapshot(pluginItems, language_);
+    });
+
+    const auto startTime = std::chrono::steady_clock::now();
+    getStartupStageTimings().record(stages.run());
+    getSessionDiagnostics().recordLoadDuration(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime));
 
-    // Sort plugins into their load order.
-    return getPluginItems(game_->getLoadOrder(), *game_, language_);
+    return pluginItems;
   }
 
 private:
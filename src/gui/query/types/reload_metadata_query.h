@@ -0,0 +1,58 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_GUI_QUERY_RELOAD_METADATA_QUERY
+#define LOOT_GUI_QUERY_RELOAD_METADATA_QUERY
+
+#include "gui/query/query.h"
+#include "gui/state/game/game.h"
+
+namespace loot {
+class ReloadMetadataQuery : public Query {
+public:
+  ReloadMetadataQuery(gui::Game& game, std::string&& language) :
+      game_(&game), language_(std::move(language)) {}
+
+  QueryResult executeLogic() override {
+    auto logger = getLogger();
+    if (logger) {
+      logger->debug("Reloading metadata lists.");
+    }
+
+    game_->loadMetadata();
+
+    auto pluginItems = getPluginItems(game_->getLoadOrder(), *game_, language_);
+
+    game_->publishSnapshot(pluginItems, language_);
+
+    return pluginItems;
+  }
+
+private:
+  gui::Game* game_;
+  std::string language_;
+};
+}
+
+#endif
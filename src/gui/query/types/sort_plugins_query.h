@@ -26,6 +26,7 @@
 
 #include "gui/query/query.h"
 #include "gui/state/change_count.h"
+#include "gui/state/diagnostics.h"
 #include "gui/state/game/game.h"
 #include "gui/translate.h"
 
@@ -49,14 +50,20 @@ public:
 
     // Sort plugins into their load order.
     sendProgressUpdate_(translate("Sorting load order…"));
+    const auto startTime = std::chrono::steady_clock::now();
     std::vector<std::string> plugins = game_->sortPlugins();
+    getSessionDiagnostics().recordSortDuration(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - startTime));
 
     auto result = getResult(plugins);
 
     // plugins will be empty if there was a sorting error.
     if (!plugins.empty()) {
-      game_->getSortCount().increment();
+      game_->incrementSortCount();
       unappliedChangeCount_->increment();
+
+      game_->publishSnapshot(result, language_);
     }
 
     if (logger) {
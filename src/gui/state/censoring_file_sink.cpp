@@ -0,0 +1,244 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/censoring_file_sink.h"
+
+#include <spdlog/pattern_formatter.h>
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+static constexpr std::chrono::milliseconds LOG_FLUSH_INTERVAL(500);
+}
+
+namespace loot {
+StringCensor::StringCensor(
+    const std::vector<std::pair<std::string, std::string>>& replacements) {
+  for (const auto& replacement : replacements) {
+    if (!replacement.first.empty()) {
+      replacements_.push_back(replacement);
+    }
+  }
+
+  std::stable_sort(replacements_.begin(),
+                   replacements_.end(),
+                   [](const auto& lhs, const auto& rhs) {
+                     return lhs.first.size() > rhs.first.size();
+                   });
+
+  for (size_t i = 0; i < replacements_.size(); i += 1) {
+    const auto firstByte =
+        static_cast<unsigned char>(replacements_[i].first.front());
+    candidatesByFirstByte_[firstByte].push_back(i);
+  }
+}
+
+std::optional<std::string> StringCensor::censor(std::string_view text) const {
+  std::optional<std::string> censored;
+  size_t copiedUpTo = 0;
+
+  for (size_t i = 0; i < text.size();) {
+    const auto& candidates =
+        candidatesByFirstByte_[static_cast<unsigned char>(text[i])];
+
+    const auto match =
+        std::find_if(candidates.begin(), candidates.end(), [&](size_t index) {
+          return text.substr(i, replacements_[index].first.size()) ==
+                 replacements_[index].first;
+        });
+
+    if (match == candidates.end()) {
+      i += 1;
+      continue;
+    }
+
+    if (!censored.has_value()) {
+      censored = std::string();
+      censored->reserve(text.size());
+    }
+
+    const auto& [search, replacement] = replacements_[*match];
+    censored->append(text.substr(copiedUpTo, i - copiedUpTo));
+    censored->append(replacement);
+
+    i += search.size();
+    copiedUpTo = i;
+  }
+
+  if (censored.has_value()) {
+    censored->append(text.substr(copiedUpTo));
+  }
+
+  return censored;
+}
+
+CensoringFileSink::CensoringFileSink(
+    const spdlog::filename_t& filename,
+    const std::vector<std::pair<std::string, std::string>>& stringsToCensor,
+    size_t bufferCapacity) :
+    censor_(stringsToCensor),
+    formatter_(std::make_unique<spdlog::pattern_formatter>()),
+    buffer_(std::max(bufferCapacity, size_t{1})) {
+  file_.open(filename);
+  writer_ = std::thread([this]() { runWriter(); });
+}
+
+CensoringFileSink::~CensoringFileSink() {
+  {
+    std::lock_guard<std::mutex> guard(bufferMutex_);
+    stopping_ = true;
+  }
+  bufferCondition_.notify_one();
+  writer_.join();
+
+  try {
+    writeBufferedMessages(true);
+  } catch (...) {
+    // Destructors must not throw, and there's nowhere left to log to.
+  }
+}
+
+void CensoringFileSink::log(const spdlog::details::log_msg& msg) {
+  if (!should_log(msg.level)) {
+    // Skip potentially expensive string search / replacement.
+    return;
+  }
+
+  spdlog::memory_buf_t formatted;
+  const auto censored =
+      censor_.censor(std::string_view(msg.payload.data(), msg.payload.size()));
+  {
+    std::lock_guard<std::mutex> guard(formatterMutex_);
+    if (censored.has_value()) {
+      auto msgCopy = msg;
+      msgCopy.payload = censored.value();
+      formatter_->format(msgCopy, formatted);
+    } else {
+      formatter_->format(msg, formatted);
+    }
+  }
+
+  if (msg.level >= spdlog::level::err) {
+    writeBufferedMessages(true, &formatted);
+    return;
+  }
+
+  while (!tryBuffer(formatted)) {
+    // The writer thread has fallen behind, write the buffer here rather
+    // than dropping the message.
+    writeBufferedMessages(false);
+  }
+}
+
+void CensoringFileSink::flush() { writeBufferedMessages(true); }
+
+void CensoringFileSink::set_pattern(const std::string& pattern) {
+  set_formatter(std::make_unique<spdlog::pattern_formatter>(pattern));
+}
+
+void CensoringFileSink::set_formatter(
+    std::unique_ptr<spdlog::formatter> sink_formatter) {
+  std::lock_guard<std::mutex> guard(formatterMutex_);
+  formatter_ = std::move(sink_formatter);
+}
+
+size_t CensoringFileSink::getHighWatermark() const {
+  return std::max(buffer_.size() / 2, size_t{1});
+}
+
+bool CensoringFileSink::tryBuffer(const spdlog::memory_buf_t& formatted) {
+  bool shouldWakeWriter = false;
+  {
+    std::lock_guard<std::mutex> guard(bufferMutex_);
+    if (bufferCount_ == buffer_.size()) {
+      return false;
+    }
+
+    // Reuse the slot's existing allocation.
+    auto& slot = buffer_[(bufferStart_ + bufferCount_) % buffer_.size()];
+    slot.assign(formatted.data(), formatted.size());
+    bufferCount_ += 1;
+
+    shouldWakeWriter = bufferCount_ == getHighWatermark();
+  }
+
+  if (shouldWakeWriter) {
+    bufferCondition_.notify_one();
+  }
+
+  return true;
+}
+
+void CensoringFileSink::writeBufferedMessages(
+    bool flush,
+    const spdlog::memory_buf_t* message) {
+  std::lock_guard<std::mutex> fileGuard(fileMutex_);
+
+  batch_.clear();
+  {
+    std::lock_guard<std::mutex> bufferGuard(bufferMutex_);
+    for (size_t i = 0; i < bufferCount_; i += 1) {
+      const auto& slot = buffer_[(bufferStart_ + i) % buffer_.size()];
+      batch_.append(slot.data(), slot.data() + slot.size());
+    }
+    bufferStart_ = (bufferStart_ + bufferCount_) % buffer_.size();
+    bufferCount_ = 0;
+  }
+
+  if (message != nullptr) {
+    batch_.append(message->data(), message->data() + message->size());
+  }
+
+  if (batch_.size() > 0) {
+    file_.write(batch_);
+  }
+
+  if (flush) {
+    file_.flush();
+  }
+}
+
+void CensoringFileSink::runWriter() {
+  while (true) {
+    bool stopping = false;
+    {
+      std::unique_lock<std::mutex> lock(bufferMutex_);
+      bufferCondition_.wait_for(lock, LOG_FLUSH_INTERVAL, [this]() {
+        return stopping_ || bufferCount_ >= getHighWatermark();
+      });
+      stopping = stopping_;
+    }
+
+    if (stopping) {
+      return;
+    }
+
+    try {
+      writeBufferedMessages(true);
+    } catch (...) {
+      // There's nowhere to report a failure to write the log.
+    }
+  }
+}
+}
@@ -0,0 +1,116 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_CENSORING_FILE_SINK
+#define LOOT_GUI_STATE_CENSORING_FILE_SINK
+
+#include <spdlog/details/file_helper.h>
+#include <spdlog/sinks/sink.h>
+
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace loot {
+// Replaces all the given strings in a single pass over the input. Each
+// position is only compared against the strings that start with the byte at
+// that position, and longer strings are preferred over shorter ones.
+class StringCensor {
+public:
+  explicit StringCensor(
+      const std::vector<std::pair<std::string, std::string>>& replacements);
+
+  // Returns nullopt if the text does not contain any of the strings to
+  // censor, to avoid copying it unnecessarily.
+  std::optional<std::string> censor(std::string_view text) const;
+
+private:
+  std::vector<std::pair<std::string, std::string>> replacements_;
+  std::array<std::vector<size_t>, 256> candidatesByFirstByte_;
+};
+
+// A file sink that censors messages and buffers them in a ring buffer, which
+// a background thread writes to the log file in batches. Messages at error
+// level or above are written and flushed immediately, along with everything
+// buffered before them, so they aren't lost if LOOT then crashes.
+class CensoringFileSink : public spdlog::sinks::sink {
+public:
+  // The number of formatted messages that can be buffered by default before
+  // they must be written to the log file.
+  static constexpr size_t DEFAULT_BUFFER_CAPACITY = 1024;
+
+  CensoringFileSink(
+      const spdlog::filename_t& filename,
+      const std::vector<std::pair<std::string, std::string>>& stringsToCensor,
+      size_t bufferCapacity = DEFAULT_BUFFER_CAPACITY);
+
+  ~CensoringFileSink() override;
+
+  void log(const spdlog::details::log_msg& msg) override;
+  void flush() override;
+  void set_pattern(const std::string& pattern) override;
+  void set_formatter(
+      std::unique_ptr<spdlog::formatter> sink_formatter) override;
+
+private:
+  StringCensor censor_;
+
+  std::mutex formatterMutex_;
+  std::unique_ptr<spdlog::formatter> formatter_;
+
+  // Guards the ring buffer and stopping_.
+  std::mutex bufferMutex_;
+  std::condition_variable bufferCondition_;
+  std::vector<std::string> buffer_;
+  size_t bufferStart_{0};
+  size_t bufferCount_{0};
+  bool stopping_{false};
+
+  // Guards file_ and batch_. Always locked before bufferMutex_ if both are
+  // needed, so that batches are written in the order they were buffered.
+  std::mutex fileMutex_;
+  spdlog::details::file_helper file_;
+  spdlog::memory_buf_t batch_;
+
+  std::thread writer_;
+
+  // The writer thread is woken early once the buffer is this full.
+  size_t getHighWatermark() const;
+
+  bool tryBuffer(const spdlog::memory_buf_t& formatted);
+
+  void writeBufferedMessages(bool flush,
+                             const spdlog::memory_buf_t* message = nullptr);
+
+  void runWriter();
+};
+}
+
+#endif
@@ -0,0 +1,133 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/diagnostics.h"
+
+#ifdef _WIN32
+#ifndef UNICODE
+#define UNICODE
+#endif
+#ifndef _UNICODE
+#define _UNICODE
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+// psapi.h must be included after windows.h.
+#include <psapi.h>
+#else
+#include <unistd.h>
+
+#include <fstream>
+#endif
+
+namespace loot {
+std::optional<double> CacheStats::getHitRate() const {
+  const auto lookups = hits + misses;
+  if (lookups == 0) {
+    return std::nullopt;
+  }
+
+  return static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+void SessionDiagnostics::recordLoadDuration(
+    std::chrono::milliseconds duration) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  lastLoadDuration_ = duration;
+}
+
+void SessionDiagnostics::recordSortDuration(
+    std::chrono::milliseconds duration) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  lastSortDuration_ = duration;
+}
+
+void SessionDiagnostics::recordCacheLookup(const std::string& cacheName,
+                                           bool isHit) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  auto& stats = cacheStats_[cacheName];
+  if (isHit) {
+    stats.hits += 1;
+  } else {
+    stats.misses += 1;
+  }
+}
+
+std::optional<std::chrono::milliseconds>
+SessionDiagnostics::getLastLoadDuration() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  return lastLoadDuration_;
+}
+
+std::optional<std::chrono::milliseconds>
+SessionDiagnostics::getLastSortDuration() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  return lastSortDuration_;
+}
+
+std::map<std::string, CacheStats> SessionDiagnostics::getCacheStats() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  return cacheStats_;
+}
+
+SessionDiagnostics& getSessionDiagnostics() {
+  static SessionDiagnostics diagnostics;
+  return diagnostics;
+}
+
+std::optional<uint64_t> getResidentMemoryBytes() {
+#ifdef _WIN32
+  // Use the kernel32 export so that there's no need to link to psapi.
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!K32GetProcessMemoryInfo(
+          GetCurrentProcess(), &counters, sizeof(counters))) {
+    return std::nullopt;
+  }
+
+  return counters.WorkingSetSize;
+#else
+  // The second field is the number of resident pages.
+  std::ifstream in("/proc/self/statm");
+  uint64_t totalPages = 0;
+  uint64_t residentPages = 0;
+  if (!(in >> totalPages >> residentPages)) {
+    return std::nullopt;
+  }
+
+  const auto pageSize = sysconf(_SC_PAGESIZE);
+  if (pageSize <= 0) {
+    return std::nullopt;
+  }
+
+  return residentPages * static_cast<uint64_t>(pageSize);
+#endif
+}
+}
@@ -0,0 +1,68 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_DIAGNOSTICS
+#define LOOT_GUI_STATE_DIAGNOSTICS
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace loot {
+struct CacheStats {
+  size_t hits{0};
+  size_t misses{0};
+
+  // Returns nullopt if the cache has not been used.
+  std::optional<double> getHitRate() const;
+};
+
+// Collects performance statistics about the current session so that they can
+// be displayed to the user. All member functions are thread-safe.
+class SessionDiagnostics {
+public:
+  void recordLoadDuration(std::chrono::milliseconds duration);
+  void recordSortDuration(std::chrono::milliseconds duration);
+  void recordCacheLookup(const std::string& cacheName, bool isHit);
+
+  std::optional<std::chrono::milliseconds> getLastLoadDuration() const;
+  std::optional<std::chrono::milliseconds> getLastSortDuration() const;
+  std::map<std::string, CacheStats> getCacheStats() const;
+
+private:
+  mutable std::mutex mutex_;
+  std::optional<std::chrono::milliseconds> lastLoadDuration_;
+  std::optional<std::chrono::milliseconds> lastSortDuration_;
+  std::map<std::string, CacheStats> cacheStats_;
+};
+
+SessionDiagnostics& getSessionDiagnostics();
+
+// Returns nullopt if the process' resident memory could not be determined.
+std::optional<uint64_t> getResidentMemoryBytes();
+}
+
+#endif
@@ -26,6 +26,7 @@
 #include <algorithm>
 
 #include "gui/helpers.h"
+#include "gui/state/game/detection/cache.h"
 #include "gui/state/game/detection/common.h"
 #include "gui/state/game/detection/detail.h"
 #include "gui/state/game/detection/heroic.h"
@@ -44,18 +45,23 @@ bool isInstalled(const GameSettings& settings) {
       settings.getId(), settings.getMasterFilename(), settings.getGamePath());
 }
 
-std::vector<GameSettings> findInstalledGames(
+InstalledGames findInstalledGames(
     const std::vector<GameSettings>& gamesSettings,
     const std::vector<std::filesystem::path>& xboxGamingRootPaths_,
-    const std::vector<std::string>& preferredUILanguages_) {
+    const std::vector<std::string>& preferredUILanguages_,
+    const std::filesystem::path& detectionCachePath,
+    const std::chrono::milliseconds sourceTimeBudget) {
   const auto heroicConfigPaths = heroic::getHeroicGamesLauncherConfigPaths();
 
+  const auto found = findGameInstallsUsingCache(detectionCachePath,
+                                                Registry(),
+                                                heroicConfigPaths,
+                                                xboxGamingRootPaths_,
+                                                preferredUILanguages_,
+                                                sourceTimeBudget);
+
   std::vector<GameSettings> gamesSettingsToUpdate = gamesSettings;
-  updateInstalledGamesSettings(gamesSettingsToUpdate,
-                               Registry(),
-                               heroicConfigPaths,
-                               xboxGamingRootPaths_,
-                               preferredUILanguages_);
+  updateInstalledGamesSettings(gamesSettingsToUpdate, found.installs);
 
   std::sort(gamesSettingsToUpdate.begin(),
             gamesSettingsToUpdate.end(),
@@ -63,6 +69,6 @@ std::vector<GameSettings> findInstalledGames(
               return lhs.getName() < rhs.getName();
             });
 
-  return gamesSettingsToUpdate;
+  return InstalledGames{gamesSettingsToUpdate, found.timedOutSources};
 }
 }
@@ -24,8 +24,10 @@
 #ifndef LOOT_GUI_STATE_GAME_DETECTION
 #define LOOT_GUI_STATE_GAME_DETECTION
 
+#include <chrono>
 #include <filesystem>
 #include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "gui/state/game/game_settings.h"
@@ -42,13 +44,26 @@ public:
 
 bool isInstalled(const GameSettings& settings);
 
+struct InstalledGames {
+  std::vector<GameSettings> gamesSettings;
+  // The names of the install sources that could not be searched within the
+  // time budget.
+  std::vector<std::string> timedOutSources;
+};
+
 // Detect installed games and add GameSettings objects for those that
 // aren't already represented by the objects that already exist. Also update
 // game paths for existing settings objects that match a found install.
-std::vector<GameSettings> findInstalledGames(
+// Detection results are cached at the given path and reused until the files,
+// folders and Registry values that were used to produce them change. Each
+// install source is searched concurrently and given the time budget to
+// finish.
+InstalledGames findInstalledGames(
     const std::vector<GameSettings>& gamesSettings,
     const std::vector<std::filesystem::path>& xboxGamingRootPaths_,
-    const std::vector<std::string>& preferredUILanguages_);
+    const std::vector<std::string>& preferredUILanguages_,
+    const std::filesystem::path& detectionCachePath,
+    const std::chrono::milliseconds sourceTimeBudget);
 }
 
 #endif
@@ -0,0 +1,527 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/detection/cache.h"
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+#include <QtCore/QString>
+#include <fstream>
+#include <sstream>
+
+#include "gui/state/diagnostics.h"
+#include "gui/state/game/detection/common.h"
+#include "gui/state/logging.h"
+
+namespace {
+using loot::CachedGameDetection;
+using loot::DetectionInputRecorder;
+using loot::DetectionInputStamp;
+using loot::GameId;
+using loot::GameInstall;
+using loot::getLogger;
+using loot::InstallSource;
+using loot::RegistryRead;
+using loot::RegistryRootKey;
+using loot::RegistryValue;
+
+// Bump this if the cache format or what detection reads changes, so that
+// stale caches are discarded.
+constexpr int CACHE_VERSION = 1;
+
+std::mutex activeRecorderMutex;
+DetectionInputRecorder* activeRecorder = nullptr;
+
+thread_local const std::atomic<bool>* detectionInputStopFlag = nullptr;
+
+bool isDetectionInputRecordingStopped() {
+  return detectionInputStopFlag != nullptr && detectionInputStopFlag->load();
+}
+
+std::string getRegistryReadKey(const RegistryValue& value) {
+  return format_as(value.rootKey) + '\\' + value.subKey + '\\' +
+         value.valueName;
+}
+
+QString toQString(const std::filesystem::path& path) {
+  return QString::fromStdString(path.u8string());
+}
+
+std::filesystem::path toPath(const QJsonValue& value) {
+  return std::filesystem::u8path(value.toString().toStdString());
+}
+
+QJsonArray toJson(const std::vector<std::filesystem::path>& paths) {
+  QJsonArray array;
+  for (const auto& path : paths) {
+    array.append(toQString(path));
+  }
+
+  return array;
+}
+
+QJsonArray toJson(const std::vector<std::string>& strings) {
+  QJsonArray array;
+  for (const auto& string : strings) {
+    array.append(QString::fromStdString(string));
+  }
+
+  return array;
+}
+
+std::vector<std::filesystem::path> toPathVector(const QJsonArray& array) {
+  std::vector<std::filesystem::path> paths;
+  for (const auto& entry : array) {
+    paths.push_back(toPath(entry));
+  }
+
+  return paths;
+}
+
+std::vector<std::string> toStringVector(const QJsonArray& array) {
+  std::vector<std::string> strings;
+  for (const auto& entry : array) {
+    strings.push_back(entry.toString().toStdString());
+  }
+
+  return strings;
+}
+
+// Modification times don't fit in a double, so store them as strings.
+QString toJson(std::filesystem::file_time_type::rep modificationTime) {
+  return QString::fromStdString(std::to_string(modificationTime));
+}
+
+std::filesystem::file_time_type::rep toModificationTime(
+    const QJsonValue& value) {
+  std::istringstream stream(value.toString().toStdString());
+  std::filesystem::file_time_type::rep modificationTime = 0;
+  stream >> modificationTime;
+
+  if (stream.fail()) {
+    throw std::runtime_error("Invalid modification time in cache");
+  }
+
+  return modificationTime;
+}
+
+std::optional<GameId> toGameId(const std::string& string) {
+  for (const auto gameId : loot::ALL_GAME_IDS) {
+    if (loot::toString(gameId) == string) {
+      return gameId;
+    }
+  }
+
+  return std::nullopt;
+}
+
+std::optional<RegistryRootKey> toRegistryRootKey(const std::string& string) {
+  for (const auto rootKey :
+       {RegistryRootKey::CURRENT_USER, RegistryRootKey::LOCAL_MACHINE}) {
+    if (format_as(rootKey) == string) {
+      return rootKey;
+    }
+  }
+
+  return std::nullopt;
+}
+
+QJsonObject toJson(const CachedGameDetection& cache) {
+  QJsonObject json;
+  json["version"] = CACHE_VERSION;
+  json["heroicConfigPaths"] = toJson(cache.heroicConfigPaths);
+  json["xboxGamingRootPaths"] = toJson(cache.xboxGamingRootPaths);
+  json["preferredUILanguages"] = toJson(cache.preferredUILanguages);
+
+  QJsonArray paths;
+  for (const auto& [path, stamp] : cache.inputs.paths) {
+    QJsonObject entry;
+    entry["path"] = toQString(path);
+    entry["exists"] = stamp.exists;
+    entry["isDirectory"] = stamp.isDirectory;
+    entry["size"] = static_cast<double>(stamp.size);
+    entry["modificationTime"] = toJson(stamp.modificationTime);
+    paths.append(entry);
+  }
+  json["paths"] = paths;
+
+  QJsonArray registryReads;
+  for (const auto& [key, read] : cache.inputs.registryReads) {
+    QJsonObject entry;
+    entry["rootKey"] = QString::fromStdString(format_as(read.value.rootKey));
+    entry["subKey"] = QString::fromStdString(read.value.subKey);
+    entry["valueName"] = QString::fromStdString(read.value.valueName);
+    if (read.result.has_value()) {
+      entry["result"] = QString::fromStdString(read.result.value());
+    }
+    registryReads.append(entry);
+  }
+  json["registryReads"] = registryReads;
+
+  QJsonArray gameInstalls;
+  for (const auto& install : cache.gameInstalls) {
+    QJsonObject entry;
+    entry["gameId"] = QString::fromStdString(loot::toString(install.gameId));
+    entry["source"] = static_cast<int>(install.source);
+    entry["installPath"] = toQString(install.installPath);
+    entry["localPath"] = toQString(install.localPath);
+    gameInstalls.append(entry);
+  }
+  json["gameInstalls"] = gameInstalls;
+
+  return json;
+}
+
+CachedGameDetection fromJson(const QJsonObject& json) {
+  if (json.value("version").toInt() != CACHE_VERSION) {
+    throw std::runtime_error("Unsupported cache version");
+  }
+
+  CachedGameDetection cache;
+  cache.heroicConfigPaths =
+      toPathVector(json.value("heroicConfigPaths").toArray());
+  cache.xboxGamingRootPaths =
+      toPathVector(json.value("xboxGamingRootPaths").toArray());
+  cache.preferredUILanguages =
+      toStringVector(json.value("preferredUILanguages").toArray());
+
+  for (const auto& value : json.value("paths").toArray()) {
+    const auto entry = value.toObject();
+
+    DetectionInputStamp stamp;
+    stamp.exists = entry.value("exists").toBool();
+    stamp.isDirectory = entry.value("isDirectory").toBool();
+    stamp.size = static_cast<uintmax_t>(entry.value("size").toDouble());
+    stamp.modificationTime =
+        toModificationTime(entry.value("modificationTime"));
+
+    cache.inputs.paths.emplace(toPath(entry.value("path")), stamp);
+  }
+
+  for (const auto& value : json.value("registryReads").toArray()) {
+    const auto entry = value.toObject();
+
+    const auto rootKey =
+        toRegistryRootKey(entry.value("rootKey").toString().toStdString());
+    if (!rootKey.has_value()) {
+      throw std::runtime_error("Invalid Registry root key in cache");
+    }
+
+    RegistryRead read;
+    read.value.rootKey = rootKey.value();
+    read.value.subKey = entry.value("subKey").toString().toStdString();
+    read.value.valueName = entry.value("valueName").toString().toStdString();
+    if (entry.contains("result")) {
+      read.result = entry.value("result").toString().toStdString();
+    }
+
+    cache.inputs.registryReads.emplace(getRegistryReadKey(read.value), read);
+  }
+
+  for (const auto& value : json.value("gameInstalls").toArray()) {
+    const auto entry = value.toObject();
+
+    const auto gameId =
+        toGameId(entry.value("gameId").toString().toStdString());
+    const auto source = entry.value("source").toInt(-1);
+    if (!gameId.has_value() || source < 0 ||
+        source > static_cast<int>(InstallSource::unknown)) {
+      throw std::runtime_error("Invalid game install in cache");
+    }
+
+    GameInstall install;
+    install.gameId = gameId.value();
+    install.source = static_cast<InstallSource>(source);
+    install.installPath = toPath(entry.value("installPath"));
+    install.localPath = toPath(entry.value("localPath"));
+
+    cache.gameInstalls.push_back(install);
+  }
+
+  return cache;
+}
+}
+
+namespace loot {
+bool DetectionInputStamp::operator==(const DetectionInputStamp& other) const {
+  return exists == other.exists && isDirectory == other.isDirectory &&
+         size == other.size && modificationTime == other.modificationTime;
+}
+
+bool DetectionInputStamp::operator!=(const DetectionInputStamp& other) const {
+  return !(*this == other);
+}
+
+DetectionInputStamp getDetectionInputStamp(const std::filesystem::path& path) {
+  DetectionInputStamp stamp;
+
+  std::error_code errorCode;
+  const auto status = std::filesystem::status(path, errorCode);
+  if (errorCode || !std::filesystem::exists(status)) {
+    return stamp;
+  }
+
+  stamp.exists = true;
+  stamp.isDirectory = std::filesystem::is_directory(status);
+
+  if (std::filesystem::is_regular_file(status)) {
+    const auto size = std::filesystem::file_size(path, errorCode);
+    if (!errorCode) {
+      stamp.size = size;
+    }
+  }
+
+  // A directory's modification time changes when entries are added to or
+  // removed from it, which is what detection cares about when it lists a
+  // directory's contents.
+  const auto modificationTime =
+      std::filesystem::last_write_time(path, errorCode);
+  if (!errorCode) {
+    stamp.modificationTime = modificationTime.time_since_epoch().count();
+  }
+
+  return stamp;
+}
+
+DetectionInputRecorder::DetectionInputRecorder() {
+  std::lock_guard<std::mutex> guard(activeRecorderMutex);
+
+  if (activeRecorder != nullptr) {
+    throw std::logic_error("A detection input recorder is already active");
+  }
+
+  activeRecorder = this;
+}
+
+DetectionInputRecorder::~DetectionInputRecorder() {
+  std::lock_guard<std::mutex> guard(activeRecorderMutex);
+
+  activeRecorder = nullptr;
+}
+
+void DetectionInputRecorder::record(const std::filesystem::path& path,
+                                    const DetectionInputStamp& stamp) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  // Keep the first stamp, as it was taken before the path was first read.
+  inputs_.paths.emplace(path, stamp);
+}
+
+void DetectionInputRecorder::record(const RegistryValue& value,
+                                    const std::optional<std::string>& result) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  inputs_.registryReads.emplace(getRegistryReadKey(value),
+                                RegistryRead{value, result});
+}
+
+DetectionInputs DetectionInputRecorder::getInputs() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  return inputs_;
+}
+
+void recordDetectionInput(const std::filesystem::path& path) {
+  if (isDetectionInputRecordingStopped()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(activeRecorderMutex);
+    if (activeRecorder == nullptr) {
+      return;
+    }
+  }
+
+  // Stat the path without holding the lock so that detection running on
+  // several threads doesn't get serialised here.
+  const auto stamp = getDetectionInputStamp(path);
+
+  std::lock_guard<std::mutex> guard(activeRecorderMutex);
+  if (activeRecorder != nullptr && !isDetectionInputRecordingStopped()) {
+    activeRecorder->record(path, stamp);
+  }
+}
+
+void setDetectionInputStopFlag(const std::atomic<bool>* stopFlag) {
+  detectionInputStopFlag = stopFlag;
+}
+
+RecordingRegistry::RecordingRegistry(const RegistryInterface& registry) :
+    registry_(registry) {}
+
+std::optional<std::string> RecordingRegistry::getStringValue(
+    const RegistryValue& value) const {
+  const auto result = registry_.getStringValue(value);
+
+  std::lock_guard<std::mutex> guard(activeRecorderMutex);
+  if (activeRecorder != nullptr && !isDetectionInputRecordingStopped()) {
+    activeRecorder->record(value, result);
+  }
+
+  return result;
+}
+
+bool areDetectionInputsUnchanged(const DetectionInputs& inputs,
+                                 const RegistryInterface& registry) {
+  const auto logger = getLogger();
+
+  for (const auto& [path, stamp] : inputs.paths) {
+    if (getDetectionInputStamp(path) != stamp) {
+      if (logger) {
+        logger->debug("The game detection input at {} has changed.",
+                      path.u8string());
+      }
+      return false;
+    }
+  }
+
+  for (const auto& [key, read] : inputs.registryReads) {
+    if (registry.getStringValue(read.value) != read.result) {
+      if (logger) {
+        logger->debug("The game detection input Registry value {} has changed.",
+                      key);
+      }
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::optional<CachedGameDetection> loadGameDetectionCache(
+    const std::filesystem::path& cachePath) {
+  if (!std::filesystem::exists(cachePath)) {
+    return std::nullopt;
+  }
+
+  const auto logger = getLogger();
+
+  try {
+    std::ifstream in(cachePath, std::ios::binary);
+    std::ostringstream content;
+    content << in.rdbuf();
+
+    QJsonParseError error;
+    const auto document = QJsonDocument::fromJson(
+        QByteArray::fromStdString(content.str()), &error);
+    if (error.error != QJsonParseError::NoError || !document.isObject()) {
+      throw std::runtime_error(error.errorString().toStdString());
+    }
+
+    return fromJson(document.object());
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->warn("Ignoring the game detection cache at {}: {}",
+                   cachePath.u8string(),
+                   e.what());
+    }
+    return std::nullopt;
+  }
+}
+
+void saveGameDetectionCache(const std::filesystem::path& cachePath,
+                            const CachedGameDetection& cache) {
+  auto file = QSaveFile(toQString(cachePath));
+
+  if (!file.open(QIODevice::WriteOnly)) {
+    throw std::runtime_error("Failed to open " + cachePath.u8string() +
+                             " for writing: " +
+                             file.errorString().toStdString());
+  }
+
+  file.write(QJsonDocument(toJson(cache)).toJson(QJsonDocument::Compact));
+
+  if (!file.commit()) {
+    throw std::runtime_error("Failed to write " + cachePath.u8string() + ": " +
+                             file.errorString().toStdString());
+  }
+}
+
+FoundGameInstalls findGameInstallsUsingCache(
+    const std::filesystem::path& cachePath,
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages,
+    const std::chrono::milliseconds sourceTimeBudget) {
+  const auto logger = getLogger();
+
+  const auto cache = loadGameDetectionCache(cachePath);
+  const auto isCacheValid =
+      cache.has_value() && cache->heroicConfigPaths == heroicConfigPaths &&
+      cache->xboxGamingRootPaths == xboxGamingRootPaths &&
+      cache->preferredUILanguages == preferredUILanguages &&
+      areDetectionInputsUnchanged(cache->inputs, registry);
+  getSessionDiagnostics().recordCacheLookup("game detection", isCacheValid);
+
+  if (isCacheValid) {
+    if (logger) {
+      logger->info(
+          "None of the {} paths and {} Registry values consulted by game "
+          "detection have changed, using cached results.",
+          cache->inputs.paths.size(),
+          cache->inputs.registryReads.size());
+    }
+    return FoundGameInstalls{cache->gameInstalls, {}};
+  }
+
+  CachedGameDetection newCache;
+  newCache.heroicConfigPaths = heroicConfigPaths;
+  newCache.xboxGamingRootPaths = xboxGamingRootPaths;
+  newCache.preferredUILanguages = preferredUILanguages;
+
+  FoundGameInstalls found;
+  {
+    DetectionInputRecorder recorder;
+    const RecordingRegistry recordingRegistry(registry);
+
+    found = findGameInstalls(recordingRegistry,
+                             heroicConfigPaths,
+                             xboxGamingRootPaths,
+                             preferredUILanguages,
+                             sourceTimeBudget);
+    newCache.inputs = recorder.getInputs();
+  }
+
+  if (!found.timedOutSources.empty()) {
+    // The results are incomplete, so caching them would hide installs from
+    // the sources that timed out until something else changed.
+    return found;
+  }
+
+  newCache.gameInstalls = found.installs;
+
+  try {
+    saveGameDetectionCache(cachePath, newCache);
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->error("Failed to save the game detection cache: {}", e.what());
+    }
+  }
+
+  return found;
+}
+}
@@ -0,0 +1,143 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_DETECTION_CACHE
+#define LOOT_GUI_STATE_GAME_DETECTION_CACHE
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gui/state/game/detection/detail.h"
+#include "gui/state/game/detection/game_install.h"
+#include "gui/state/game/detection/registry.h"
+
+namespace loot {
+// What stat() says about a path that game detection read. Two stamps for the
+// same path are equal if nothing that detection could have seen has changed.
+struct DetectionInputStamp {
+  bool exists{false};
+  bool isDirectory{false};
+  uintmax_t size{0};
+  std::filesystem::file_time_type::rep modificationTime{0};
+
+  bool operator==(const DetectionInputStamp& other) const;
+  bool operator!=(const DetectionInputStamp& other) const;
+};
+
+struct RegistryRead {
+  RegistryValue value;
+  std::optional<std::string> result;
+};
+
+struct DetectionInputs {
+  std::map<std::filesystem::path, DetectionInputStamp> paths;
+  // Keyed on a string that identifies the Registry value that was read.
+  std::map<std::string, RegistryRead> registryReads;
+};
+
+struct CachedGameDetection {
+  std::vector<std::filesystem::path> heroicConfigPaths;
+  std::vector<std::filesystem::path> xboxGamingRootPaths;
+  std::vector<std::string> preferredUILanguages;
+  DetectionInputs inputs;
+  std::vector<GameInstall> gameInstalls;
+};
+
+DetectionInputStamp getDetectionInputStamp(const std::filesystem::path& path);
+
+// While an instance of this class exists, the paths and Registry values that
+// game detection reads are recorded in it. Only one instance may exist at a
+// time, but recording is thread-safe.
+class DetectionInputRecorder {
+public:
+  DetectionInputRecorder();
+  ~DetectionInputRecorder();
+
+  DetectionInputRecorder(const DetectionInputRecorder&) = delete;
+  DetectionInputRecorder& operator=(const DetectionInputRecorder&) = delete;
+
+  void record(const std::filesystem::path& path,
+              const DetectionInputStamp& stamp);
+  void record(const RegistryValue& value,
+              const std::optional<std::string>& result);
+
+  DetectionInputs getInputs() const;
+
+private:
+  mutable std::mutex mutex_;
+  DetectionInputs inputs_;
+};
+
+// Record that game detection is about to read the given path. Does nothing if
+// there is no active DetectionInputRecorder, or if the calling thread's stop
+// flag is set.
+void recordDetectionInput(const std::filesystem::path& path);
+
+// Sets the flag that stops detection inputs from being recorded on the calling
+// thread once it is set. Detection scanners that run out of time are left
+// running in the background, and this stops them from recording inputs into a
+// later detection's recorder. The flag must outlive the thread.
+void setDetectionInputStopFlag(const std::atomic<bool>* stopFlag);
+
+// Wraps another Registry implementation and records the values that are read
+// through it.
+class RecordingRegistry : public RegistryInterface {
+public:
+  explicit RecordingRegistry(const RegistryInterface& registry);
+
+  std::optional<std::string> getStringValue(
+      const RegistryValue& value) const override;
+
+private:
+  const RegistryInterface& registry_;
+};
+
+bool areDetectionInputsUnchanged(const DetectionInputs& inputs,
+                                 const RegistryInterface& registry);
+
+std::optional<CachedGameDetection> loadGameDetectionCache(
+    const std::filesystem::path& cachePath);
+
+void saveGameDetectionCache(const std::filesystem::path& cachePath,
+                            const CachedGameDetection& cache);
+
+// Find game installs, reusing the results cached at the given path if the
+// parameters match and none of the files, folders or Registry values that
+// were consulted to produce them have changed. If detection is run and no
+// source times out, its results are written to the cache.
+FoundGameInstalls findGameInstallsUsingCache(
+    const std::filesystem::path& cachePath,
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages,
+    const std::chrono::milliseconds sourceTimeBudget);
+}
+
+#endif
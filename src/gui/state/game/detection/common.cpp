@@ -27,6 +27,7 @@
 #include <functional>
 
 #include "gui/helpers.h"
+#include "gui/state/game/detection/cache.h"
 #include "gui/state/game/game_settings.h"
 #include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
@@ -85,12 +86,16 @@ bool executableExists(const GameId& gameType,
     case GameId::tes5vr:
     case GameId::fo4:
     case GameId::fo4vr:
-    case GameId::openmw:
+    case GameId::openmw: {
       // OpenMW's executable is checked because the game paths /usr/bin and
       // /usr/games may have the same data path, leading to two installs being
       // recorded when there's actually only one.
-      return std::filesystem::exists(
-          gamePath / std::filesystem::u8path(getExecutableName(gameType)));
+      const auto executablePath =
+          gamePath / std::filesystem::u8path(getExecutableName(gameType));
+      loot::recordDetectionInput(executablePath);
+
+      return std::filesystem::exists(executablePath);
+    }
     case GameId::tes3:
     case GameId::tes4:
     case GameId::nehrim:
@@ -143,9 +148,15 @@ namespace loot {
 bool isValidGamePath(const GameId gameId,
                      const std::string& masterFilename,
                      const std::filesystem::path& pathToCheck) {
-  return !pathToCheck.empty() &&
-         std::filesystem::exists(getDataPath(gameId, pathToCheck) /
-                                 std::filesystem::u8path(masterFilename)) &&
+  if (pathToCheck.empty()) {
+    return false;
+  }
+
+  const auto masterFilePath = getDataPath(gameId, pathToCheck) /
+                              std::filesystem::u8path(masterFilename);
+  recordDetectionInput(masterFilePath);
+
+  return std::filesystem::exists(masterFilePath) &&
          executableExists(gameId, pathToCheck);
 }
 
@@ -24,9 +24,16 @@
 #include "gui/state/game/detection/detail.h"
 
 #include <algorithm>
+#include <atomic>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_set>
 
 #include "gui/helpers.h"
+#include "gui/state/game/detection/cache.h"
 #include "gui/state/game/detection/common.h"
 #include "gui/state/game/detection/epic_games_store.h"
 #include "gui/state/game/detection/generic.h"
@@ -35,6 +42,7 @@
 #include "gui/state/game/detection/microsoft_store.h"
 #include "gui/state/game/detection/steam.h"
 #include "gui/state/logging.h"
+#include "gui/state/tracing.h"
 
 namespace {
 using loot::GameId;
@@ -43,6 +51,8 @@ using loot::getGameName;
 using loot::getLogger;
 using loot::getSourceDescription;
 using loot::InstallSource;
+using loot::isTracingEnabled;
+using loot::recordTraceEvent;
 
 // Unfortunately std::filesystem::equivalent() requires paths to exist and
 // throws otherwise. This function first compares the paths as strings, and then
@@ -110,41 +120,136 @@ std::vector<GameInstall> deduplicateGameInstalls(
   return uniqueGameInstalls;
 }
 
-// Search for installed copies of the given game, and return all those found.
-std::vector<GameInstall> findGameInstalls(
-    const loot::RegistryInterface& registry,
-    const GameId gameId,
-    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
-    const std::vector<std::string>& preferredUILanguages) {
-  const auto logger = getLogger();
-  if (logger) {
-    logger->trace("Checking if game \"{}\" is installed.", getGameName(gameId));
+// Forwards Registry reads to another Registry implementation until detached,
+// after which reads return nothing. Scanners that run past their time budget
+// keep running in the background, and this stops them from reading through a
+// Registry object that no longer exists. Registry reads are quick, so
+// detaching waits for any read in progress to finish.
+class DetachableRegistry : public loot::RegistryInterface {
+public:
+  explicit DetachableRegistry(const loot::RegistryInterface& registry) :
+      registry_(&registry) {}
+
+  std::optional<std::string> getStringValue(
+      const loot::RegistryValue& value) const override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (registry_ == nullptr) {
+      return std::nullopt;
+    }
+
+    return registry_->getStringValue(value);
   }
 
-  std::vector<GameInstall> installs;
+  void detach() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    registry_ = nullptr;
+  }
 
-  const auto steamInstalls = loot::steam::findGameInstalls(registry, gameId);
-  installs.insert(installs.end(), steamInstalls.begin(), steamInstalls.end());
+private:
+  mutable std::mutex mutex_;
+  const loot::RegistryInterface* registry_;
+};
 
-  const auto gogInstalls = loot::gog::findGameInstalls(registry, gameId);
-  installs.insert(installs.end(), gogInstalls.begin(), gogInstalls.end());
+// Scanners are given a flag that is set if they run out of time, and should
+// stop as soon as they see it set.
+using ScannerStopFlag = std::atomic<bool>;
 
-  const auto genericInstalls =
-      loot::generic::findGameInstalls(registry, gameId);
-  installs.insert(
-      installs.end(), genericInstalls.begin(), genericInstalls.end());
+struct SourceScanner {
+  std::string name;
+  std::function<std::vector<GameInstall>(const ScannerStopFlag&)> scan;
+};
 
-  const auto epicInstall =
-      loot::epic::findGameInstalls(registry, gameId, preferredUILanguages);
-  if (epicInstall.has_value()) {
-    installs.push_back(epicInstall.value());
+// Run each scanner on its own thread and wait until it finishes or its time
+// budget runs out. The threads are detached, so a scanner that is stuck on an
+// unresponsive drive doesn't hold up the caller. A scanner that runs out of
+// time is told to stop: it stops recording detection inputs and Registry
+// reads, and stops at its next check of the flag, but a call that is already
+// in progress (e.g. reading a Steam library) may still run to completion and
+// log messages. Returns nullopt for each scanner that ran out of time.
+std::vector<std::optional<std::vector<GameInstall>>> runSourceScanners(
+    const std::vector<SourceScanner>& scanners,
+    const std::chrono::milliseconds timeBudget) {
+  const auto logger = getLogger();
+  const auto deadline = std::chrono::steady_clock::now() + timeBudget;
+
+  std::vector<std::future<std::vector<GameInstall>>> futures;
+  std::vector<std::shared_ptr<ScannerStopFlag>> stopFlags;
+  for (const auto& scanner : scanners) {
+    auto task = std::make_shared<
+        std::packaged_task<std::vector<GameInstall>(const ScannerStopFlag&)>>(
+        scanner.scan);
+    auto stopFlag = std::make_shared<ScannerStopFlag>(false);
+    futures.push_back(task->get_future());
+    stopFlags.push_back(stopFlag);
+
+    std::thread([task, stopFlag, name = scanner.name]() {
+      const auto startedAt = std::chrono::steady_clock::now();
+
+      // The thread shares ownership of the flag, so it outlives the thread.
+      setDetectionInputStopFlag(stopFlag.get());
+
+      (*task)(*stopFlag);
+
+      // A scanner that was told to stop may still be running when LOOT
+      // exits, so it must not record a trace event.
+      if (!stopFlag->load() && isTracingEnabled()) {
+        recordTraceEvent("filesystem",
+                         "Search " + name,
+                         startedAt,
+                         std::chrono::steady_clock::now());
+      }
+    }).detach();
   }
 
-  const auto msInstalls = loot::microsoft::findGameInstalls(
-      gameId, xboxGamingRootPaths, preferredUILanguages);
-  installs.insert(installs.end(), msInstalls.begin(), msInstalls.end());
+  std::vector<std::optional<std::vector<GameInstall>>> results;
+  for (size_t i = 0; i < scanners.size(); i += 1) {
+    if (futures[i].wait_until(deadline) != std::future_status::ready) {
+      stopFlags[i]->store(true);
+
+      if (logger) {
+        logger->warn(
+            "Searching {} for game installs took longer than {} ms, "
+            "continuing without its results.",
+            scanners[i].name,
+            timeBudget.count());
+      }
+      results.push_back(std::nullopt);
+      continue;
+    }
 
-  return installs;
+    try {
+      results.push_back(futures[i].get());
+    } catch (const std::exception& e) {
+      if (logger) {
+        logger->error("Error while searching {} for game installs: {}",
+                      scanners[i].name,
+                      e.what());
+      }
+      results.push_back(std::vector<GameInstall>());
+    }
+  }
+
+  return results;
+}
+
+// Create a scanner that calls the given function for every game.
+SourceScanner createPerGameScanner(
+    const std::string& name,
+    const std::function<std::vector<GameInstall>(GameId)>& findInstalls) {
+  const auto scan = [findInstalls](const ScannerStopFlag& shouldStop) {
+    std::vector<GameInstall> installs;
+    for (const auto& gameId : loot::ALL_GAME_IDS) {
+      if (shouldStop) {
+        break;
+      }
+
+      const auto gameInstalls = findInstalls(gameId);
+      installs.insert(installs.end(), gameInstalls.begin(), gameInstalls.end());
+    }
+    return installs;
+  };
+
+  return SourceScanner{name, scan};
 }
 
 void incrementGameSourceCount(
@@ -202,43 +307,154 @@ std::string getNameSourceSuffix(const InstallSource source) {
   }
 }
 
-std::vector<GameInstall> findGameInstalls(
+FoundGameInstalls findGameInstalls(
     const RegistryInterface& registry,
     const std::vector<std::filesystem::path>& heroicConfigPaths,
     const std::vector<std::filesystem::path>& xboxGamingRootPaths,
-    const std::vector<std::string>& preferredUILanguages) {
-  std::vector<GameInstall> installs;
-
-  for (const auto& steamInstallPath : steam::getSteamInstallPaths(registry)) {
-    for (const auto& libraryPath :
-         steam::getSteamLibraryPaths(steamInstallPath)) {
-      for (const auto& gameId : ALL_GAME_IDS) {
-        for (const auto& manifestPath :
-             steam::getSteamAppManifestPaths(libraryPath, gameId)) {
-          const auto install = steam::findGameInstall(manifestPath);
-          if (install.has_value()) {
-            installs.push_back(install.value());
-          }
-        }
-      }
+    const std::vector<std::string>& preferredUILanguages,
+    const std::chrono::milliseconds sourceTimeBudget) {
+  const auto sharedRegistry = std::make_shared<DetachableRegistry>(registry);
+
+  // The scanners may outlive this function, so they must not capture
+  // anything by reference.
+  std::vector<SourceScanner> scanners{
+      {"Steam libraries",
+       [sharedRegistry](const ScannerStopFlag& shouldStop) {
+         std::vector<std::filesystem::path> libraryPaths;
+         for (const auto& steamInstallPath :
+              steam::getSteamInstallPaths(*sharedRegistry)) {
+           if (shouldStop) {
+             return std::vector<GameInstall>();
+           }
+
+           const auto paths = steam::getSteamLibraryPaths(steamInstallPath);
+           libraryPaths.insert(libraryPaths.end(), paths.begin(), paths.end());
+         }
+
+         if (shouldStop) {
+           return std::vector<GameInstall>();
+         }
+
+         const steam::SteamLibraryIndex index(libraryPaths, &shouldStop);
+
+         std::vector<GameInstall> installs;
+         for (const auto& gameId : ALL_GAME_IDS) {
+           const auto gameInstalls = index.findGameInstalls(gameId);
+           installs.insert(
+               installs.end(), gameInstalls.begin(), gameInstalls.end());
+         }
+         return installs;
+       }},
+      {"the Heroic Games Launcher",
+       [heroicConfigPaths,
+        preferredUILanguages](const ScannerStopFlag& shouldStop) {
+         std::vector<GameInstall> installs;
+         for (const auto& heroicConfigPath : heroicConfigPaths) {
+           if (shouldStop) {
+             break;
+           }
+
+           const auto heroicGameInstalls = heroic::findGameInstalls(
+               heroicConfigPath, preferredUILanguages);
+           installs.insert(installs.end(),
+                           heroicGameInstalls.begin(),
+                           heroicGameInstalls.end());
+         }
+         return installs;
+       }},
+      createPerGameScanner(
+          "the Steam Registry entries",
+          [sharedRegistry](GameId gameId) {
+            return steam::findGameInstalls(*sharedRegistry, gameId);
+          }),
+      createPerGameScanner(
+          "the GOG Registry entries",
+          [sharedRegistry](GameId gameId) {
+            return gog::findGameInstalls(*sharedRegistry, gameId);
+          }),
+      createPerGameScanner(
+          "the games' own Registry entries",
+          [sharedRegistry](GameId gameId) {
+            return generic::findGameInstalls(*sharedRegistry, gameId);
+          }),
+      {"the Epic Games Store",
+       [sharedRegistry,
+        preferredUILanguages](const ScannerStopFlag& shouldStop) {
+         const epic::EgsManifestIndex index(*sharedRegistry, &shouldStop);
+
+         std::vector<GameInstall> installs;
+         for (const auto& gameId : ALL_GAME_IDS) {
+           if (shouldStop) {
+             break;
+           }
+
+           const auto install =
+               epic::findGameInstalls(index, gameId, preferredUILanguages);
+           if (install.has_value()) {
+             installs.push_back(install.value());
+           }
+         }
+         return installs;
+       }},
+      createPerGameScanner(
+          "the Microsoft Store",
+          [xboxGamingRootPaths, preferredUILanguages](GameId gameId) {
+            return microsoft::findGameInstalls(
+                gameId, xboxGamingRootPaths, preferredUILanguages);
+          })};
+
+  // The first two scanners' results are kept in the order they were found,
+  // the rest are interleaved game by game.
+  static constexpr size_t FIRST_PER_GAME_SCANNER = 2;
+
+  const auto results = runSourceScanners(scanners, sourceTimeBudget);
+  sharedRegistry->detach();
+
+  FoundGameInstalls found;
+  for (size_t i = 0; i < results.size(); i += 1) {
+    if (!results[i].has_value()) {
+      found.timedOutSources.push_back(scanners[i].name);
+    } else if (i < FIRST_PER_GAME_SCANNER) {
+      found.installs.insert(found.installs.end(),
+                            results[i]->begin(),
+                            results[i]->end());
     }
   }
 
-  for (const auto& heroicConfigPath : heroicConfigPaths) {
-    const auto heroicGameInstalls =
-        heroic::findGameInstalls(heroicConfigPath, preferredUILanguages);
-    installs.insert(
-        installs.end(), heroicGameInstalls.begin(), heroicGameInstalls.end());
-  }
-
+  // Merge the per-game results game by game, so that the installs are in the
+  // same order as if each game's sources had been searched in turn.
   for (const auto& gameId : ALL_GAME_IDS) {
-    const auto gameInstalls = ::findGameInstalls(
-        registry, gameId, xboxGamingRootPaths, preferredUILanguages);
-    installs.insert(installs.end(), gameInstalls.begin(), gameInstalls.end());
+    for (size_t i = FIRST_PER_GAME_SCANNER; i < results.size(); i += 1) {
+      if (!results[i].has_value()) {
+        continue;
+      }
+
+      std::copy_if(results[i]->begin(),
+                   results[i]->end(),
+                   std::back_inserter(found.installs),
+                   [&](const GameInstall& install) {
+                     return install.gameId == gameId;
+                   });
+    }
   }
 
   // The installs may duplicate Steam or GOG installs, so deduplicate them.
-  return deduplicateGameInstalls(installs);
+  found.installs = deduplicateGameInstalls(found.installs);
+
+  return found;
+}
+
+std::vector<GameInstall> findGameInstalls(
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  return findGameInstalls(registry,
+                          heroicConfigPaths,
+                          xboxGamingRootPaths,
+                          preferredUILanguages,
+                          DEFAULT_SOURCE_TIME_BUDGET)
+      .installs;
 }
 
 std::unordered_map<GameId, std::unordered_map<InstallSource, size_t>>
@@ -437,13 +653,7 @@ void appendNewGamesSettings(
 
 void updateInstalledGamesSettings(
     std::vector<GameSettings>& gamesSettings,
-    const RegistryInterface& registry,
-    const std::vector<std::filesystem::path>& heroicConfigPaths,
-    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
-    const std::vector<std::string>& preferredUILanguages) {
-  const auto gameInstalls = findGameInstalls(
-      registry, heroicConfigPaths, xboxGamingRootPaths, preferredUILanguages);
-
+    const std::vector<GameInstall>& gameInstalls) {
   const auto newGameInstalls =
       updateMatchingSettings(gamesSettings, gameInstalls, arePathsEquivalent);
 
@@ -454,4 +664,16 @@ void updateInstalledGamesSettings(
 
   appendNewGamesSettings(gamesSettings, gameSourceCounts, newGameInstalls);
 }
+
+void updateInstalledGamesSettings(
+    std::vector<GameSettings>& gamesSettings,
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  const auto gameInstalls = findGameInstalls(
+      registry, heroicConfigPaths, xboxGamingRootPaths, preferredUILanguages);
+
+  updateInstalledGamesSettings(gamesSettings, gameInstalls);
+}
 }
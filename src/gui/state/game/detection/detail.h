@@ -26,6 +26,7 @@
 
 #include <loot/enum/game_type.h>
 
+#include <chrono>
 #include <filesystem>
 #include <functional>
 #include <optional>
@@ -42,6 +43,26 @@ std::string getSourceDescription(const InstallSource source);
 
 std::string getNameSourceSuffix(const InstallSource source);
 
+static constexpr std::chrono::milliseconds DEFAULT_SOURCE_TIME_BUDGET =
+    std::chrono::seconds(10);
+
+struct FoundGameInstalls {
+  std::vector<GameInstall> installs;
+  // The names of the sources that could not be searched within the time
+  // budget.
+  std::vector<std::string> timedOutSources;
+};
+
+// Search all install sources concurrently, giving each source the given
+// amount of time to finish. Sources that take longer are left to finish in
+// the background and their results are discarded.
+FoundGameInstalls findGameInstalls(
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages,
+    const std::chrono::milliseconds sourceTimeBudget);
+
 std::vector<GameInstall> findGameInstalls(
     const RegistryInterface& registry,
     const std::vector<std::filesystem::path>& heroicConfigPaths,
@@ -85,6 +106,11 @@ void appendNewGamesSettings(
 // paths in any matching existing settings objects. Returns
 // the settings objects (that may have been updated), plus the new settings
 // objects.
+void updateInstalledGamesSettings(
+    std::vector<GameSettings>& gamesSettings,
+    const std::vector<GameInstall>& gameInstalls);
+
+// As above, but first find the game installs.
 void updateInstalledGamesSettings(
     std::vector<GameSettings>& gamesSettings,
     const RegistryInterface& registry,
@@ -30,6 +30,7 @@
 #include <QtCore/QString>
 #include <boost/algorithm/string/predicate.hpp>
 
+#include "gui/state/game/detection/cache.h"
 #include "gui/state/game/detection/common.h"
 
 #ifdef _WIN32
@@ -179,6 +180,8 @@ EgsManifestData getEgsManifestData(const std::filesystem::path& manifestPath) {
     logger->trace("Reading EGS manifest file at {}.", manifestPath.u8string());
   }
 
+  loot::recordDetectionInput(manifestPath);
+
   // The manifest file is a JSON file.
   // Use Qt to parse the file - it breaks the separation of Qt out into just
   // the GUI code, but it's not worth jumping through hoops to preserve that.
@@ -226,56 +229,6 @@ EgsManifestData getEgsManifestData(const std::filesystem::path& manifestPath) {
   return data;
 }
 
-std::optional<std::filesystem::path> getEgsGameInstallPath(
-    const loot::RegistryInterface& registry,
-    const loot::GameId gameId) {
-  // Unfortunately we don't know which is the right manifest file, so iterate
-  // over them until the one containing the correct AppName is found.
-  const auto expectedAppName = getEgsAppName(gameId);
-
-  if (!expectedAppName.has_value()) {
-    // Short-circuit to avoid unnecessary directory scanning.
-    return std::nullopt;
-  }
-
-  const auto egsManifestsPath = getEgsManifestsPath(registry);
-  if (!egsManifestsPath.has_value() ||
-      !std::filesystem::exists(egsManifestsPath.value())) {
-    return std::nullopt;
-  }
-
-  const auto logger = getLogger();
-
-  if (logger) {
-    logger->trace(
-        "Checking if game \"{}\" is installed through the Epic Games "
-        "Store.",
-        loot::getGameName(gameId));
-  }
-
-  for (const auto& entry :
-       std::filesystem::directory_iterator(egsManifestsPath.value())) {
-    if (entry.is_regular_file() &&
-        boost::iends_with(entry.path().filename().u8string(), ".item")) {
-      const auto manifestData = getEgsManifestData(entry.path());
-
-      if (manifestData.appName == expectedAppName) {
-        if (logger) {
-          logger->trace(
-              "Extracted install location {} from manifest file at {}.",
-              manifestData.installLocation,
-              entry.path().u8string());
-        }
-
-        return std::filesystem::u8path(manifestData.installLocation);
-      }
-    }
-  }
-
-  return std::nullopt;
-}
-}
-
 namespace loot::epic {
 std::optional<std::string> getEgsAppName(const GameId gameId) {
   return ::getEgsAppName(gameId);
@@ -322,12 +275,108 @@ std::optional<std::filesystem::path> findGameInstallPath(
       gameId, preferredUILanguages, pathsToCheck);
 }
 
+EgsManifestIndex::EgsManifestIndex(const RegistryInterface& registry,
+                                   const std::atomic<bool>* stopFlag) {
+  const auto logger = getLogger();
+
+  try {
+    const auto egsManifestsPath = getEgsManifestsPath(registry);
+    if (!egsManifestsPath.has_value()) {
+      return;
+    }
+
+    recordDetectionInput(egsManifestsPath.value());
+
+    if (!std::filesystem::exists(egsManifestsPath.value())) {
+      return;
+    }
+
+    if (logger) {
+      logger->trace("Indexing Epic Games Store manifests in {}.",
+                    egsManifestsPath.value().u8string());
+    }
+
+    for (const auto& entry :
+         std::filesystem::directory_iterator(egsManifestsPath.value())) {
+      if (stopFlag != nullptr && stopFlag->load()) {
+        return;
+      }
+
+      if (entry.is_regular_file() &&
+          boost::iends_with(entry.path().filename().u8string(), ".item")) {
+        const auto manifestData = getEgsManifestData(entry.path());
+
+        if (manifestData.appName.empty()) {
+          continue;
+        }
+
+        // Keep the first manifest found for each AppName.
+        const auto inserted =
+            installLocations_
+                .emplace(manifestData.appName,
+                         std::filesystem::u8path(manifestData.installLocation))
+                .second;
+
+        if (inserted && logger) {
+          logger->trace(
+              "Extracted install location {} for AppName {} from manifest "
+              "file at {}.",
+              manifestData.installLocation,
+              manifestData.appName,
+              entry.path().u8string());
+        }
+      }
+    }
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->error("Error while indexing Epic Games Store manifests: {}",
+                    e.what());
+    }
+  }
+}
+
+std::optional<std::filesystem::path> EgsManifestIndex::getInstallLocation(
+    const GameId gameId) const {
+  const auto appName = getEgsAppName(gameId);
+  if (!appName.has_value()) {
+    return std::nullopt;
+  }
+
+  const auto it = installLocations_.find(appName.value());
+  if (it == installLocations_.end()) {
+    return std::nullopt;
+  }
+
+  return it->second;
+}
+
 std::optional<GameInstall> findGameInstalls(
     const RegistryInterface& registry,
     const GameId gameId,
     const std::vector<std::string>& preferredUILanguages) {
+  if (!getEgsAppName(gameId).has_value()) {
+    // Short-circuit to avoid unnecessary directory scanning.
+    return std::nullopt;
+  }
+
+  return findGameInstalls(
+      EgsManifestIndex(registry), gameId, preferredUILanguages);
+}
+
+std::optional<GameInstall> findGameInstalls(
+    const EgsManifestIndex& index,
+    const GameId gameId,
+    const std::vector<std::string>& preferredUILanguages) {
   try {
-    const auto installPath = getEgsGameInstallPath(registry, gameId);
+    const auto logger = getLogger();
+    if (logger) {
+      logger->trace(
+          "Checking if game \"{}\" is installed through the Epic Games "
+          "Store.",
+          getGameName(gameId));
+    }
+
+    const auto installPath = index.getInstallLocation(gameId);
 
     if (installPath.has_value()) {
       const auto localisedInstallPath = findGameInstallPath(
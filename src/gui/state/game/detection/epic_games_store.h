@@ -24,7 +24,10 @@
 #ifndef LOOT_GUI_STATE_GAME_DETECTION_EPIC_GAMES_STORE
 #define LOOT_GUI_STATE_GAME_DETECTION_EPIC_GAMES_STORE
 
+#include <atomic>
 #include <filesystem>
+#include <map>
+#include <string>
 #include <vector>
 
 #include "gui/state/game/detection/game_install.h"
@@ -41,10 +44,31 @@ std::optional<std::filesystem::path> findGameInstallPath(
     const std::filesystem::path& rootInstallPath,
     const std::vector<std::string>& preferredUILanguages);
 
+// Maps EGS AppNames to install locations. The index is built by reading
+// each manifest file in the EGS manifests folder once, so that looking up
+// each game doesn't involve reading any files. If a stop flag is given,
+// indexing stops early once it is set.
+class EgsManifestIndex {
+public:
+  explicit EgsManifestIndex(const RegistryInterface& registry,
+                            const std::atomic<bool>* stopFlag = nullptr);
+
+  std::optional<std::filesystem::path> getInstallLocation(
+      const GameId gameId) const;
+
+private:
+  std::map<std::string, std::filesystem::path> installLocations_;
+};
+
 std::optional<GameInstall> findGameInstalls(
     const RegistryInterface& registry,
     const GameId gameId,
     const std::vector<std::string>& preferredUILanguages);
+
+std::optional<GameInstall> findGameInstalls(
+    const EgsManifestIndex& index,
+    const GameId gameId,
+    const std::vector<std::string>& preferredUILanguages);
 }
 
 #endif
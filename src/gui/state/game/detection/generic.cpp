@@ -26,6 +26,7 @@
 #include <loot/enum/game_type.h>
 
 #include "gui/helpers.h"
+#include "gui/state/game/detection/cache.h"
 #include "gui/state/game/detection/common.h"
 #include "gui/state/game/detection/game_install.h"
 #include "gui/state/game/detection/gog.h"
@@ -114,13 +115,21 @@ std::vector<RegistryValue> getRegistryValues(const GameId gameId) {
   }
 }
 
+// An install's source is identified by the files in it, so the files that
+// are checked affect the detection results.
+bool installFileExists(const std::filesystem::path& path) {
+  loot::recordDetectionInput(path);
+
+  return std::filesystem::exists(path);
+}
+
 bool isSteamInstall(const GameId gameId,
                     const std::filesystem::path& installPath) {
   switch (gameId) {
     case GameId::tes3:
-      return std::filesystem::exists(installPath / "steam_autocloud.vdf");
+      return installFileExists(installPath / "steam_autocloud.vdf");
     case GameId::nehrim:
-      return std::filesystem::exists(installPath / "steam_api.dll");
+      return installFileExists(installPath / "steam_api.dll");
     case GameId::tes5:
     case GameId::tes5vr:
     case GameId::fo4vr:
@@ -134,15 +143,15 @@ bool isSteamInstall(const GameId gameId,
     case GameId::fonv:
     case GameId::fo4:
       // Most games have an installscript.vdf file in their Steam install.
-      return std::filesystem::exists(installPath / "installscript.vdf");
+      return installFileExists(installPath / "installscript.vdf");
     case GameId::starfield:
-      return std::filesystem::exists(installPath / "steam_api64.dll");
+      return installFileExists(installPath / "steam_api64.dll");
     case GameId::openmw:
       return false;
     case GameId::oblivionRemastered:
-      return std::filesystem::exists(installPath / "Engine" / "Binaries" /
-                                     "ThirdParty" / "Steamworks" / "Steamv153" /
-                                     "Win64" / "steam_api64.dll");
+      return installFileExists(installPath / "Engine" / "Binaries" /
+                               "ThirdParty" / "Steamworks" / "Steamv153" /
+                               "Win64" / "steam_api64.dll");
     default:
       throw std::logic_error("Unrecognised game ID");
   }
@@ -156,7 +165,7 @@ bool isGogInstall(const GameId gameId,
     const auto iconPath =
         installPath / std::filesystem::u8path("goggame-" + gogGameId + ".ico");
 
-    if (std::filesystem::exists(iconPath)) {
+    if (installFileExists(iconPath)) {
       return true;
     }
   }
@@ -168,11 +177,11 @@ bool isEpicInstall(const GameId gameId,
                    const std::filesystem::path& installPath) {
   switch (gameId) {
     case GameId::tes5se:
-      return std::filesystem::exists(installPath / "EOSSDK-Win64-Shipping.dll");
+      return installFileExists(installPath / "EOSSDK-Win64-Shipping.dll");
     case GameId::fo3:
-      return std::filesystem::exists(installPath / "FalloutLauncherEpic.exe");
+      return installFileExists(installPath / "FalloutLauncherEpic.exe");
     case GameId::fonv:
-      return std::filesystem::exists(installPath / "EOSSDK-Win32-Shipping.dll");
+      return installFileExists(installPath / "EOSSDK-Win32-Shipping.dll");
     case GameId::tes3:
     case GameId::tes4:
     case GameId::nehrim:
@@ -200,13 +209,12 @@ bool isMicrosoftInstall(const GameId gameId,
     case GameId::fonv:
       // tes3, tes4, fo3 and fonv install paths are localised, with the
       // appxmanifest.xml file sitting in the parent directory.
-      return std::filesystem::exists(installPath.parent_path() /
-                                     "appxmanifest.xml");
+      return installFileExists(installPath.parent_path() / "appxmanifest.xml");
     case GameId::tes5se:
     case GameId::fo4:
     case GameId::starfield:
     case GameId::oblivionRemastered:
-      return std::filesystem::exists(installPath / "appxmanifest.xml");
+      return installFileExists(installPath / "appxmanifest.xml");
     case GameId::nehrim:
     case GameId::tes5:
     case GameId::tes5vr:
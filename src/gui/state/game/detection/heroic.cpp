@@ -32,6 +32,7 @@
 #include <functional>
 
 #include "gui/helpers.h"
+#include "gui/state/game/detection/cache.h"
 #include "gui/state/game/detection/common.h"
 #include "gui/state/game/detection/epic_games_store.h"
 #include "gui/state/game/detection/gog.h"
@@ -119,6 +120,8 @@ std::filesystem::path getUserConfigPath() {
 }
 
 QJsonObject readJsonObjectFromFile(const std::filesystem::path& path) {
+  loot::recordDetectionInput(path);
+
   if (!std::filesystem::exists(path)) {
     // No point trying to read it, this silences a QIODevice::read error that Qt
     // prints to stdout.
@@ -28,6 +28,7 @@
 #include <vdf_parser.hpp>
 
 #include "gui/helpers.h"
+#include "gui/state/game/detection/cache.h"
 #include "gui/state/game/detection/common.h"
 #include "gui/state/game/detection/registry.h"
 #include "gui/state/logging.h"
@@ -307,6 +308,8 @@ std::vector<std::filesystem::path> getSteamLibraryPaths(
 
   try {
     const auto vdfPath = steamInstallPath / "config" / "libraryfolders.vdf";
+    recordDetectionInput(vdfPath);
+
     if (logger) {
       logger->trace("Reading libraryfolders.vdf file at {}",
                     vdfPath.u8string());
@@ -369,6 +372,8 @@ std::optional<GameInstall> findGameInstall(
   const auto logger = getLogger();
 
   try {
+    recordDetectionInput(steamAppManifestPath);
+
     if (!std::filesystem::exists(steamAppManifestPath)) {
       // Avoid logging unnecessary warnings.
       if (logger) {
@@ -504,4 +509,48 @@ std::vector<GameInstall> findGameInstalls(const RegistryInterface& registry,
 
   return installs;
 }
+
+SteamLibraryIndex::SteamLibraryIndex(
+    const std::vector<std::filesystem::path>& steamLibraryPaths,
+    const std::atomic<bool>* stopFlag) {
+  for (const auto& libraryPath : steamLibraryPaths) {
+    if (stopFlag != nullptr && stopFlag->load()) {
+      return;
+    }
+
+    for (const auto& [appId, gameId] : STEAM_GAME_ID_MAP) {
+      const auto manifestPath =
+          libraryPath / "steamapps" /
+          std::filesystem::u8path("appmanifest_" + appId + ".acf");
+
+      const auto install = findGameInstall(manifestPath);
+      if (install.has_value()) {
+        installsByAppId_[appId].push_back(install.value());
+      }
+    }
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->debug(
+        "Indexed Steam app manifests for {} supported apps across {} "
+        "libraries.",
+        installsByAppId_.size(),
+        steamLibraryPaths.size());
+  }
+}
+
+std::vector<GameInstall> SteamLibraryIndex::findGameInstalls(
+    const GameId gameId) const {
+  std::vector<GameInstall> installs;
+
+  for (const auto& appId : getSteamGameIds(gameId)) {
+    const auto it = installsByAppId_.find(appId);
+    if (it != installsByAppId_.end()) {
+      installs.insert(installs.end(), it->second.begin(), it->second.end());
+    }
+  }
+
+  return installs;
+}
 }
@@ -24,6 +24,9 @@
 #ifndef LOOT_GUI_STATE_GAME_DETECTION_STEAM
 #define LOOT_GUI_STATE_GAME_DETECTION_STEAM
 
+#include <atomic>
+#include <map>
+#include <string>
 #include <vector>
 
 #include "gui/state/game/detection/game_install.h"
@@ -52,6 +55,25 @@ std::optional<GameInstall> findGameInstall(
 
 std::vector<GameInstall> findGameInstalls(const RegistryInterface& registry,
                                           const GameId gameId);
+
+// Maps the Steam app IDs of supported games to the installs described by
+// their app manifests. The index is built in one pass over the given
+// libraries, reading each app manifest once, so that looking up each game
+// doesn't involve reading any files. If a stop flag is given, indexing stops
+// early once it is set.
+class SteamLibraryIndex {
+public:
+  explicit SteamLibraryIndex(
+      const std::vector<std::filesystem::path>& steamLibraryPaths,
+      const std::atomic<bool>* stopFlag = nullptr);
+
+  // Get the installs of the given game, in the order of the libraries that
+  // the index was built from.
+  std::vector<GameInstall> findGameInstalls(const GameId gameId) const;
+
+private:
+  std::map<std::string, std::vector<GameInstall>> installsByAppId_;
+};
 }
 
 #endif
@@ -50,10 +50,12 @@
 #include <fmt/ranges.h>
 
 #include "gui/helpers.h"
+#include "gui/state/game/game_snapshot.h"
 #include "gui/state/game/helpers.h"
 #include "gui/state/game/validation.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
+#include "gui/state/tracing.h"
 #include "gui/translate.h"
 #include "loot/exception/undefined_group_error.h"
 
@@ -66,6 +68,8 @@ namespace fs = std::filesystem;
 namespace {
 using loot::Filename;
 using loot::GameId;
+using loot::gui::FileStamp;
+using loot::gui::FileStamps;
 using loot::GameType;
 using loot::getLogger;
 using loot::Group;
@@ -194,6 +198,52 @@ bool supportsLightPlugins(GameId gameId,
          gameId == GameId::fo4 || gameId == GameId::starfield;
 }
 
+FileStamp getFileStamp(const std::filesystem::path& path) {
+  FileStamp stamp;
+
+  std::error_code ec;
+  const auto size = std::filesystem::file_size(path, ec);
+  if (ec) {
+    return stamp;
+  }
+
+  const auto modificationTime = std::filesystem::last_write_time(path, ec);
+  if (ec) {
+    return stamp;
+  }
+
+  stamp.size = size;
+  stamp.modificationTime = modificationTime;
+
+  return stamp;
+}
+
+FileStamps getFileStamps(const std::vector<std::filesystem::path>& paths) {
+  FileStamps stamps;
+  for (const auto& path : paths) {
+    stamps.emplace(path, getFileStamp(path));
+  }
+
+  return stamps;
+}
+
+bool haveSameKeys(const FileStamps& lhs, const FileStamps& rhs) {
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.begin(),
+                    lhs.end(),
+                    rhs.begin(),
+                    [](const auto& left, const auto& right) {
+                      return left.first == right.first;
+                    });
+}
+
+SourcedMessage createUnsortedLoadOrderMessage() {
+  return createPlainTextSourcedMessage(
+      MessageType::warn,
+      MessageSource::unsortedLoadOrderCheck,
+      translate("You have not sorted your load order this session."));
+}
+
 SourcedMessage createSortingCyclicInteractionErrorMessage(
     const loot::CyclicInteractionError& e) {
   const auto logger = getLogger();
@@ -846,12 +896,31 @@ bool CreationClubPlugins::isCreationClubPlugin(std::string_view name) const {
 }
 
 namespace gui {
+bool FileStamp::operator==(const FileStamp& other) const {
+  return size == other.size && modificationTime == other.modificationTime;
+}
+
+bool FileStamp::operator!=(const FileStamp& other) const {
+  return !(*this == other);
+}
+
+bool GameDataChanges::hasChanges() const {
+  return pluginsAddedOrRemoved || !modifiedPlugins.empty() ||
+         metadataChanged || loadOrderChanged;
+}
+
+bool GameDataChanges::onlyPluginsModified() const {
+  return !pluginsAddedOrRemoved && !modifiedPlugins.empty() &&
+         !metadataChanged && !loadOrderChanged;
+}
+
 Game::Game(const GameSettings& gameSettings,
            const std::filesystem::path& lootDataPath,
            const std::filesystem::path& preludePath) :
     settings_(gameSettings),
     lootDataPath_(lootDataPath),
     preludePath_(preludePath),
+    snapshot_(std::make_shared<const GameSnapshot>()),
     supportsLightPlugins_(
         ::supportsLightPlugins(settings_.getId(), settings_.getDataPath())) {}
 
@@ -863,8 +932,15 @@ Game::Game(Game&& game) noexcept {
   lootDataPath_ = std::move(game.lootDataPath_);
   preludePath_ = std::move(game.preludePath_);
   sortCount_ = std::move(game.sortCount_);
+  snapshotLanguage_ = std::move(game.snapshotLanguage_);
+  snapshotDatabaseMessages_ = std::move(game.snapshotDatabaseMessages_);
+  snapshotPluginCountMessages_ = std::move(game.snapshotPluginCountMessages_);
+  snapshot_ = std::move(game.snapshot_);
   pluginsFullyLoaded_ = std::move(game.pluginsFullyLoaded_);
   supportsLightPlugins_ = std::move(game.supportsLightPlugins_);
+  pluginStamps_ = std::move(game.pluginStamps_);
+  masterlistStamps_ = std::move(game.masterlistStamps_);
+  userlistStamps_ = std::move(game.userlistStamps_);
 }
 
 Game& Game::operator=(Game&& game) noexcept {
@@ -876,8 +952,16 @@ Game& Game::operator=(Game&& game) noexcept {
     lootDataPath_ = std::move(game.lootDataPath_);
     preludePath_ = std::move(game.preludePath_);
     sortCount_ = std::move(game.sortCount_);
+    snapshotLanguage_ = std::move(game.snapshotLanguage_);
+    snapshotDatabaseMessages_ = std::move(game.snapshotDatabaseMessages_);
+    snapshotPluginCountMessages_ =
+        std::move(game.snapshotPluginCountMessages_);
+    snapshot_ = std::move(game.snapshot_);
     pluginsFullyLoaded_ = std::move(game.pluginsFullyLoaded_);
     supportsLightPlugins_ = std::move(game.supportsLightPlugins_);
+    pluginStamps_ = std::move(game.pluginStamps_);
+    masterlistStamps_ = std::move(game.masterlistStamps_);
+    userlistStamps_ = std::move(game.userlistStamps_);
   }
 
   return *this;
@@ -903,12 +987,30 @@ void Game::init() {
   }
 
   // Reset data that is dependent on the libloot game handle.
-  messages_.clear();
-  sortCount_.reset();
+  {
+    lock_guard<mutex> guard(messagesMutex_);
+    messages_.clear();
+    sortCount_.reset();
+    snapshotDatabaseMessages_.clear();
+    snapshotPluginCountMessages_.clear();
+
+    updateSnapshot([](GameSnapshot& snapshot) {
+      snapshot.loadOrder.clear();
+      snapshot.pluginItems.clear();
+      snapshot.generalMessages = {createUnsortedLoadOrderMessage()};
+    });
+  }
   pluginsFullyLoaded_ = false;
   supportsLightPlugins_ =
       ::supportsLightPlugins(settings_.getId(), settings_.getDataPath());
 
+  {
+    lock_guard<mutex> guard(fileStampsMutex_);
+    pluginStamps_.clear();
+    masterlistStamps_.clear();
+    userlistStamps_.clear();
+  }
+
   gameHandle_ = CreateGameHandle(getGameType(settings_.getId()),
                                  settings_.getGamePath(),
                                  settings_.getGameLocalPath());
@@ -918,6 +1020,137 @@ void Game::init() {
 
 bool Game::isInitialised() const { return gameHandle_ != nullptr; }
 
+void Game::unload() {
+  auto logger = getLogger();
+  if (logger) {
+    logger->info("Unloading data for game: {}", settings_.getName());
+  }
+
+  {
+    lock_guard<mutex> guard(messagesMutex_);
+    messages_.clear();
+    sortCount_.reset();
+    snapshotDatabaseMessages_.clear();
+    snapshotPluginCountMessages_.clear();
+
+    updateSnapshot([](GameSnapshot& snapshot) {
+      snapshot.loadOrder.clear();
+      snapshot.pluginItems.clear();
+      snapshot.generalMessages = {createUnsortedLoadOrderMessage()};
+    });
+  }
+  pluginsFullyLoaded_ = false;
+
+  {
+    lock_guard<mutex> guard(fileStampsMutex_);
+    pluginStamps_.clear();
+    masterlistStamps_.clear();
+    userlistStamps_.clear();
+  }
+
+  gameHandle_.reset();
+}
+
+size_t Game::estimateMemoryUsage() const {
+  // Parsed metadata takes up a few times the space of the YAML that it was
+  // parsed from, a plugin that's only had its header loaded and its derived
+  // item take up a roughly fixed amount, and a fully loaded plugin also holds
+  // on to its records.
+  static constexpr uintmax_t METADATA_SIZE_MULTIPLIER = 4;
+  static constexpr uintmax_t BYTES_PER_PLUGIN = 16 * 1024;
+
+  if (!isInitialised()) {
+    return 0;
+  }
+
+  lock_guard<mutex> guard(fileStampsMutex_);
+
+  uintmax_t metadataSize = 0;
+  for (const auto* stamps : {&masterlistStamps_, &userlistStamps_}) {
+    for (const auto& [path, stamp] : *stamps) {
+      metadataSize += stamp.size.value_or(0);
+    }
+  }
+
+  uintmax_t pluginsSize = pluginStamps_.size() * BYTES_PER_PLUGIN;
+  if (pluginsFullyLoaded_) {
+    for (const auto& [path, stamp] : pluginStamps_) {
+      pluginsSize += stamp.size.value_or(0);
+    }
+  }
+
+  return static_cast<size_t>(metadataSize * METADATA_SIZE_MULTIPLIER +
+                             pluginsSize);
+}
+
+GameDataChanges Game::reloadChangedData() {
+  loadCurrentLoadOrderState();
+
+  const auto installedPluginPaths = getInstalledPluginPaths();
+  const auto currentPluginStamps = getFileStamps(installedPluginPaths);
+  const auto currentMasterlistStamps = getFileStamps(getMasterlistPaths());
+  const auto currentUserlistStamps = getFileStamps({getUserlistPath()});
+
+  GameDataChanges changes;
+  std::vector<std::filesystem::path> changedPluginPaths;
+  {
+    lock_guard<mutex> guard(fileStampsMutex_);
+
+    changes.pluginsAddedOrRemoved =
+        !haveSameKeys(pluginStamps_, currentPluginStamps);
+    if (!changes.pluginsAddedOrRemoved) {
+      for (const auto& [path, stamp] : currentPluginStamps) {
+        if (pluginStamps_.at(path) != stamp) {
+          changedPluginPaths.push_back(path);
+          changes.modifiedPlugins.push_back(path.filename().u8string());
+        }
+      }
+    }
+
+    changes.metadataChanged = masterlistStamps_ != currentMasterlistStamps ||
+                              userlistStamps_ != currentUserlistStamps;
+  }
+
+  if (changes.pluginsAddedOrRemoved) {
+    loadAllInstalledPlugins(true);
+  } else if (!changedPluginPaths.empty()) {
+    // Only the changed plugins' headers are reloaded, so other plugins may
+    // still be fully loaded but not all of them are.
+    {
+      TraceSpan span("libloot", "LoadPlugins");
+      gameHandle_->LoadPlugins(changedPluginPaths, true);
+    }
+    pluginsFullyLoaded_ = false;
+
+    lock_guard<mutex> guard(fileStampsMutex_);
+    for (const auto& path : changedPluginPaths) {
+      pluginStamps_[path] = currentPluginStamps.at(path);
+    }
+  }
+
+  if (changes.metadataChanged) {
+    loadMetadata();
+  }
+
+  const auto snapshot = getSnapshot();
+  changes.loadOrderChanged =
+      snapshot == nullptr || snapshot->loadOrder != getLoadOrder();
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->debug(
+        "Checked {} for changes: plugins added or removed: {}, plugins "
+        "changed: {}, metadata changed: {}, load order changed: {}",
+        settings_.getName(),
+        changes.pluginsAddedOrRemoved,
+        changes.modifiedPlugins.size(),
+        changes.metadataChanged,
+        changes.loadOrderChanged);
+  }
+
+  return changes;
+}
+
 std::unique_ptr<const PluginInterface> Game::getPlugin(
     const std::string& name) const {
   return gameHandle_->GetPlugin(name);
@@ -991,8 +1224,12 @@ void Game::loadAllInstalledPlugins(bool headersOnly) {
   loadCurrentLoadOrderState();
 
   const auto installedPluginPaths = getInstalledPluginPaths();
+  recordFileStamps(pluginStamps_, installedPluginPaths);
   gameHandle_->ClearLoadedPlugins();
-  gameHandle_->LoadPlugins(installedPluginPaths, headersOnly);
+  {
+    TraceSpan span("libloot", "LoadPlugins");
+    gameHandle_->LoadPlugins(installedPluginPaths, headersOnly);
+  }
 
   // Check if any plugins have been removed.
   std::vector<std::string> installedPluginNames;
@@ -1053,6 +1290,9 @@ std::vector<std::string> Game::getLoadOrder() const {
 void Game::setLoadOrder(const std::vector<std::string>& loadOrder) {
   backupLoadOrder(getLoadOrder(), getBackupsPath());
   gameHandle_->SetLoadOrder(loadOrder);
+
+  updateSnapshot(
+      [&](GameSnapshot& snapshot) { snapshot.loadOrder = loadOrder; });
 }
 
 std::string Game::getLoadOrderAsTextTable() const {
@@ -1123,8 +1363,16 @@ std::vector<std::string> Game::sortPlugins() {
       }
     }
 
-    gameHandle_->LoadPlugins(pluginPaths, false);
-    auto sortedPlugins = gameHandle_->SortPlugins(loadOrder);
+    {
+      TraceSpan span("libloot", "LoadPlugins");
+      gameHandle_->LoadPlugins(pluginPaths, false);
+    }
+
+    std::vector<std::string> sortedPlugins;
+    {
+      TraceSpan span("libloot", "SortPlugins");
+      sortedPlugins = gameHandle_->SortPlugins(loadOrder);
+    }
 
     // Remove existing "removed plugin" messages before rechecking to avoid
     // duplication.
@@ -1133,7 +1381,7 @@ std::vector<std::string> Game::sortPlugins() {
     appendMessages(createMessagesForRemovedPlugins(
         checkForRemovedPlugins(loadOrder, sortedPlugins)));
 
-    sortCount_.increment();
+    incrementSortCount();
 
     return sortedPlugins;
   } catch (CyclicInteractionError& e) {
@@ -1162,51 +1410,87 @@ std::vector<std::string> Game::sortPlugins() {
   return {};
 }
 
-ChangeCount& Game::getSortCount() { return sortCount_; }
+void Game::incrementSortCount() {
+  lock_guard<mutex> guard(messagesMutex_);
+  sortCount_.increment();
+  updateSnapshotMessages();
+}
+
+void Game::decrementSortCount() {
+  lock_guard<mutex> guard(messagesMutex_);
+  sortCount_.decrement();
+  updateSnapshotMessages();
+}
 
 std::vector<SourcedMessage> Game::getMessages(
     std::string_view language,
     bool warnOnCaseSensitivePaths) const {
-  std::vector<SourcedMessage> output(toSourcedMessages(
-      gameHandle_->GetDatabase().GetGeneralMessages(true, true),
-      MessageSource::messageMetadata,
-      language));
-
-  output.insert(end(output), begin(messages_), end(messages_));
+  const auto databaseMessages = getDatabaseGeneralMessages(language);
+  const auto pluginCountMessages = getActivePluginCountMessages();
 
-  if (sortCount_.isZero()) {
-    output.push_back(createPlainTextSourcedMessage(
-        MessageType::warn,
-        MessageSource::unsortedLoadOrderCheck,
-        translate("You have not sorted your load order this session.")));
+  std::vector<SourcedMessage> output;
+  {
+    lock_guard<mutex> guard(messagesMutex_);
+    output = composeGeneralMessages(databaseMessages, pluginCountMessages);
   }
 
-  Counters counters;
+  appendGamePathMessages(output, warnOnCaseSensitivePaths);
 
-  for (const auto& plugin : getPlugins()) {
-    if (isPluginActive(plugin->GetName())) {
-      if (plugin->IsLightPlugin()) {
-        ++counters.activeLightPlugins;
-      } else if (plugin->IsMediumPlugin()) {
-        ++counters.activeMediumPlugins;
+  return output;
+}
+
+std::shared_ptr<const GameSnapshot> Game::getSnapshot() const {
+  lock_guard<mutex> guard(snapshotMutex_);
+  return snapshot_;
+}
+
+std::string Game::getSnapshotLanguage() const {
+  lock_guard<mutex> guard(messagesMutex_);
+  return snapshotLanguage_;
+}
+
+void Game::publishSnapshot(std::vector<PluginItem> pluginItems,
+                           std::string_view language) {
+  auto loadOrder = getLoadOrder();
+  auto databaseMessages = getDatabaseGeneralMessages(language);
+  auto pluginCountMessages = getActivePluginCountMessages();
+
+  lock_guard<mutex> guard(messagesMutex_);
+  snapshotLanguage_ = language;
+  snapshotDatabaseMessages_ = std::move(databaseMessages);
+  snapshotPluginCountMessages_ = std::move(pluginCountMessages);
+  auto generalMessages = composeGeneralMessages(snapshotDatabaseMessages_,
+                                                snapshotPluginCountMessages_);
+
+  updateSnapshot([&](GameSnapshot& snapshot) {
+    snapshot.loadOrder = std::move(loadOrder);
+    snapshot.pluginItems = std::move(pluginItems);
+    snapshot.generalMessages = std::move(generalMessages);
+  });
+}
+
+void Game::publishSnapshotUpdate(const std::vector<PluginItem>& pluginItems) {
+  updateSnapshot([&](GameSnapshot& snapshot) {
+    for (const auto& pluginItem : pluginItems) {
+      const auto it = std::find_if(snapshot.pluginItems.begin(),
+                                   snapshot.pluginItems.end(),
+                                   [&](const PluginItem& item) {
+                                     return item.name == pluginItem.name;
+                                   });
+      if (it != snapshot.pluginItems.end()) {
+        *it = pluginItem;
       } else {
-        ++counters.activeFullPlugins;
+        snapshot.pluginItems.push_back(pluginItem);
       }
     }
-  }
-
-  const auto isMWSEInstalled =
-      settings_.getId() == GameId::tes3 &&
-      std::filesystem::exists(settings_.getGamePath() / "MWSE.dll");
+  });
+}
 
-  validateActivePluginCounts(
-      output, settings_.getId(), counters, isMWSEInstalled);
+std::vector<SourcedMessage> Game::getGeneralMessages(
+    bool warnOnCaseSensitivePaths) const {
+  auto output = getSnapshot()->generalMessages;
 
-  validateGamePaths(output,
-                    settings_.getName(),
-                    settings_.getDataPath(),
-                    settings_.getGameLocalPath(),
-                    warnOnCaseSensitivePaths);
+  appendGamePathMessages(output, warnOnCaseSensitivePaths);
 
   return output;
 }
@@ -1218,6 +1502,56 @@ void Game::loadMetadata() {
 
   const auto oldMasterlistGroups = getMasterlistGroups();
 
+  loadMasterlist();
+  loadUserlist();
+
+  const auto newMasterlistGroups = getMasterlistGroups();
+
+  const auto removedGroupNames =
+      getRemovedGroups(oldMasterlistGroups, newMasterlistGroups);
+
+  if (!removedGroupNames.empty()) {
+    auto recovered =
+        recoverRemovedGroups(*this, oldMasterlistGroups, removedGroupNames);
+
+    std::vector<std::pair<std::string, std::string>> recoveredGroups(
+        recovered.begin(), recovered.end());
+
+    std::sort(recoveredGroups.begin(), recoveredGroups.end());
+
+    for (const auto& [oldName, newName] : recoveredGroups) {
+      if (logger) {
+        logger->debug(
+            "The group \"{}\" was removed from the masterlist but referenced "
+            "by user metadata. It has been renamed to \"{}\" and has been "
+            "added to the userlist.",
+            oldName,
+            newName);
+      }
+
+      appendMessage(SourcedMessage{
+          MessageType::warn,
+          MessageSource::recoveredGroup,
+          fmt::format(
+              translate(
+                  "The group \"{0}\" has been removed from the masterlist but "
+                  "was referenced by user metadata. It has been renamed to "
+                  "\"{1}\" and reintroduced as a user group."),
+              oldName,
+              newName)});
+    }
+  }
+
+  checkForRecoveredGroups();
+}
+
+void Game::loadMasterlist() {
+  const auto logger = getLogger();
+
+  // Record the stamps before loading so that any changes made while loading
+  // are detected later.
+  recordFileStamps(masterlistStamps_, getMasterlistPaths());
+
   try {
     const auto masterlistPath = getMasterlistPath();
     if (std::filesystem::exists(masterlistPath)) {
@@ -1225,12 +1559,14 @@ void Game::loadMetadata() {
         if (logger) {
           logger->debug("Parsing the prelude and masterlist.");
         }
+        TraceSpan span("libloot", "LoadMasterlistWithPrelude");
         gameHandle_->GetDatabase().LoadMasterlistWithPrelude(masterlistPath,
                                                              preludePath_);
       } else {
         if (logger) {
           logger->debug("Parsing the masterlist.");
         }
+        TraceSpan span("libloot", "LoadMasterlist");
         gameHandle_->GetDatabase().LoadMasterlist(masterlistPath);
       }
     }
@@ -1249,6 +1585,12 @@ void Game::loadMetadata() {
             escapeMarkdownASCIIPunctuation(e.what()),
             "https://loot.github.io/")});
   }
+}
+
+void Game::loadUserlist() {
+  const auto logger = getLogger();
+
+  recordFileStamps(userlistStamps_, {getUserlistPath()});
 
   try {
     const auto userlistPath = getUserlistPath();
@@ -1287,45 +1629,6 @@ void Game::loadMetadata() {
             escapeMarkdownASCIIPunctuation(e.what()),
             docUrl)});
   }
-
-  const auto newMasterlistGroups = getMasterlistGroups();
-
-  const auto removedGroupNames =
-      getRemovedGroups(oldMasterlistGroups, newMasterlistGroups);
-
-  if (!removedGroupNames.empty()) {
-    auto recovered =
-        recoverRemovedGroups(*this, oldMasterlistGroups, removedGroupNames);
-
-    std::vector<std::pair<std::string, std::string>> recoveredGroups(
-        recovered.begin(), recovered.end());
-
-    std::sort(recoveredGroups.begin(), recoveredGroups.end());
-
-    for (const auto& [oldName, newName] : recoveredGroups) {
-      if (logger) {
-        logger->debug(
-            "The group \"{}\" was removed from the masterlist but referenced "
-            "by user metadata. It has been renamed to \"{}\" and has been "
-            "added to the userlist.",
-            oldName,
-            newName);
-      }
-
-      appendMessage(SourcedMessage{
-          MessageType::warn,
-          MessageSource::recoveredGroup,
-          fmt::format(
-              translate(
-                  "The group \"{0}\" has been removed from the masterlist but "
-                  "was referenced by user metadata. It has been renamed to "
-                  "\"{1}\" and reintroduced as a user group."),
-              oldName,
-              newName)});
-    }
-  }
-
-  checkForRecoveredGroups();
 }
 
 void Game::checkForRecoveredGroups() {
@@ -1339,18 +1642,20 @@ void Game::checkForRecoveredGroups() {
   }
 
   // Remove recovered group messages for group names that are no longer present.
-  auto it = std::remove_if(
-      messages_.begin(), messages_.end(), [&](const SourcedMessage& message) {
-        return message.source == MessageSource::recoveredGroup &&
-               std::none_of(recoveredGroupNames.begin(),
-                            recoveredGroupNames.end(),
-                            [&](const std::string& groupName) {
-                              return boost::contains(message.text,
-                                                     "\"" + groupName + "\"");
-                            });
-      });
-
-  messages_.erase(it, messages_.end());
+  updateMessages([&](std::vector<SourcedMessage>& messages) {
+    auto it = std::remove_if(
+        messages.begin(), messages.end(), [&](const SourcedMessage& message) {
+          return message.source == MessageSource::recoveredGroup &&
+                 std::none_of(recoveredGroupNames.begin(),
+                              recoveredGroupNames.end(),
+                              [&](const std::string& groupName) {
+                                return boost::contains(
+                                    message.text, "\"" + groupName + "\"");
+                              });
+        });
+
+    messages.erase(it, messages.end());
+  });
 
   // Remove and regenerate the generic recovered group message if needed.
   removeMessagesFrom({MessageSource::recoveredGroupDetected});
@@ -1446,6 +1751,10 @@ void Game::saveUserMetadata() {
   MetadataWriteOptions options;
   options.SetTruncate(true);
   gameHandle_->GetDatabase().WriteUserMetadata(getUserlistPath(), options);
+
+  // The loaded user metadata is what was just written, so there's no need to
+  // reload it.
+  recordFileStamps(userlistStamps_, {getUserlistPath()});
 }
 
 std::filesystem::path Game::getLOOTGamePath() const {
@@ -1457,6 +1766,8 @@ std::filesystem::path Game::getBackupsPath() const {
 }
 
 std::vector<std::filesystem::path> Game::getInstalledPluginPaths() const {
+  TraceSpan span("filesystem", "Find installed plugins");
+
   // Checking to see if a plugin is valid is relatively slow, almost entirely
   // due to blocking on opening the file, so instead just add all the files
   // found to a buffer and then check if they're valid plugins in parallel.
@@ -1508,16 +1819,121 @@ std::vector<std::filesystem::path> Game::getInstalledPluginPaths() const {
 }
 
 void Game::appendMessages(const std::vector<SourcedMessage>& messages) {
-  messages_.insert(messages_.end(), messages.begin(), messages.end());
+  updateMessages([&](std::vector<SourcedMessage>& existingMessages) {
+    existingMessages.insert(
+        existingMessages.end(), messages.begin(), messages.end());
+  });
 }
 
 void Game::removeMessagesFrom(const std::set<MessageSource>& sources) {
-  auto it = std::remove_if(
-      messages_.begin(), messages_.end(), [&](const SourcedMessage& message) {
-        return sources.count(message.source) != 0;
-      });
+  updateMessages([&](std::vector<SourcedMessage>& existingMessages) {
+    auto it = std::remove_if(existingMessages.begin(),
+                             existingMessages.end(),
+                             [&](const SourcedMessage& message) {
+                               return sources.count(message.source) != 0;
+                             });
+
+    existingMessages.erase(it, existingMessages.end());
+  });
+}
+
+void Game::updateMessages(
+    const std::function<void(std::vector<SourcedMessage>&)>& update) {
+  lock_guard<mutex> guard(messagesMutex_);
+  update(messages_);
+
+  updateSnapshotMessages();
+}
+
+void Game::updateSnapshot(const std::function<void(GameSnapshot&)>& update) {
+  lock_guard<mutex> guard(snapshotMutex_);
+
+  auto snapshot = std::make_shared<GameSnapshot>(*snapshot_);
+  snapshot->version = snapshot_->version + 1;
+  update(*snapshot);
+
+  snapshot_ = std::move(snapshot);
+}
+
+// messagesMutex_ must be locked while this is called.
+void Game::updateSnapshotMessages() {
+  // Reuse the messages that were derived when the snapshot was last
+  // published, as deriving them again reads the game's plugins and metadata.
+  auto generalMessages = composeGeneralMessages(snapshotDatabaseMessages_,
+                                                snapshotPluginCountMessages_);
+
+  updateSnapshot([&](GameSnapshot& snapshot) {
+    snapshot.generalMessages = std::move(generalMessages);
+  });
+}
+
+std::vector<SourcedMessage> Game::getDatabaseGeneralMessages(
+    std::string_view language) const {
+  if (!isInitialised()) {
+    return {};
+  }
+
+  return toSourcedMessages(
+      gameHandle_->GetDatabase().GetGeneralMessages(true, true),
+      MessageSource::messageMetadata,
+      language);
+}
+
+std::vector<SourcedMessage> Game::getActivePluginCountMessages() const {
+  if (!isInitialised()) {
+    return {};
+  }
+
+  Counters counters;
+
+  for (const auto& plugin : getPlugins()) {
+    if (isPluginActive(plugin->GetName())) {
+      if (plugin->IsLightPlugin()) {
+        ++counters.activeLightPlugins;
+      } else if (plugin->IsMediumPlugin()) {
+        ++counters.activeMediumPlugins;
+      } else {
+        ++counters.activeFullPlugins;
+      }
+    }
+  }
+
+  const auto isMWSEInstalled =
+      settings_.getId() == GameId::tes3 &&
+      std::filesystem::exists(settings_.getGamePath() / "MWSE.dll");
 
-  messages_.erase(it, messages_.end());
+  std::vector<SourcedMessage> output;
+  validateActivePluginCounts(
+      output, settings_.getId(), counters, isMWSEInstalled);
+
+  return output;
+}
+
+// messagesMutex_ must be locked while this is called.
+std::vector<SourcedMessage> Game::composeGeneralMessages(
+    const std::vector<SourcedMessage>& databaseMessages,
+    const std::vector<SourcedMessage>& pluginCountMessages) const {
+  std::vector<SourcedMessage> output(databaseMessages);
+
+  output.insert(end(output), begin(messages_), end(messages_));
+
+  if (sortCount_.isZero()) {
+    output.push_back(createUnsortedLoadOrderMessage());
+  }
+
+  output.insert(
+      end(output), begin(pluginCountMessages), end(pluginCountMessages));
+
+  return output;
+}
+
+void Game::appendGamePathMessages(std::vector<SourcedMessage>& messages,
+                                  bool warnOnCaseSensitivePaths) const {
+  validateGamePaths(messages,
+                    settings_.getName(),
+                    settings_.getDataPath(),
+                    settings_.getGameLocalPath(),
+                    warnOnCaseSensitivePaths);
 }
 
 std::optional<std::filesystem::path> Game::resolveGameFilePath(
@@ -1533,7 +1949,21 @@ bool Game::fileExists(const std::string& filePath) const {
 }
 
 void Game::appendMessage(const SourcedMessage& message) {
-  messages_.push_back(message);
+  updateMessages([&](std::vector<SourcedMessage>& messages) {
+    messages.push_back(message);
+  });
+}
+
+std::vector<std::filesystem::path> Game::getMasterlistPaths() const {
+  return {getMasterlistPath(), preludePath_};
+}
+
+void Game::recordFileStamps(FileStamps& stamps,
+                            const std::vector<std::filesystem::path>& paths) {
+  auto newStamps = getFileStamps(paths);
+
+  lock_guard<mutex> guard(fileStampsMutex_);
+  stamps = std::move(newStamps);
 }
 
 void Game::loadCurrentLoadOrderState() {
@@ -39,6 +39,7 @@
 #include <execution>
 #include <filesystem>
 #include <functional>
+#include <map>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -80,7 +81,39 @@ private:
   std::set<Filename> creationClubPlugins_;
 };
 
+struct PluginItem;
+
 namespace gui {
+struct GameSnapshot;
+
+// The size and modification time of a file, which are used to detect if the
+// file has changed since data was loaded from it. The size is nullopt if the
+// file didn't exist.
+struct FileStamp {
+  std::optional<uintmax_t> size;
+  std::filesystem::file_time_type modificationTime;
+
+  bool operator==(const FileStamp& other) const;
+  bool operator!=(const FileStamp& other) const;
+};
+
+typedef std::map<std::filesystem::path, FileStamp> FileStamps;
+
+// What Game::reloadChangedData() found had changed since the game's data was
+// loaded and its last snapshot was published.
+struct GameDataChanges {
+  bool pluginsAddedOrRemoved{false};
+  // The names of plugins that were modified, if none were added or removed.
+  std::vector<std::string> modifiedPlugins;
+  bool metadataChanged{false};
+  bool loadOrderChanged{false};
+
+  bool hasChanges() const;
+  // Returns true if the only change was that some plugins were modified, so
+  // only their plugin items need to be derived again.
+  bool onlyPluginsModified() const;
+};
+
 class Game {
 public:
   Game(const GameSettings& gameSettings,
@@ -102,6 +135,19 @@ public:
   void init();
   bool isInitialised() const;
 
+  // Frees the game handle and everything loaded through it. The game must be
+  // initialised again before it can be used.
+  void unload();
+
+  // A rough estimate of the memory used by the game's loaded data.
+  size_t estimateMemoryUsage() const;
+
+  // Compares the game's plugins and metadata files with the stamps recorded
+  // when they were loaded, and reloads only those that have changed. Also
+  // reloads the current load order state. Returns what was reloaded, and
+  // whether the load order has changed since the last snapshot.
+  GameDataChanges reloadChangedData();
+
   std::unique_ptr<const PluginInterface> getPlugin(
       const std::string& name) const;
   std::vector<std::unique_ptr<const PluginInterface>> getPlugins() const;
@@ -139,13 +185,43 @@ public:
   bool isLoadOrderAmbiguous() const;
 
   std::vector<std::string> sortPlugins();
-  ChangeCount& getSortCount();
+  void incrementSortCount();
+  void decrementSortCount();
 
   std::vector<SourcedMessage> getMessages(std::string_view language,
                                           bool warnOnCaseSensitivePaths) const;
   void appendMessage(const SourcedMessage& message);
 
+  // Returns the most recently published snapshot. Snapshots never change once
+  // published, so they can be read while other threads change the game.
+  std::shared_ptr<const GameSnapshot> getSnapshot() const;
+
+  // Returns the language that the snapshot's messages were last derived in.
+  std::string getSnapshotLanguage() const;
+
+  // Publishes a new snapshot holding the given plugin items, with the load
+  // order and general messages derived from the game's current state.
+  void publishSnapshot(std::vector<PluginItem> pluginItems,
+                       std::string_view language);
+
+  // Publishes a new snapshot in which the items for the given plugins have
+  // been replaced, and everything else is unchanged.
+  void publishSnapshotUpdate(const std::vector<PluginItem>& pluginItems);
+
+  // Gets the general messages from the current snapshot, along with any game
+  // path warnings.
+  std::vector<SourcedMessage> getGeneralMessages(
+      bool warnOnCaseSensitivePaths) const;
+
+  // Loads the prelude, masterlist and userlist, recovering any groups that
+  // were removed from the masterlist but are still used by user metadata.
   void loadMetadata();
+
+  // Load the masterlist (with the prelude) or the userlist on their own,
+  // without clearing old parsing errors or recovering removed groups.
+  void loadMasterlist();
+  void loadUserlist();
+
   void checkForRecoveredGroups();
   std::vector<std::string> getKnownBashTags() const;
 
@@ -186,17 +262,57 @@ private:
   void appendMessages(const std::vector<SourcedMessage>& messages);
   void removeMessagesFrom(const std::set<MessageSource>& sources);
 
+  // Applies the update to the game's messages and publishes a snapshot with
+  // general messages in the same order as getMessages(). Metadata and active
+  // plugin count messages are only derived when publishSnapshot() is called.
+  void updateMessages(
+      const std::function<void(std::vector<SourcedMessage>&)>& update);
+  void updateSnapshot(const std::function<void(GameSnapshot&)>& update);
+  void updateSnapshotMessages();
+
+  std::vector<SourcedMessage> getDatabaseGeneralMessages(
+      std::string_view language) const;
+  std::vector<SourcedMessage> getActivePluginCountMessages() const;
+  std::vector<SourcedMessage> composeGeneralMessages(
+      const std::vector<SourcedMessage>& databaseMessages,
+      const std::vector<SourcedMessage>& pluginCountMessages) const;
+  void appendGamePathMessages(std::vector<SourcedMessage>& messages,
+                              bool warnOnCaseSensitivePaths) const;
+
   void loadCurrentLoadOrderState();
 
+  std::vector<std::filesystem::path> getMasterlistPaths() const;
+  void recordFileStamps(FileStamps& stamps,
+                        const std::vector<std::filesystem::path>& paths);
+
   GameSettings settings_;
   CreationClubPlugins creationClubPlugins_;
   std::unique_ptr<GameInterface> gameHandle_;
-  std::vector<SourcedMessage> messages_;
   std::filesystem::path lootDataPath_;
   std::filesystem::path preludePath_;
+
+  // Guards messages_ and sortCount_, and is always locked before
+  // snapshotMutex_ when both are needed.
+  mutable std::mutex messagesMutex_;
+  std::vector<SourcedMessage> messages_;
   ChangeCount sortCount_;
+  // The language that the snapshot's general messages were last derived in.
+  std::string snapshotLanguage_{MessageContent::DEFAULT_LANGUAGE};
+  // The messages derived when the snapshot was last published, which are
+  // reused when the snapshot's general messages are updated.
+  std::vector<SourcedMessage> snapshotDatabaseMessages_;
+  std::vector<SourcedMessage> snapshotPluginCountMessages_;
+
+  mutable std::mutex snapshotMutex_;
+  std::shared_ptr<const GameSnapshot> snapshot_;
   bool pluginsFullyLoaded_{false};
   bool supportsLightPlugins_{false};
+
+  // Guards the stamps of the files that the game's data was loaded from.
+  mutable std::mutex fileStampsMutex_;
+  FileStamps pluginStamps_;
+  FileStamps masterlistStamps_;
+  FileStamps userlistStamps_;
 };
 }
 
@@ -0,0 +1,56 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_GUI_STATE_GAME_GAME_SNAPSHOT
+#define LOOT_GUI_STATE_GAME_GAME_SNAPSHOT
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gui/plugin_item.h"
+#include "gui/sourced_message.h"
+
+namespace loot {
+namespace gui {
+// An immutable copy of the state that LOOT derives from a game's load order
+// and metadata. A new snapshot with a higher version is published whenever
+// that state changes, and readers can hold on to an old snapshot for as long
+// as they need it.
+struct GameSnapshot {
+  uint64_t version{0};
+  std::vector<std::string> loadOrder;
+
+  // Plugin flags and evaluated metadata, in the order they were last derived
+  // in, which may be a sorted load order that has not been applied.
+  std::vector<PluginItem> pluginItems;
+
+  // General messages, not including game path warnings, which depend on
+  // LOOT's settings.
+  std::vector<SourcedMessage> generalMessages;
+};
+}
+}
+
+#endif
@@ -23,6 +23,8 @@
 
 #include "gui/state/game/games_manager.h"
 
+#include <algorithm>
+
 namespace {
 bool gameNeedsRecreating(const loot::gui::Game& game,
                          const loot::GameSettings& newSettings) {
@@ -36,8 +38,13 @@ bool gameNeedsRecreating(const loot::gui::Game& game,
 
 namespace loot {
 GamesManager::GamesManager(const std::filesystem::path& lootDataPath,
-                           const std::filesystem::path& preludePath) :
-    lootDataPath_(lootDataPath), preludePath_(preludePath) {}
+                           const std::filesystem::path& preludePath,
+                           size_t maxWarmGames,
+                           size_t warmGamesMemoryBudget) :
+    lootDataPath_(lootDataPath),
+    preludePath_(preludePath),
+    maxWarmGames_(std::max(maxWarmGames, size_t{1})),
+    warmGamesMemoryBudget_(warmGamesMemoryBudget) {}
 
 void GamesManager::setInstalledGames(
     const std::vector<GameSettings>& gamesSettings) {
@@ -49,12 +56,12 @@ void GamesManager::setInstalledGames(
   }
 
   std::optional<std::string> currentGameFolder;
-  if (currentGame_ != installedGames_.end()) {
+  if (currentGame_ != nullptr) {
     currentGameFolder = currentGame_->getSettings().getFolderName();
   }
 
   bool currentGameUpdated = false;
-  std::vector<gui::Game> installedGames;
+  std::vector<std::unique_ptr<gui::Game>> installedGames;
   for (const auto& gameSettings : gamesSettings) {
     if (!isInstalled(gameSettings)) {
       if (logger) {
@@ -65,54 +72,77 @@ void GamesManager::setInstalledGames(
       continue;
     }
 
-    if (currentGameFolder.has_value() &&
-        currentGameFolder.value() == gameSettings.getFolderName() &&
-        !gameNeedsRecreating(getCurrentGame(), gameSettings)) {
+    const auto existingGame = std::find_if(
+        installedGames_.begin(),
+        installedGames_.end(),
+        [&](const std::unique_ptr<gui::Game>& game) {
+          return game != nullptr && game->getSettings().getFolderName() ==
+                                        gameSettings.getFolderName();
+        });
+    const auto isCurrentGame = existingGame != installedGames_.end() &&
+                               existingGame->get() == currentGame_;
+
+    // Keep the current game and warm games' loaded data. They're updated in
+    // place, so that references to them stay valid.
+    if (existingGame != installedGames_.end() &&
+        (isCurrentGame || (*existingGame)->isInitialised()) &&
+        !gameNeedsRecreating(**existingGame, gameSettings)) {
       if (logger) {
-        logger->trace("Updating game entry for: {}",
+        logger->trace("Updating {}game entry for: {}",
+                      isCurrentGame ? "" : "warm ",
                       gameSettings.getFolderName());
       }
 
-      getCurrentGame()
-          .getSettings()
+      (*existingGame)
+          ->getSettings()
           .setName(gameSettings.getName())
           .setMinimumHeaderVersion(gameSettings.getMinimumHeaderVersion())
           .setMasterlistSource(gameSettings.getMasterlistSource());
 
-      installedGames.push_back(std::move(getCurrentGame()));
-      currentGameUpdated = true;
+      installedGames.push_back(std::move(*existingGame));
+      currentGameUpdated = currentGameUpdated || isCurrentGame;
     } else {
       if (logger) {
         logger->trace("Adding new installed game entry for: {}",
                       gameSettings.getFolderName());
       }
 
-      installedGames.push_back(
-          gui::Game(gameSettings, lootDataPath_, preludePath_));
+      installedGames.push_back(std::make_unique<gui::Game>(
+          gameSettings, lootDataPath_, preludePath_));
     }
   }
   installedGames_ = std::move(installedGames);
 
+  // Forget about games that are no longer installed or that were recreated.
+  const auto newEnd =
+      std::remove_if(warmGameFolders_.begin(),
+                     warmGameFolders_.end(),
+                     [&](const std::string& folder) {
+                       const auto game = findInstalledGame(folder);
+                       return game == nullptr || !game->isInitialised();
+                     });
+  warmGameFolders_.erase(newEnd, warmGameFolders_.end());
+
   if (currentGameUpdated) {
     setCurrentGame(currentGameFolder.value());
   } else if (currentGameFolder.has_value()) {
     setCurrentGame(currentGameFolder.value());
     initialiseGameData(getCurrentGame());
   } else {
-    currentGame_ = installedGames_.end();
+    currentGame_ = nullptr;
   }
 }
 
 bool GamesManager::hasCurrentGame() const {
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-  return currentGame_ != installedGames_.end();
+  return currentGame_ != nullptr;
 }
 
 gui::Game& GamesManager::getCurrentGame() {
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-  if (currentGame_ == installedGames_.end()) {
+  if (currentGame_ == nullptr) {
     throw std::runtime_error("No current game to get.");
   }
 
@@ -122,7 +152,7 @@ gui::Game& GamesManager::getCurrentGame() {
 const gui::Game& GamesManager::getCurrentGame() const {
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-  if (currentGame_ == installedGames_.end()) {
+  if (currentGame_ == nullptr) {
     throw std::runtime_error("No current game to get.");
   }
 
@@ -138,14 +168,9 @@ void GamesManager::setCurrentGame(const std::string& newGameFolder) {
                   newGameFolder);
   }
 
-  currentGame_ =
-      find_if(installedGames_.begin(),
-              installedGames_.end(),
-              [&](const gui::Game& game) {
-                return newGameFolder == game.getSettings().getFolderName();
-              });
+  currentGame_ = findInstalledGame(newGameFolder);
 
-  if (currentGame_ == installedGames_.end()) {
+  if (currentGame_ == nullptr) {
     logger->error(
         "Cannot set the current game: the game with folder \"{}\" is not "
         "installed.",
@@ -157,6 +182,9 @@ void GamesManager::setCurrentGame(const std::string& newGameFolder) {
   if (logger) {
     logger->debug("New game is: {}", currentGame_->getSettings().getName());
   }
+
+  markAsMostRecentlyUsed(newGameFolder);
+  evictWarmGames();
 }
 
 std::vector<std::string> GamesManager::getInstalledGameFolderNames() const {
@@ -164,7 +192,7 @@ std::vector<std::string> GamesManager::getInstalledGameFolderNames() const {
 
   std::vector<std::string> installedGames;
   for (const auto& game : installedGames_) {
-    installedGames.push_back(game.getSettings().getFolderName());
+    installedGames.push_back(game->getSettings().getFolderName());
   }
 
   return installedGames;
@@ -175,7 +203,7 @@ std::optional<std::string> GamesManager::getFirstInstalledGameFolderName()
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
   if (!installedGames_.empty()) {
-    return installedGames_.front().getSettings().getFolderName();
+    return installedGames_.front()->getSettings().getFolderName();
   }
 
   return std::nullopt;
@@ -184,11 +212,77 @@ std::optional<std::string> GamesManager::getFirstInstalledGameFolderName()
 bool GamesManager::isGameInstalled(const std::string& gameFolder) const {
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-  return std::any_of(installedGames_.cbegin(),
-                     installedGames_.cend(),
-                     [&](const gui::Game& game) {
-                       return gameFolder == game.getSettings().getFolderName();
-                     });
+  return std::any_of(
+      installedGames_.cbegin(),
+      installedGames_.cend(),
+      [&](const std::unique_ptr<gui::Game>& game) {
+        return gameFolder == game->getSettings().getFolderName();
+      });
+}
+
+std::vector<std::string> GamesManager::getWarmGameFolderNames() const {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+  return warmGameFolders_;
+}
+
+void GamesManager::markAsMostRecentlyUsed(const std::string& gameFolder) {
+  const auto it =
+      std::find(warmGameFolders_.begin(), warmGameFolders_.end(), gameFolder);
+  if (it != warmGameFolders_.end()) {
+    warmGameFolders_.erase(it);
+  }
+
+  warmGameFolders_.insert(warmGameFolders_.begin(), gameFolder);
+}
+
+void GamesManager::evictWarmGames() {
+  // The current game is at the front and is always kept, so the estimated
+  // memory usage starts with its usage and each less recently used game is
+  // kept only if it fits within the limits.
+  size_t memoryUsage = 0;
+  size_t keptCount = 0;
+  std::vector<std::string> keptFolders;
+  for (const auto& folder : warmGameFolders_) {
+    const auto game = findInstalledGame(folder);
+    if (game == nullptr) {
+      continue;
+    }
+
+    const auto gameMemoryUsage = game->estimateMemoryUsage();
+    const auto isCurrentGame = game == currentGame_;
+    if (isCurrentGame || (keptCount < maxWarmGames_ &&
+                          memoryUsage + gameMemoryUsage <=
+                              warmGamesMemoryBudget_)) {
+      memoryUsage += gameMemoryUsage;
+      keptCount += 1;
+      keptFolders.push_back(folder);
+      continue;
+    }
+
+    const auto logger = getLogger();
+    if (logger) {
+      logger->debug(
+          "Unloading the data for {} to free an estimated {} bytes of memory",
+          game->getSettings().getName(),
+          gameMemoryUsage);
+    }
+
+    game->unload();
+  }
+
+  warmGameFolders_ = std::move(keptFolders);
+}
+
+gui::Game* GamesManager::findInstalledGame(const std::string& gameFolder) {
+  const auto it = std::find_if(
+      installedGames_.begin(),
+      installedGames_.end(),
+      [&](const std::unique_ptr<gui::Game>& game) {
+        return gameFolder == game->getSettings().getFolderName();
+      });
+
+  return it == installedGames_.end() ? nullptr : it->get();
 }
 
 }
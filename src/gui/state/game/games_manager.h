@@ -27,6 +27,7 @@
 #include <filesystem>
 #include <mutex>
 #include <optional>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -39,8 +40,18 @@
 namespace loot {
 class GamesManager {
 public:
+  static constexpr size_t DEFAULT_MAX_WARM_GAMES = 3;
+  static constexpr size_t DEFAULT_WARM_GAMES_MEMORY_BUDGET =
+      1024 * 1024 * 1024;
+
+  // Up to maxWarmGames recently-used games (including the current game) are
+  // kept loaded so that switching back to them is fast, so long as their
+  // estimated total memory usage doesn't exceed warmGamesMemoryBudget bytes.
+  // The current game is never unloaded.
   GamesManager(const std::filesystem::path& lootDataPath,
-               const std::filesystem::path& preludePath);
+               const std::filesystem::path& preludePath,
+               size_t maxWarmGames = DEFAULT_MAX_WARM_GAMES,
+               size_t warmGamesMemoryBudget = DEFAULT_WARM_GAMES_MEMORY_BUDGET);
   GamesManager(const GamesManager&) = delete;
   GamesManager(GamesManager&&) = delete;
   virtual ~GamesManager() = default;
@@ -65,15 +76,28 @@ public:
 
   bool isGameInstalled(const std::string& gameFolder) const;
 
+  // Get the folder names of the games that may still have data loaded, most
+  // recently used first.
+  std::vector<std::string> getWarmGameFolderNames() const;
+
 private:
   virtual bool isInstalled(const GameSettings& gameSettings) const = 0;
 
   virtual void initialiseGameData(gui::Game& game) = 0;
 
+  void markAsMostRecentlyUsed(const std::string& gameFolder);
+  void evictWarmGames();
+  gui::Game* findInstalledGame(const std::string& gameFolder);
+
   std::filesystem::path lootDataPath_;
   std::filesystem::path preludePath_;
-  std::vector<gui::Game> installedGames_;
-  std::vector<gui::Game>::iterator currentGame_{installedGames_.end()};
+  // Games are held by pointer so that references to them stay valid while
+  // the list of installed games is updated.
+  std::vector<std::unique_ptr<gui::Game>> installedGames_;
+  gui::Game* currentGame_{nullptr};
+  size_t maxWarmGames_;
+  size_t warmGamesMemoryBudget_;
+  std::vector<std::string> warmGameFolders_;
 
   // Mutex used to protect access to member variables.
   mutable std::recursive_mutex mutex_;
@@ -37,7 +37,12 @@
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/locale/conversion.hpp>
 #include <fstream>
+#include <map>
 #include <regex>
+#include <set>
+#include <stdexcept>
+#include <unordered_map>
+#include <variant>
 
 #include "gui/state/logging.h"
 #include "gui/translate.h"
@@ -55,7 +60,6 @@
 namespace {
 using loot::EdgeType;
 using loot::GameId;
-using loot::LoadOrderBackup;
 
 constexpr std::string_view GHOST_EXTENSION = ".ghost";
 
@@ -415,107 +419,528 @@ std::optional<std::filesystem::path> resolveGameFilePath(
   return std::nullopt;
 }
 
-void createBackup(const std::vector<std::string>& loadOrder,
-                  const std::filesystem::path& backupDirectory,
-                  std::string_view name,
-                  bool autoDelete) {
-  const auto timestamp = QDateTime::currentDateTimeUtc();
+struct BackupIndexEntry {
+  std::string filename;
+  std::string name;
+  int64_t unixTimestampMs{0};
+  bool autoDelete{false};
+  size_t pluginCount{0};
+  // The filename of the backup that this backup's load order is stored as a
+  // delta against, or an empty string if the full load order is stored.
+  std::string baseFilename;
+};
+
+struct BackupFile {
+  BackupIndexEntry entry;
+  // Only one of these is used, depending on whether entry.baseFilename is
+  // empty.
+  std::vector<std::string> loadOrder;
+  QJsonArray loadOrderDelta;
+};
+
+bool isBackupFilename(const std::string& filename) {
+  return boost::starts_with(filename, "loadorder.") &&
+         boost::ends_with(filename, ".json");
+}
+
+std::optional<QJsonObject> readJsonObject(const std::filesystem::path& path) {
+  auto file = QFile(QString::fromStdString(path.u8string()));
+
+  if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    const auto logger = loot::getLogger();
+    if (logger) {
+      logger->error("Failed to open file at {} due to error {}: {}",
+                    path.u8string(),
+                    static_cast<int>(file.error()),
+                    file.errorString().toStdString());
+    }
+    return std::nullopt;
+  }
+  const auto content = file.readAll();
+  file.close();
+
+  return QJsonDocument::fromJson(content).object();
+}
+
+void writeJsonObject(const std::filesystem::path& path,
+                     const QJsonObject& json) {
+  std::ofstream out(path);
+  out << QJsonDocument(json).toJson(QJsonDocument::Compact).toStdString();
+}
+
+std::vector<std::string> toStringVector(const QJsonArray& array) {
+  std::vector<std::string> strings;
+  for (const auto& entry : array) {
+    const auto string = entry.toString();
+    if (!string.isEmpty()) {
+      strings.push_back(string.toStdString());
+    }
+  }
+
+  return strings;
+}
+
+// A load order delta is an array in which each element is either a plugin
+// name or a [start, length] array that refers to a run of plugins in the base
+// load order.
+QJsonArray computeLoadOrderDelta(const std::vector<std::string>& base,
+                                 const std::vector<std::string>& loadOrder) {
+  std::unordered_map<std::string, size_t> baseIndexes;
+  for (size_t i = 0; i < base.size(); i += 1) {
+    baseIndexes.emplace(base[i], i);
+  }
+
+  QJsonArray delta;
+  size_t runStart = 0;
+  size_t runLength = 0;
+  const auto endRun = [&]() {
+    if (runLength > 0) {
+      delta.push_back(QJsonArray{static_cast<qint64>(runStart),
+                                 static_cast<qint64>(runLength)});
+      runLength = 0;
+    }
+  };
 
-  QJsonArray loadOrderArray;
   for (const auto& plugin : loadOrder) {
-    loadOrderArray.push_back(QString::fromStdString(plugin));
+    const auto it = baseIndexes.find(plugin);
+    if (it == baseIndexes.end()) {
+      endRun();
+      delta.push_back(QString::fromStdString(plugin));
+    } else if (runLength > 0 && it->second == runStart + runLength) {
+      runLength += 1;
+    } else {
+      endRun();
+      runStart = it->second;
+      runLength = 1;
+    }
   }
+  endRun();
 
-  QJsonObject json;
-  json["name"] = std::string(name).c_str();
-  json["creationTimestamp"] = timestamp.toString(Qt::DateFormat::ISODateWithMs);
-  json["autoDelete"] = autoDelete;
-  json["loadOrder"] = loadOrderArray;
+  return delta;
+}
 
-  const auto filename =
-      fmt::format("loadorder.{}.json", timestamp.toMSecsSinceEpoch());
+std::optional<std::vector<std::string>> applyLoadOrderDelta(
+    const std::vector<std::string>& base,
+    const QJsonArray& delta) {
+  std::vector<std::string> loadOrder;
+  for (const auto& piece : delta) {
+    if (piece.isString()) {
+      loadOrder.push_back(piece.toString().toStdString());
+      continue;
+    }
 
-  std::filesystem::create_directories(backupDirectory);
+    const auto run = piece.toArray();
+    const auto start = run.at(0).toInteger(-1);
+    const auto length = run.at(1).toInteger(-1);
+    if (run.size() != 2 || start < 0 || length < 0 ||
+        static_cast<size_t>(start + length) > base.size()) {
+      return std::nullopt;
+    }
+
+    loadOrder.insert(loadOrder.end(),
+                     base.begin() + start,
+                     base.begin() + start + length);
+  }
 
-  std::ofstream out(backupDirectory / std::filesystem::u8path(filename));
-  out << QJsonDocument(json).toJson().toStdString();
+  return loadOrder;
 }
 
-std::optional<LoadOrderBackup> readLoadOrder(const std::filesystem::path& path,
-                                             bool includePlugins) {
+size_t countDeltaPlugins(const QJsonArray& delta) {
+  size_t count = 0;
+  for (const auto& piece : delta) {
+    if (piece.isString()) {
+      count += 1;
+    } else {
+      count += static_cast<size_t>(
+          std::max(piece.toArray().at(1).toInteger(0), qint64{0}));
+    }
+  }
+
+  return count;
+}
+
+bool isCompactDelta(const QJsonArray& delta, size_t pluginCount) {
+  // A delta with many pieces isn't much smaller than the full load order and
+  // is slower to read, so only use it for small changes.
+  static constexpr size_t PLUGINS_PER_DELTA_PIECE = 4;
+
+  return static_cast<size_t>(delta.size()) * PLUGINS_PER_DELTA_PIECE <=
+         pluginCount;
+}
+
+std::optional<BackupFile> readBackupFile(const std::filesystem::path& path) {
   const auto filename = path.filename().u8string();
+  if (!isBackupFilename(filename)) {
+    return std::nullopt;
+  }
 
-  if (!boost::starts_with(filename, "loadorder.") ||
-      !boost::ends_with(filename, ".json")) {
+  const auto json = readJsonObject(path);
+  if (!json.has_value()) {
     return std::nullopt;
   }
-  auto file = QFile(QString::fromStdString(path.u8string()));
 
-  if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+  const auto name = json->value("name").toString();
+  if (name.isEmpty()) {
+    return std::nullopt;
+  }
+
+  BackupFile file;
+  file.entry.filename = filename;
+  file.entry.name = name.toStdString();
+  file.entry.autoDelete = json->value("autoDelete").toBool();
+  file.entry.baseFilename = json->value("base").toString().toStdString();
+
+  if (file.entry.baseFilename.empty()) {
+    const auto timestamp = json->value("creationTimestamp").toString();
+    if (timestamp.isEmpty()) {
+      return std::nullopt;
+    }
+
+    file.entry.unixTimestampMs =
+        QDateTime::fromString(timestamp, Qt::DateFormat::ISODateWithMs)
+            .toMSecsSinceEpoch();
+    file.loadOrder = toStringVector(json->value("loadOrder").toArray());
+    file.entry.pluginCount = file.loadOrder.size();
+  } else {
+    file.entry.unixTimestampMs = json->value("timestamp").toInteger();
+    file.loadOrderDelta = json->value("loadOrderDelta").toArray();
+    file.entry.pluginCount = countDeltaPlugins(file.loadOrderDelta);
+  }
+
+  return file;
+}
+
+// Full backups are written in the format that older versions of LOOT read.
+// Deltas store their timestamp and load order under different keys, so older
+// versions, which don't understand deltas, skip them instead of listing them
+// as empty load orders.
+void writeBackupFile(const std::filesystem::path& backupDirectory,
+                     const BackupIndexEntry& entry,
+                     const std::vector<std::string>& loadOrder,
+                     const QJsonArray& loadOrderDelta) {
+  QJsonObject json;
+  json["name"] = QString::fromStdString(entry.name);
+  json["autoDelete"] = entry.autoDelete;
+
+  if (entry.baseFilename.empty()) {
+    const auto timestamp =
+        QDateTime::fromMSecsSinceEpoch(entry.unixTimestampMs).toUTC();
+    json["creationTimestamp"] =
+        timestamp.toString(Qt::DateFormat::ISODateWithMs);
+
+    QJsonArray loadOrderArray;
+    for (const auto& plugin : loadOrder) {
+      loadOrderArray.push_back(QString::fromStdString(plugin));
+    }
+    json["loadOrder"] = loadOrderArray;
+  } else {
+    json["timestamp"] = static_cast<qint64>(entry.unixTimestampMs);
+    json["base"] = QString::fromStdString(entry.baseFilename);
+    json["loadOrderDelta"] = loadOrderDelta;
+  }
+
+  writeJsonObject(backupDirectory / std::filesystem::u8path(entry.filename),
+                  json);
+}
+
+std::optional<std::vector<std::string>> readBackupLoadOrder(
+    const std::filesystem::path& path) {
+  const auto file = readBackupFile(path);
+  if (!file.has_value()) {
+    return std::nullopt;
+  }
+
+  if (file->entry.baseFilename.empty()) {
+    return file->loadOrder;
+  }
+
+  // Deltas are only ever stored against full load orders.
+  const auto basePath =
+      path.parent_path() / std::filesystem::u8path(file->entry.baseFilename);
+  const auto base = readBackupFile(basePath);
+  std::optional<std::vector<std::string>> loadOrder;
+  if (base.has_value() && base->entry.baseFilename.empty()) {
+    loadOrder = applyLoadOrderDelta(base->loadOrder, file->loadOrderDelta);
+  }
+
+  if (!loadOrder.has_value()) {
     const auto logger = loot::getLogger();
     if (logger) {
       logger->error(
-          "Failed to open load order backup file at {} due to error {}: {}",
+          "Failed to apply the load order backup delta in {} to the backup in "
+          "{}",
           path.u8string(),
-          static_cast<int>(file.error()),
-          file.errorString().toStdString());
+          basePath.u8string());
     }
-    return std::nullopt;
   }
-  const auto content = file.readAll();
-  file.close();
 
-  const auto json = QJsonDocument::fromJson(content).object();
-  const auto name = json.value("name").toString();
-  const auto timestamp = json.value("creationTimestamp").toString();
-  const auto autoDelete = json.value("autoDelete").toBool();
-  const auto loadOrder = json.value("loadOrder").toArray();
+  return loadOrder;
+}
 
-  if (name.isEmpty() || timestamp.isEmpty()) {
+std::filesystem::path getBackupIndexPath(
+    const std::filesystem::path& backupDirectory) {
+  return backupDirectory / "index.json";
+}
+
+std::optional<std::vector<BackupIndexEntry>> readBackupIndex(
+    const std::filesystem::path& backupDirectory) {
+  const auto indexPath = getBackupIndexPath(backupDirectory);
+  if (!std::filesystem::exists(indexPath)) {
     return std::nullopt;
   }
 
-  LoadOrderBackup backup;
-  backup.path = path;
-  backup.name = name.toStdString();
-  backup.unixTimestampMs =
-      QDateTime::fromString(timestamp, Qt::DateFormat::ISODateWithMs)
-          .toMSecsSinceEpoch();
-  backup.autoDelete = autoDelete;
+  const auto json = readJsonObject(indexPath);
+  if (!json.has_value() || !json->value("backups").isArray()) {
+    return std::nullopt;
+  }
 
-  if (includePlugins) {
-    for (const auto& entry : loadOrder) {
-      const auto pluginName = entry.toString();
-      if (!pluginName.isEmpty()) {
-        backup.loadOrder.push_back(pluginName.toStdString());
-      }
+  std::vector<BackupIndexEntry> entries;
+  for (const auto& value : json->value("backups").toArray()) {
+    const auto object = value.toObject();
+
+    BackupIndexEntry entry;
+    entry.filename = object.value("file").toString().toStdString();
+    entry.name = object.value("name").toString().toStdString();
+    entry.unixTimestampMs = object.value("timestamp").toInteger();
+    entry.autoDelete = object.value("autoDelete").toBool();
+    entry.pluginCount =
+        static_cast<size_t>(object.value("pluginCount").toInteger());
+    entry.baseFilename = object.value("base").toString().toStdString();
+
+    if (!isBackupFilename(entry.filename) || entry.name.empty()) {
+      return std::nullopt;
     }
+
+    entries.push_back(entry);
   }
 
-  return backup;
+  return entries;
 }
 
-std::vector<LoadOrderBackup> findLoadOrderBackups(
-    const std::filesystem::path& backupDirectory) {
-  std::vector<LoadOrderBackup> backups;
+void writeBackupIndex(const std::filesystem::path& backupDirectory,
+                      const std::vector<BackupIndexEntry>& entries) {
+  QJsonArray backups;
+  for (const auto& entry : entries) {
+    QJsonObject object;
+    object["file"] = QString::fromStdString(entry.filename);
+    object["name"] = QString::fromStdString(entry.name);
+    object["timestamp"] = static_cast<qint64>(entry.unixTimestampMs);
+    object["autoDelete"] = entry.autoDelete;
+    object["pluginCount"] = static_cast<qint64>(entry.pluginCount);
+    if (!entry.baseFilename.empty()) {
+      object["base"] = QString::fromStdString(entry.baseFilename);
+    }
 
+    backups.push_back(object);
+  }
+
+  QJsonObject json;
+  json["backups"] = backups;
+
+  writeJsonObject(getBackupIndexPath(backupDirectory), json);
+}
+
+// Reads the backup index, updating it if backup files have been added or
+// removed since it was written (e.g. by an older version of LOOT). Only the
+// files that are missing from the index get read. Entries are sorted from
+// oldest to newest.
+std::vector<BackupIndexEntry> loadBackupIndex(
+    const std::filesystem::path& backupDirectory) {
   if (!std::filesystem::exists(backupDirectory)) {
-    return backups;
+    return {};
   }
 
+  std::set<std::string> filenames;
   for (const auto& entry :
        std::filesystem::directory_iterator(backupDirectory)) {
-    const auto loadOrder = readLoadOrder(entry.path(), true);
+    const auto filename = entry.path().filename().u8string();
+    if (isBackupFilename(filename)) {
+      filenames.insert(filename);
+    }
+  }
+
+  auto index = readBackupIndex(backupDirectory);
+  auto isStale = !index.has_value();
+  auto entries = index.value_or(std::vector<BackupIndexEntry>());
+
+  const auto newEnd = std::remove_if(
+      entries.begin(), entries.end(), [&](const BackupIndexEntry& entry) {
+        return filenames.erase(entry.filename) == 0;
+      });
+  if (newEnd != entries.end()) {
+    entries.erase(newEnd, entries.end());
+    isStale = true;
+  }
+
+  // Any filenames left are for backups that aren't in the index.
+  for (const auto& filename : filenames) {
+    const auto file =
+        readBackupFile(backupDirectory / std::filesystem::u8path(filename));
+    if (file.has_value()) {
+      entries.push_back(file->entry);
+    }
+    isStale = true;
+  }
+
+  // A delta can't be restored without the full backup that it's stored
+  // against, which may have been deleted outside of LOOT, e.g. by an older
+  // version of LOOT that doesn't know about deltas.
+  std::set<std::string> fullBackupFilenames;
+  for (const auto& entry : entries) {
+    if (entry.baseFilename.empty()) {
+      fullBackupFilenames.insert(entry.filename);
+    }
+  }
+
+  const auto orphansEnd = std::remove_if(
+      entries.begin(), entries.end(), [&](const BackupIndexEntry& entry) {
+        if (entry.baseFilename.empty() ||
+            fullBackupFilenames.count(entry.baseFilename) != 0) {
+          return false;
+        }
+
+        const auto logger = loot::getLogger();
+        if (logger) {
+          logger->warn(
+              "Removing the load order backup {} as the backup it was stored "
+              "against no longer exists",
+              entry.filename);
+        }
+
+        std::filesystem::remove(backupDirectory /
+                                std::filesystem::u8path(entry.filename));
+        return true;
+      });
+  if (orphansEnd != entries.end()) {
+    entries.erase(orphansEnd, entries.end());
+    isStale = true;
+  }
+
+  std::stable_sort(
+      entries.begin(),
+      entries.end(),
+      [](const BackupIndexEntry& lhs, const BackupIndexEntry& rhs) {
+        return lhs.unixTimestampMs < rhs.unixTimestampMs;
+      });
+
+  if (isStale) {
+    const auto logger = loot::getLogger();
+    if (logger) {
+      logger->debug("Updating the load order backup index in {}",
+                    backupDirectory.u8string());
+    }
+
+    writeBackupIndex(backupDirectory, entries);
+  }
+
+  return entries;
+}
+
+void createBackup(const std::vector<std::string>& loadOrder,
+                  const std::filesystem::path& backupDirectory,
+                  std::string_view name,
+                  bool autoDelete,
+                  std::vector<BackupIndexEntry>& index) {
+  const auto timestamp = QDateTime::currentDateTimeUtc();
 
+  BackupIndexEntry entry;
+  entry.filename =
+      fmt::format("loadorder.{}.json", timestamp.toMSecsSinceEpoch());
+  entry.name = std::string(name);
+  entry.unixTimestampMs = timestamp.toMSecsSinceEpoch();
+  entry.autoDelete = autoDelete;
+  entry.pluginCount = loadOrder.size();
+
+  // Store the load order as a delta against the newest full backup if that
+  // saves space, but store a full backup at least every
+  // BACKUPS_PER_FULL_BACKUP backups, so that older versions of LOOT can still
+  // restore a recent load order.
+  static constexpr size_t BACKUPS_PER_FULL_BACKUP = 10;
+
+  QJsonArray loadOrderDelta;
+  const auto baseIt = std::find_if(
+      index.rbegin(), index.rend(), [&](const BackupIndexEntry& other) {
+        return other.baseFilename.empty() && other.filename != entry.filename;
+      });
+  const auto deltaCount =
+      static_cast<size_t>(std::distance(index.rbegin(), baseIt));
+  if (baseIt != index.rend() && deltaCount + 1 < BACKUPS_PER_FULL_BACKUP) {
+    const auto base = readBackupLoadOrder(
+        backupDirectory / std::filesystem::u8path(baseIt->filename));
+    if (base.has_value()) {
+      loadOrderDelta = computeLoadOrderDelta(base.value(), loadOrder);
+      if (isCompactDelta(loadOrderDelta, loadOrder.size())) {
+        entry.baseFilename = baseIt->filename;
+      }
+    }
+  }
+
+  std::filesystem::create_directories(backupDirectory);
+
+  writeBackupFile(backupDirectory, entry, loadOrder, loadOrderDelta);
+
+  index.erase(std::remove_if(index.begin(),
+                             index.end(),
+                             [&](const BackupIndexEntry& other) {
+                               return other.filename == entry.filename;
+                             }),
+              index.end());
+  index.push_back(entry);
+}
+
+// Removes a backup file and its index entry, first rewriting any backups
+// that are stored as deltas against it so that the oldest of them stores its
+// full load order and the others are stored against that.
+void removeBackup(const std::filesystem::path& backupDirectory,
+                  std::vector<BackupIndexEntry>& index,
+                  const std::string& filename) {
+  using std::filesystem::u8path;
+
+  std::vector<std::pair<BackupIndexEntry*, std::vector<std::string>>>
+      dependants;
+  for (auto& entry : index) {
+    if (entry.baseFilename != filename) {
+      continue;
+    }
+
+    auto loadOrder =
+        readBackupLoadOrder(backupDirectory / u8path(entry.filename));
     if (loadOrder.has_value()) {
-      backups.push_back(loadOrder.value());
+      dependants.emplace_back(&entry, std::move(loadOrder.value()));
     }
   }
 
-  return backups;
+  const BackupIndexEntry* newBase = nullptr;
+  const std::vector<std::string>* newBaseLoadOrder = nullptr;
+  for (auto& [entry, loadOrder] : dependants) {
+    QJsonArray loadOrderDelta;
+    entry->baseFilename.clear();
+
+    if (newBase == nullptr) {
+      newBase = entry;
+      newBaseLoadOrder = &loadOrder;
+    } else {
+      loadOrderDelta = computeLoadOrderDelta(*newBaseLoadOrder, loadOrder);
+      if (isCompactDelta(loadOrderDelta, loadOrder.size())) {
+        entry->baseFilename = newBase->filename;
+      }
+    }
+
+    writeBackupFile(backupDirectory, *entry, loadOrder, loadOrderDelta);
+  }
+
+  std::filesystem::remove(backupDirectory / u8path(filename));
+
+  index.erase(std::remove_if(index.begin(),
+                             index.end(),
+                             [&](const BackupIndexEntry& entry) {
+                               return entry.filename == filename;
+                             }),
+              index.end());
 }
 
-void removeOldBackups(const std::filesystem::path& backupDirectory) {
+void removeOldBackups(const std::filesystem::path& backupDirectory,
+                      std::vector<BackupIndexEntry>& index) {
   using std::filesystem::u8path;
 
   constexpr size_t MAX_BACKUPS = 10;
@@ -524,7 +949,10 @@ void removeOldBackups(const std::filesystem::path& backupDirectory) {
     return;
   }
 
-  std::map<int64_t, std::filesystem::path> backupFiles;
+  // Map timestamps to either the path of a backup using the old naming scheme
+  // or the filename of an indexed backup.
+  std::map<int64_t, std::variant<std::filesystem::path, std::string>>
+      backupFiles;
 
   // Remove backups that use the old naming scheme first.
   const auto oldBackupDirectory = backupDirectory.parent_path();
@@ -541,19 +969,23 @@ void removeOldBackups(const std::filesystem::path& backupDirectory) {
     backupFiles.emplace(INT64_MIN + 2, oldBak0);
   }
 
-  for (const auto& entry :
-       std::filesystem::directory_iterator(backupDirectory)) {
-    const auto loadOrder = readLoadOrder(entry.path(), false);
-
-    if (loadOrder.has_value() && loadOrder.value().autoDelete) {
-      backupFiles.emplace(loadOrder.value().unixTimestampMs, entry.path());
+  for (const auto& entry : index) {
+    if (entry.autoDelete) {
+      backupFiles.emplace(entry.unixTimestampMs, entry.filename);
     }
   }
 
   while (backupFiles.size() > MAX_BACKUPS) {
     const auto node = backupFiles.extract(backupFiles.begin());
-    if (!node.empty()) {
-      std::filesystem::remove(node.mapped());
+    if (node.empty()) {
+      continue;
+    }
+
+    if (std::holds_alternative<std::filesystem::path>(node.mapped())) {
+      std::filesystem::remove(std::get<std::filesystem::path>(node.mapped()));
+    } else {
+      removeBackup(
+          backupDirectory, index, std::get<std::string>(node.mapped()));
     }
   }
 }
@@ -595,23 +1027,58 @@ std::string describeEdgeType(const EdgeType edgeType) {
 namespace loot {
 void backupLoadOrder(const std::vector<std::string>& loadOrder,
                      const std::filesystem::path& backupDirectory) {
+  auto index = loadBackupIndex(backupDirectory);
   createBackup(loadOrder,
                backupDirectory,
                translate("Automatic Load Order Backup"),
-               true);
-  removeOldBackups(backupDirectory);
+               true,
+               index);
+  removeOldBackups(backupDirectory, index);
+  writeBackupIndex(backupDirectory, index);
 }
 
 void backupLoadOrder(const std::vector<std::string>& loadOrder,
                      const std::filesystem::path& backupDirectory,
                      std::string_view name) {
-  createBackup(loadOrder, backupDirectory, name, false);
-  removeOldBackups(backupDirectory);
+  auto index = loadBackupIndex(backupDirectory);
+  createBackup(loadOrder, backupDirectory, name, false, index);
+  removeOldBackups(backupDirectory, index);
+  writeBackupIndex(backupDirectory, index);
 }
 
 std::vector<LoadOrderBackup> findLoadOrderBackups(
     const std::filesystem::path& backupDirectory) {
-  return ::findLoadOrderBackups(backupDirectory);
+  std::vector<LoadOrderBackup> backups;
+  for (const auto& entry : loadBackupIndex(backupDirectory)) {
+    LoadOrderBackup backup;
+    backup.path = backupDirectory / std::filesystem::u8path(entry.filename);
+    backup.name = entry.name;
+    backup.unixTimestampMs = entry.unixTimestampMs;
+    backup.autoDelete = entry.autoDelete;
+    backup.pluginCount = entry.pluginCount;
+
+    backups.push_back(backup);
+  }
+
+  return backups;
+}
+
+std::vector<std::string> readLoadOrderBackup(const LoadOrderBackup& backup) {
+  const auto loadOrder = readBackupLoadOrder(backup.path);
+  if (!loadOrder.has_value()) {
+    throw std::runtime_error("Failed to read the load order backup at " +
+                             backup.path.u8string());
+  }
+
+  return loadOrder.value();
+}
+
+void deleteLoadOrderBackup(const LoadOrderBackup& backup) {
+  const auto backupDirectory = backup.path.parent_path();
+
+  auto index = loadBackupIndex(backupDirectory);
+  removeBackup(backupDirectory, index, backup.path.filename().u8string());
+  writeBackupIndex(backupDirectory, index);
 }
 
 std::string escapeMarkdownASCIIPunctuation(const std::string& text) {
@@ -46,9 +46,15 @@ void backupLoadOrder(const std::vector<std::string>& loadOrder,
                      const std::filesystem::path& backupDirectory,
                      std::string_view name);
 
+// Get the backups listed in the backup directory's index, oldest first. The
+// backups' load orders are not read.
 std::vector<LoadOrderBackup> findLoadOrderBackups(
     const std::filesystem::path& backupDirectory);
 
+std::vector<std::string> readLoadOrderBackup(const LoadOrderBackup& backup);
+
+void deleteLoadOrderBackup(const LoadOrderBackup& backup);
+
 // Escape any Markdown special characters in the input text.
 std::string escapeMarkdownASCIIPunctuation(const std::string& text);
 
@@ -26,7 +26,6 @@
 
 #include <filesystem>
 #include <string>
-#include <vector>
 
 namespace loot {
 struct LoadOrderBackup {
@@ -34,7 +33,7 @@ struct LoadOrderBackup {
   std::string name;
   int64_t unixTimestampMs{0};
   bool autoDelete{false};
-  std::vector<std::string> loadOrder;
+  size_t pluginCount{0};
 };
 }
 
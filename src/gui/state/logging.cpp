@@ -23,13 +23,10 @@
 
 #include "gui/state/logging.h"
 
-#include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_sinks.h>
 
-#include <boost/algorithm/string/replace.hpp>
-#include <optional>
-
 #include "gui/helpers.h"
+#include "gui/state/censoring_file_sink.h"
 
 #ifdef _WIN32
 #ifndef UNICODE
@@ -59,65 +56,6 @@ std::vector<std::pair<std::string, std::string>> getStringsToCensor() {
 }
 
 namespace loot {
-
-class CensoringFileSink : public spdlog::sinks::sink {
-public:
-  CensoringFileSink(
-      const spdlog::filename_t& filename,
-      const std::vector<std::pair<std::string, std::string>>& stringsToCensor) :
-      sink(filename), stringsToCensor_(stringsToCensor) {}
-
-protected:
-  void log(const spdlog::details::log_msg& msg) {
-    if (!sink.should_log(msg.level)) {
-      // Skip potentially expensive string search / replacement.
-      return;
-    }
-
-    if (!needsCensoring(msg.payload)) {
-      // Avoid unnecessary copies.
-      sink.log(msg);
-      return;
-    }
-
-    spdlog::details::log_msg msgCopy = msg;
-
-    std::string payload(msg.payload.data(), msg.payload.size());
-
-    for (const auto& [search, replacement] : stringsToCensor_) {
-      boost::replace_all(payload, search, replacement);
-    }
-
-    msgCopy.payload = payload;
-
-    sink.log(msgCopy);
-  }
-
-  void flush() { sink.flush(); }
-
-  void set_pattern(const std::string& pattern) { sink.set_pattern(pattern); }
-
-  void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) {
-    sink.set_formatter(std::move(sink_formatter));
-  }
-
-private:
-  spdlog::sinks::basic_file_sink_mt sink;
-  std::vector<std::pair<std::string, std::string>> stringsToCensor_;
-
-  bool needsCensoring(const spdlog::string_view_t& payload) {
-    std::string_view view(payload.data(), payload.size());
-
-    for (const auto& [search, replacement] : stringsToCensor_) {
-      if (view.find(search) != std::string_view::npos) {
-        return true;
-      }
-    }
-
-    return false;
-  }
-};
-
 std::shared_ptr<spdlog::logger> getLogger() {
   auto logger = spdlog::get(LOGGER_NAME);
 
@@ -155,7 +93,9 @@ void setLogPath(const std::filesystem::path& outputFile) {
   if (!logger) {
     throw std::runtime_error("Error: Could not initialise logging.");
   }
-  logger->flush_on(spdlog::level::trace);
+  // The sink writes and flushes messages at error level or above
+  // immediately, and everything else in batches.
+  logger->flush_on(spdlog::level::err);
 }
 
 void enableDebugLogging(bool enable) {
@@ -74,4 +74,12 @@ std::filesystem::path LootPaths::getLogPath() const {
 std::filesystem::path LootPaths::getPreludePath() const {
   return lootDataPath_ / "prelude" / "prelude.yaml";
 }
+
+std::filesystem::path LootPaths::getGameDetectionCachePath() const {
+  return lootDataPath_ / "game-detection-cache.json";
+}
+
+std::filesystem::path LootPaths::getTracePath() const {
+  return lootDataPath_ / "LOOTTrace.json";
+}
 }
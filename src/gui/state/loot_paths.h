@@ -39,6 +39,8 @@ public:
   std::filesystem::path getThemesPath() const;
   std::filesystem::path getLogPath() const;
   std::filesystem::path getPreludePath() const;
+  std::filesystem::path getGameDetectionCachePath() const;
+  std::filesystem::path getTracePath() const;
 
 private:
   std::filesystem::path lootDocsPath_;
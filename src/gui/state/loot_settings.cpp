@@ -25,6 +25,7 @@
 
 #include <toml++/toml.h>
 
+#include <algorithm>
 #include <array>
 #include <boost/algorithm/string/predicate.hpp>
 #include <fstream>
@@ -32,6 +33,7 @@
 
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
+#include "gui/state/tracing.h"
 #include "gui/version.h"
 
 using std::lock_guard;
@@ -848,6 +850,7 @@ void LootSettings::load(const std::filesystem::path& file) {
 
   enableDebugLogging_ =
       settings["enableDebugLogging"].value_or(enableDebugLogging_);
+  enableTracing_ = settings["enableTracing"].value_or(enableTracing_);
   updateMasterlistBeforeSort_ =
       settings["updateMasterlist"].value_or(updateMasterlistBeforeSort_);
   enableLootUpdateCheck_ =
@@ -863,6 +866,22 @@ void LootSettings::load(const std::filesystem::path& file) {
   lastGame_ = settings["lastGame"].value_or(lastGame_);
   lastVersion_ = settings["lastVersion"].value_or(lastVersion_);
 
+  const auto maxConcurrentDownloads =
+      settings["maxConcurrentDownloads"].value<int64_t>();
+  if (maxConcurrentDownloads.has_value() &&
+      maxConcurrentDownloads.value() > 0) {
+    maxConcurrentDownloads_ =
+        static_cast<unsigned int>(maxConcurrentDownloads.value());
+  }
+
+  const auto gameDetectionTimeBudget =
+      settings["gameDetectionTimeBudget"].value<int64_t>();
+  if (gameDetectionTimeBudget.has_value() &&
+      gameDetectionTimeBudget.value() > 0) {
+    gameDetectionTimeBudget_ =
+        std::chrono::seconds(gameDetectionTimeBudget.value());
+  }
+
   const auto preludeSource = settings["preludeSource"].value<std::string>();
   if (preludeSource.has_value()) {
     preludeSource_ = migratePreludeSource(preludeSource.value());
@@ -964,6 +983,7 @@ void LootSettings::save(const std::filesystem::path& file) {
 
   toml::table root{
       {"enableDebugLogging", enableDebugLogging_},
+      {"enableTracing", enableTracing_},
       {"updateMasterlist", updateMasterlistBeforeSort_},
       {"enableLootUpdateCheck", enableLootUpdateCheck_},
       {"useNoSortingChangesDialog", useNoSortingChangesDialog_},
@@ -974,6 +994,9 @@ void LootSettings::save(const std::filesystem::path& file) {
       {"lastGame", lastGame_},
       {"lastVersion", lastVersion_},
       {"preludeSource", preludeSource_},
+      {"maxConcurrentDownloads", static_cast<int64_t>(maxConcurrentDownloads_)},
+      {"gameDetectionTimeBudget",
+       static_cast<int64_t>(gameDetectionTimeBudget_.count())},
       {"filters",
        toml::table{
            {"hideVersionNumbers", filters_.hideVersionNumbers},
@@ -1081,6 +1104,12 @@ bool LootSettings::isDebugLoggingEnabled() const {
   return enableDebugLogging_;
 }
 
+bool LootSettings::isTracingEnabled() const {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  return enableTracing_;
+}
+
 bool LootSettings::isMasterlistUpdateBeforeSortEnabled() const {
   lock_guard<recursive_mutex> guard(mutex_);
 
@@ -1141,6 +1170,18 @@ std::string LootSettings::getPreludeSource() const {
   return preludeSource_;
 }
 
+unsigned int LootSettings::getMaxConcurrentDownloads() const {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  return maxConcurrentDownloads_;
+}
+
+std::chrono::seconds LootSettings::getGameDetectionTimeBudget() const {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  return gameDetectionTimeBudget_;
+}
+
 std::optional<LootSettings::WindowPosition>
 LootSettings::getMainWindowPosition() const {
   lock_guard<recursive_mutex> guard(mutex_);
@@ -1204,6 +1245,21 @@ void LootSettings::setPreludeSource(const std::string& source) {
   preludeSource_ = source;
 }
 
+void LootSettings::setMaxConcurrentDownloads(
+    unsigned int maxConcurrentDownloads) {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  // At least one download must be allowed for updates to make progress.
+  maxConcurrentDownloads_ = std::max(maxConcurrentDownloads, 1u);
+}
+
+void LootSettings::setGameDetectionTimeBudget(std::chrono::seconds timeBudget) {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  // A zero budget would give up on every install source.
+  gameDetectionTimeBudget_ = std::max(timeBudget, std::chrono::seconds(1));
+}
+
 void LootSettings::enableAutoSort(bool autoSort) {
   lock_guard<recursive_mutex> guard(mutex_);
 
@@ -1217,6 +1273,13 @@ void LootSettings::enableDebugLogging(bool enable) {
   loot::enableDebugLogging(enable);
 }
 
+void LootSettings::enableTracing(bool enable) {
+  lock_guard<recursive_mutex> guard(mutex_);
+
+  enableTracing_ = enable;
+  loot::enableTracing(enable);
+}
+
 void LootSettings::enableMasterlistUpdateBeforeSort(bool update) {
   lock_guard<recursive_mutex> guard(mutex_);
 
@@ -28,6 +28,7 @@
 #ifndef LOOT_GUI_STATE_LOOT_SETTINGS
 #define LOOT_GUI_STATE_LOOT_SETTINGS
 
+#include <chrono>
 #include <filesystem>
 #include <map>
 #include <mutex>
@@ -85,6 +86,7 @@ public:
 
   bool isAutoSortEnabled() const;
   bool isDebugLoggingEnabled() const;
+  bool isTracingEnabled() const;
   bool isMasterlistUpdateBeforeSortEnabled() const;
   bool isLootUpdateCheckEnabled() const;
   bool isNoSortingChangesDialogEnabled() const;
@@ -95,6 +97,8 @@ public:
   std::string getLanguage() const;
   std::string getTheme() const;
   std::string getPreludeSource() const;
+  unsigned int getMaxConcurrentDownloads() const;
+  std::chrono::seconds getGameDetectionTimeBudget() const;
   std::optional<WindowPosition> getMainWindowPosition() const;
   std::optional<WindowPosition> getGroupsEditorWindowPosition() const;
   std::optional<WindowPosition> getCompareLoadOrdersWindowPosition() const;
@@ -106,8 +110,11 @@ public:
   void setLanguage(const std::string& language);
   void setTheme(const std::string& theme);
   void setPreludeSource(const std::string& source);
+  void setMaxConcurrentDownloads(unsigned int maxConcurrentDownloads);
+  void setGameDetectionTimeBudget(std::chrono::seconds timeBudget);
   void enableAutoSort(bool enable);
   void enableDebugLogging(bool enable);
+  void enableTracing(bool enable);
   void enableMasterlistUpdateBeforeSort(bool enable);
   void enableLootUpdateCheck(bool enable);
   void enableNoSortingChangesDialog(bool enable);
@@ -124,6 +131,7 @@ public:
 private:
   bool autoSort_{false};
   bool enableDebugLogging_{false};
+  bool enableTracing_{false};
   bool updateMasterlistBeforeSort_{true};
   bool enableLootUpdateCheck_{true};
   bool useNoSortingChangesDialog_{true};
@@ -134,6 +142,8 @@ private:
   std::string language_{"en"};
   std::string preludeSource_{getDefaultPreludeSource()};
   std::string theme_{"default"};
+  unsigned int maxConcurrentDownloads_{4};
+  std::chrono::seconds gameDetectionTimeBudget_{10};
   std::optional<WindowPosition> mainWindowPosition_;
   std::optional<WindowPosition> groupsEditorWindowPosition_;
   std::optional<WindowPosition> compareLoadOrdersWindowPosition_;
@@ -36,8 +36,11 @@
 #include <windows.h>
 #endif
 
+#include <algorithm>
+
 #include <fmt/base.h>
 
+#include <boost/algorithm/string/join.hpp>
 #include <boost/locale/generator.hpp>
 
 #include "gui/helpers.h"
@@ -45,6 +48,8 @@
 #include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
+#include "gui/state/stage_graph.h"
+#include "gui/state/tracing.h"
 #include "gui/translate.h"
 #include "loot/api.h"
 
@@ -106,6 +111,10 @@ LootState::LootState(LootPaths&& paths) :
   setLogPath(paths_.getLogPath());
   SetLoggingCallback(apiLogCallback);
 
+  // Tracing is only enabled once settings have been loaded, as it's opt-in.
+  fs::remove(paths_.getTracePath());
+  setTracePath(paths_.getTracePath());
+
   // Enable debug logging before settings are loaded to capture as much
   // information as possible if settings can't be loaded. Don't change
   // the value in settings_ so that if the settings file doesn't configure
@@ -116,36 +125,51 @@ LootState::LootState(LootPaths&& paths) :
 void LootState::init(const std::string& cmdLineGame,
                      const std::filesystem::path& cmdLineGamePath,
                      bool autoSort) {
-  loadSettings(cmdLineGame, autoSort);
+  // Loading settings imbues the global locale, reconfigures the logger and
+  // adds init messages, so nothing else can run alongside it.
+  getStartupStageTimings().record(runStage(
+      "settings", {}, [&]() { loadSettings(cmdLineGame, autoSort); }));
 
-  // Check settings after handling translations so that any messages
-  // are correctly translated.
-  checkSettingsFile();
+  StageGraph stages({"settings"});
 
-  // Find Xbox gaming root paths for detection of games installed through the
-  // Microsoft Store / Xbox app.
-  findXboxGamingRootPaths();
+  stages.addStage("settings checks", {}, [&]() {
+    // Check settings after handling translations so that any messages
+    // are correctly translated.
+    checkSettingsFile();
 
-  preferredUILanguages_ = getPreferredUILanguages();
-  if (preferredUILanguages_.empty() && settings_.getLanguage().size() > 1) {
-    preferredUILanguages_ = {settings_.getLanguage()};
-  }
+    preferredUILanguages_ = getPreferredUILanguages();
+    if (preferredUILanguages_.empty() && settings_.getLanguage().size() > 1) {
+      preferredUILanguages_ = {settings_.getLanguage()};
+    }
 
-  // Check if the prelude directory exists and create it if not.
-  createPreludeDirectory();
+    // Check if the prelude directory exists and create it if not.
+    createPreludeDirectory();
 
-  // Override game path if given as a command line parameter.
-  overrideGamePath(cmdLineGame, cmdLineGamePath);
+    // Override game path if given as a command line parameter.
+    overrideGamePath(cmdLineGame, cmdLineGamePath);
+  });
+
+  // Find Xbox gaming root paths for detection of games installed through the
+  // Microsoft Store / Xbox app. This checks every drive and only writes
+  // xboxGamingRootPaths_, so it runs while the loaded settings are checked.
+  stages.addStage(
+      "xbox gaming roots", {}, [this]() { findXboxGamingRootPaths(); });
 
   // Detect games & select startup game
   //-----------------------------------
 
-  // Detect installed games.
-  const auto gameSettings = loadInstalledGames(settings_.getGameSettings());
+  stages.addStage(
+      "detection", {"settings checks", "xbox gaming roots"}, [&]() {
+        // Detect installed games.
+        const auto gameSettings =
+            loadInstalledGames(settings_.getGameSettings());
+
+        settings_.storeGameSettings(gameSettings);
 
-  settings_.storeGameSettings(gameSettings);
+        setInitialGame(cmdLineGame);
+      });
 
-  setInitialGame(cmdLineGame);
+  getStartupStageTimings().record(stages.run());
 }
 
 void LootState::initCurrentGame() {
@@ -169,14 +193,53 @@ void LootState::initCurrentGame() {
   }
 }
 
-std::vector<GameSettings> LootState::loadInstalledGames(
-    const std::vector<GameSettings>& gamesSettings) {
-  auto allGamesSettings = findInstalledGames(
-      gamesSettings, xboxGamingRootPaths_, preferredUILanguages_);
+InstalledGames LootState::detectInstalledGames(
+    const std::vector<GameSettings>& gamesSettings) const {
+  // Only one detection can record its inputs at a time, and detections
+  // share a cache file.
+  std::lock_guard<std::mutex> guard(detectionMutex_);
+
+  return findInstalledGames(gamesSettings,
+                            xboxGamingRootPaths_,
+                            preferredUILanguages_,
+                            paths_.getGameDetectionCachePath(),
+                            settings_.getGameDetectionTimeBudget());
+}
+
+std::vector<GameSettings> LootState::applyInstalledGames(
+    const InstalledGames& installedGames) {
+  // Replace any warning from a previous detection instead of adding another.
+  if (detectionTimeoutMessage_.has_value()) {
+    initMessages_.erase(std::remove(initMessages_.begin(),
+                                    initMessages_.end(),
+                                    detectionTimeoutMessage_.value()),
+                        initMessages_.end());
+    detectionTimeoutMessage_.reset();
+  }
+
+  if (!installedGames.timedOutSources.empty()) {
+    detectionTimeoutMessage_ = createPlainTextSourcedMessage(
+        MessageType::warn,
+        MessageSource::init,
+        format(
+            /* translators: {0} is a number of seconds, {1} is a
+               comma-separated list of places that LOOT looks for games in. */
+            translate("LOOT stopped searching the following for installed "
+                      "games after {0} seconds: {1}. Games installed through "
+                      "them may be missing from the game list."),
+            settings_.getGameDetectionTimeBudget().count(),
+            boost::join(installedGames.timedOutSources, ", ")));
+    initMessages_.push_back(detectionTimeoutMessage_.value());
+  }
 
-  setInstalledGames(allGamesSettings);
+  setInstalledGames(installedGames.gamesSettings);
 
-  return allGamesSettings;
+  return installedGames.gamesSettings;
+}
+
+std::vector<GameSettings> LootState::loadInstalledGames(
+    const std::vector<GameSettings>& gamesSettings) {
+  return applyInstalledGames(detectInstalledGames(gamesSettings));
 }
 
 const std::vector<SourcedMessage>& LootState::getInitMessages() const {
@@ -233,6 +296,7 @@ void LootState::loadSettings(const std::string& cmdLineGame, bool autoSort) {
 
   // Apply debug logging settings.
   enableDebugLogging(settings_.isDebugLoggingEnabled());
+  enableTracing(settings_.isTracingEnabled());
 
   // Now that settings have been loaded, set the locale again to handle
   // translations.
@@ -24,7 +24,11 @@
 #ifndef LOOT_GUI_STATE_LOOT_STATE
 #define LOOT_GUI_STATE_LOOT_STATE
 
+#include <mutex>
+#include <optional>
+
 #include "gui/state/change_count.h"
+#include "gui/state/game/detection.h"
 #include "gui/state/game/games_manager.h"
 #include "gui/state/loot_settings.h"
 
@@ -38,6 +42,16 @@ public:
             bool autoSort);
   void initCurrentGame();
 
+  // Detect installed games without changing any state, so that detection can
+  // be run off the UI thread. Concurrent detections are run one at a time.
+  InstalledGames detectInstalledGames(
+      const std::vector<GameSettings>& gamesSettings) const;
+
+  // Update the installed games and the detection timeout warning using the
+  // given detection results, and return the updated games' settings.
+  std::vector<GameSettings> applyInstalledGames(
+      const InstalledGames& installedGames);
+
   std::vector<GameSettings> loadInstalledGames(
       const std::vector<GameSettings>& gamesSettings);
 
@@ -71,6 +85,8 @@ private:
   std::vector<std::filesystem::path> xboxGamingRootPaths_;
   std::vector<std::string> preferredUILanguages_;
   std::vector<SourcedMessage> initMessages_;
+  std::optional<SourcedMessage> detectionTimeoutMessage_;
+  mutable std::mutex detectionMutex_;
   LootSettings settings_;
   ChangeCount unappliedChangeCount_;
 };
@@ -0,0 +1,303 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#include "gui/state/stage_graph.h"
+
+#include <fmt/ranges.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+#include "gui/state/logging.h"
+
+namespace {
+using loot::StageTiming;
+
+std::vector<StageTiming>::const_iterator findTiming(
+    const std::vector<StageTiming>& timings,
+    const std::string& name) {
+  return std::find_if(
+      timings.begin(), timings.end(), [&](const StageTiming& timing) {
+        return timing.name == name;
+      });
+}
+}
+
+namespace loot {
+std::chrono::milliseconds StageTiming::getDuration() const {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+}
+
+StageGraph::StageGraph(std::vector<std::string> upstreamStages) :
+    upstreamStages_(std::move(upstreamStages)) {}
+
+void StageGraph::addStage(const std::string& name,
+                          const std::vector<std::string>& dependencies,
+                          std::function<void()> function) {
+  const auto isNamed = [&](const Stage& stage) { return stage.name == name; };
+  if (std::any_of(stages_.begin(), stages_.end(), isNamed)) {
+    throw std::invalid_argument("The stage \"" + name +
+                                "\" has already been added");
+  }
+
+  Stage stage{name, {}, std::move(function)};
+  for (const auto& dependency : dependencies) {
+    const auto it = std::find_if(
+        stages_.begin(), stages_.end(), [&](const Stage& existingStage) {
+          return existingStage.name == dependency;
+        });
+    if (it == stages_.end()) {
+      throw std::invalid_argument("The stage \"" + name +
+                                  "\" depends on the unknown stage \"" +
+                                  dependency + "\"");
+    }
+
+    stage.dependencies.push_back(std::distance(stages_.begin(), it));
+  }
+
+  stages_.push_back(std::move(stage));
+}
+
+std::vector<StageTiming> StageGraph::run() const {
+  std::mutex mutex;
+  std::condition_variable stageFinished;
+  std::vector<bool> isStarted(stages_.size(), false);
+  std::vector<bool> isFinished(stages_.size(), false);
+  std::vector<StageTiming> timings(stages_.size());
+  std::exception_ptr exceptionPointer;
+  std::vector<std::thread> threads;
+  size_t runningCount = 0;
+
+  const auto executeStage = [&](size_t index) {
+    const auto& stage = stages_.at(index);
+    std::exception_ptr stageException;
+
+    const auto start = std::chrono::steady_clock::now();
+    try {
+      stage.function();
+    } catch (...) {
+      stageException = std::current_exception();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> guard(mutex);
+    timings.at(index) =
+        StageTiming{stage.name, getDependencyNames(stage), start, end};
+    isFinished.at(index) = true;
+    runningCount -= 1;
+    if (stageException != nullptr && exceptionPointer == nullptr) {
+      exceptionPointer = stageException;
+    }
+    stageFinished.notify_one();
+  };
+
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    if (exceptionPointer == nullptr) {
+      for (size_t i = 0; i < stages_.size(); i += 1) {
+        const auto& dependencies = stages_.at(i).dependencies;
+        const auto isReady = !isStarted.at(i) &&
+                             std::all_of(dependencies.begin(),
+                                         dependencies.end(),
+                                         [&](size_t dependency) {
+                                           return isFinished.at(dependency);
+                                         });
+        if (isReady) {
+          isStarted.at(i) = true;
+          runningCount += 1;
+          threads.emplace_back(executeStage, i);
+        }
+      }
+    }
+
+    // Dependencies are always added before their dependents, so if nothing
+    // is running then every stage has run or an exception was thrown.
+    if (runningCount == 0) {
+      break;
+    }
+
+    stageFinished.wait(lock);
+  }
+  lock.unlock();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (exceptionPointer != nullptr) {
+    std::rethrow_exception(exceptionPointer);
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    for (const auto& timing : timings) {
+      logger->debug("Stage \"{}\" took {} ms",
+                    timing.name,
+                    timing.getDuration().count());
+    }
+  }
+
+  return timings;
+}
+
+std::vector<std::string> StageGraph::getDependencyNames(
+    const Stage& stage) const {
+  if (stage.dependencies.empty()) {
+    return upstreamStages_;
+  }
+
+  std::vector<std::string> names;
+  for (const auto dependency : stage.dependencies) {
+    names.push_back(stages_.at(dependency).name);
+  }
+
+  return names;
+}
+
+void StageTimings::record(const StageTiming& timing) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (!isFinished_) {
+    timings_.push_back(timing);
+  }
+}
+
+void StageTimings::record(const std::vector<StageTiming>& timings) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (!isFinished_) {
+    timings_.insert(timings_.end(), timings.begin(), timings.end());
+  }
+}
+
+void StageTimings::finish() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (isFinished_) {
+      return;
+    }
+    isFinished_ = true;
+  }
+
+  const auto logger = getLogger();
+  if (!logger) {
+    return;
+  }
+
+  const auto timings = getTimings();
+  if (timings.empty()) {
+    return;
+  }
+
+  const auto firstStart =
+      std::min_element(timings.begin(),
+                       timings.end(),
+                       [](const StageTiming& lhs, const StageTiming& rhs) {
+                         return lhs.start < rhs.start;
+                       })
+          ->start;
+
+  for (const auto& timing : timings) {
+    logger->info(
+        "Startup stage \"{}\" started at {} ms and took {} ms",
+        timing.name,
+        std::chrono::duration_cast<std::chrono::milliseconds>(timing.start -
+                                                              firstStart)
+            .count(),
+        timing.getDuration().count());
+  }
+
+  const auto slowestPath = getSlowestPath();
+  const auto lastEnd = findTiming(timings, slowestPath.back())->end;
+
+  logger->info(
+      "Startup took {} ms, the slowest path was: {}",
+      std::chrono::duration_cast<std::chrono::milliseconds>(lastEnd -
+                                                            firstStart)
+          .count(),
+      fmt::join(slowestPath, " -> "));
+}
+
+std::vector<StageTiming> StageTimings::getTimings() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return timings_;
+}
+
+std::vector<std::string> StageTimings::getSlowestPath() const {
+  const auto timings = getTimings();
+
+  auto it = std::max_element(
+      timings.begin(),
+      timings.end(),
+      [](const StageTiming& lhs, const StageTiming& rhs) {
+        return lhs.end < rhs.end;
+      });
+
+  std::vector<std::string> path;
+  while (it != timings.end()) {
+    path.push_back(it->name);
+
+    auto slowestDependency = timings.end();
+    for (const auto& dependency : it->dependencies) {
+      const auto dependencyIt = findTiming(timings, dependency);
+      if (dependencyIt != timings.end() &&
+          (slowestDependency == timings.end() ||
+           dependencyIt->end > slowestDependency->end)) {
+        slowestDependency = dependencyIt;
+      }
+    }
+
+    it = slowestDependency;
+  }
+
+  std::reverse(path.begin(), path.end());
+
+  return path;
+}
+
+StageTiming runStage(const std::string& name,
+                     const std::vector<std::string>& dependencies,
+                     const std::function<void()>& function) {
+  const auto start = std::chrono::steady_clock::now();
+  function();
+  const auto end = std::chrono::steady_clock::now();
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->debug("Stage \"{}\" took {} ms",
+                  name,
+                  std::chrono::duration_cast<std::chrono::milliseconds>(end -
+                                                                        start)
+                      .count());
+  }
+
+  return StageTiming{name, dependencies, start, end};
+}
+
+StageTimings& getStartupStageTimings() {
+  static StageTimings timings;
+  return timings;
+}
+}
@@ -0,0 +1,108 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_GUI_STATE_STAGE_GRAPH
+#define LOOT_GUI_STATE_STAGE_GRAPH
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace loot {
+struct StageTiming {
+  std::string name;
+  std::vector<std::string> dependencies;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point end;
+
+  std::chrono::milliseconds getDuration() const;
+};
+
+// A set of named stages that are run as soon as all the stages they depend on
+// have finished, so that independent stages run concurrently.
+class StageGraph {
+public:
+  StageGraph() = default;
+
+  // Stages that have no dependencies in this graph are recorded as depending
+  // on the given upstream stages, which must have already run.
+  explicit StageGraph(std::vector<std::string> upstreamStages);
+
+  // A stage's dependencies must have been added before it.
+  void addStage(const std::string& name,
+                const std::vector<std::string>& dependencies,
+                std::function<void()> function);
+
+  // Runs all stages and returns their timings in the order that the stages
+  // were added. If a stage throws, no more stages are started, and the first
+  // exception thrown is rethrown once all running stages have finished.
+  std::vector<StageTiming> run() const;
+
+private:
+  struct Stage {
+    std::string name;
+    std::vector<size_t> dependencies;
+    std::function<void()> function;
+  };
+
+  std::vector<std::string> upstreamStages_;
+  std::vector<Stage> stages_;
+
+  std::vector<std::string> getDependencyNames(const Stage& stage) const;
+};
+
+// Collects the timings of stages run during LOOT's startup, which happen
+// across several stage graphs.
+class StageTimings {
+public:
+  // Timings recorded after finish() has been called are ignored.
+  void record(const StageTiming& timing);
+  void record(const std::vector<StageTiming>& timings);
+
+  // Logs the recorded timings and the slowest path through them.
+  void finish();
+
+  std::vector<StageTiming> getTimings() const;
+
+  // Returns the names of the stages on the slowest path, in the order that
+  // they ran. The path ends with the stage that ended last, and each stage
+  // before it is the dependency of the next one that ended last.
+  std::vector<std::string> getSlowestPath() const;
+
+private:
+  mutable std::mutex mutex_;
+  bool isFinished_{false};
+  std::vector<StageTiming> timings_;
+};
+
+StageTiming runStage(const std::string& name,
+                     const std::vector<std::string>& dependencies,
+                     const std::function<void()>& function);
+
+StageTimings& getStartupStageTimings();
+}
+
+#endif
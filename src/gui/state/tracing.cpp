@@ -0,0 +1,215 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/tracing.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "gui/state/logging.h"
+
+namespace {
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
+
+std::string escapeJsonString(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+
+  for (const auto character : value) {
+    switch (character) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\r':
+        escaped += "\\r";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(character) < 0x20) {
+          escaped += fmt::format("\\u{:04x}", static_cast<int>(character));
+        } else {
+          escaped += character;
+        }
+    }
+  }
+
+  return escaped;
+}
+
+// Events are written to the trace file as they're recorded so that a trace
+// survives LOOT crashing. The trace-event JSON array format allows the
+// closing bracket to be omitted, so it's never written.
+class TraceWriter {
+public:
+  static TraceWriter& instance() {
+    static TraceWriter writer;
+    return writer;
+  }
+
+  void setPath(const std::filesystem::path& path) {
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    out_.close();
+    path_ = path;
+    hasStartedFile_ = false;
+    threadIds_.clear();
+
+    if (enabled_) {
+      open();
+    }
+  }
+
+  void enable(bool enable) {
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if (enable && !out_.is_open()) {
+      open();
+    } else if (!enable) {
+      out_.close();
+    }
+
+    enabled_ = enable && out_.is_open();
+  }
+
+  bool isEnabled() const { return enabled_; }
+
+  void write(const char* category,
+             const std::string& name,
+             steady_clock::time_point start,
+             steady_clock::time_point end) {
+    if (!enabled_) {
+      return;
+    }
+
+    // Timestamps are in microseconds.
+    const auto timestamp =
+        duration_cast<microseconds>(std::max(start, origin_) - origin_);
+    const auto duration =
+        duration_cast<microseconds>(std::max(end, start) - start);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!out_.is_open()) {
+      return;
+    }
+
+    // Chrome displays small sequential thread IDs more readably than the
+    // platform's thread IDs.
+    const auto threadId =
+        threadIds_.emplace(std::this_thread::get_id(), threadIds_.size() + 1)
+            .first->second;
+
+    out_ << fmt::format(
+        ",\n{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"X\",\"ts\":{},"
+        "\"dur\":{},\"pid\":1,\"tid\":{}}}",
+        escapeJsonString(name),
+        escapeJsonString(category),
+        timestamp.count(),
+        duration.count(),
+        threadId);
+    out_.flush();
+  }
+
+private:
+  std::atomic<bool> enabled_{false};
+  const steady_clock::time_point origin_{steady_clock::now()};
+
+  std::mutex mutex_;
+  std::filesystem::path path_;
+  std::ofstream out_;
+  // True if this process has already written the start of the trace to
+  // path_, in which case further events are appended.
+  bool hasStartedFile_{false};
+  std::map<std::thread::id, size_t> threadIds_;
+
+  void open() {
+    if (path_.empty()) {
+      return;
+    }
+
+    const auto mode = hasStartedFile_ ? std::ios::app : std::ios::trunc;
+    out_.open(path_, std::ios::binary | std::ios::out | mode);
+    if (!out_.is_open()) {
+      const auto logger = loot::getLogger();
+      if (logger) {
+        logger->error("Could not open the trace file at {}",
+                      path_.u8string());
+      }
+      return;
+    }
+
+    if (!hasStartedFile_) {
+      out_ << "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,"
+              "\"args\":{\"name\":\"LOOT\"}}";
+      out_.flush();
+      hasStartedFile_ = true;
+    }
+  }
+};
+}
+
+namespace loot {
+void setTracePath(const std::filesystem::path& outputFile) {
+  TraceWriter::instance().setPath(outputFile);
+}
+
+void enableTracing(bool enable) { TraceWriter::instance().enable(enable); }
+
+bool isTracingEnabled() { return TraceWriter::instance().isEnabled(); }
+
+void recordTraceEvent(const char* category,
+                      const std::string& name,
+                      std::chrono::steady_clock::time_point start,
+                      std::chrono::steady_clock::time_point end) {
+  TraceWriter::instance().write(category, name, start, end);
+}
+
+TraceSpan::TraceSpan(const char* category, std::string name) :
+    category_(category) {
+  if (isTracingEnabled()) {
+    name_ = std::move(name);
+    start_ = steady_clock::now();
+  }
+}
+
+TraceSpan::~TraceSpan() {
+  if (start_.has_value()) {
+    recordTraceEvent(category_, name_, start_.value(), steady_clock::now());
+  }
+}
+}
@@ -0,0 +1,68 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_TRACING
+#define LOOT_GUI_STATE_TRACING
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace loot {
+// Tracing records how long LOOT spends running queries, tasks, libloot calls
+// and filesystem scans, and on which threads. The events are written as
+// Chrome trace-event JSON so that they can be opened in a trace viewer such
+// as Perfetto or chrome://tracing.
+void setTracePath(const std::filesystem::path& outputFile);
+
+void enableTracing(bool enable);
+
+bool isTracingEnabled();
+
+// Records an event that started and ended at the given times on the calling
+// thread. Does nothing if tracing is disabled.
+void recordTraceEvent(const char* category,
+                      const std::string& name,
+                      std::chrono::steady_clock::time_point start,
+                      std::chrono::steady_clock::time_point end);
+
+// Records an event that lasts for the lifetime of the span.
+class TraceSpan {
+public:
+  TraceSpan(const char* category, std::string name);
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan(TraceSpan&&) = delete;
+  ~TraceSpan();
+
+  TraceSpan& operator=(const TraceSpan&) = delete;
+  TraceSpan& operator=(TraceSpan&&) = delete;
+
+private:
+  const char* category_;
+  std::string name_;
+  std::optional<std::chrono::steady_clock::time_point> start_;
+};
+}
+
+#endif
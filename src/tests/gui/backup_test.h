@@ -23,24 +23,130 @@
 #ifndef LOOT_TESTS_GUI_BACKUP_TEST
 #define LOOT_TESTS_GUI_BACKUP_TEST
 
+
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include "gui/backup.h"
 #include "tests/gui/test_helpers.h"
 
 namespace loot {
 namespace test {
-class BackupTest : public ::testing::Test {
+struct ZipEntry {
+  std::string name;
+  uint16_t compressionMethod{0};
+  uint32_t crc{0};
+  uint32_t compressedSize{0};
+  uint32_t uncompressedSize{0};
+};
+
+uint32_t readLittleEndian(const std::vector<char>& bytes,
+                          size_t offset,
+                          size_t size) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < size; i += 1) {
+    value |= static_cast<uint32_t>(static_cast<uint8_t>(bytes.at(offset + i)))
+             << (8 * i);
+  }
+  return value;
+}
+
+// minizip-ng is not compiled with support for decompression, so read the
+// archive's central directory directly.
+std::vector<ZipEntry> readZipEntries(const std::filesystem::path& path) {
+  static constexpr uint32_t END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054b50;
+  static constexpr uint32_t CENTRAL_DIRECTORY_HEADER_SIGNATURE = 0x02014b50;
+  static constexpr size_t END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+  static constexpr size_t CENTRAL_DIRECTORY_HEADER_SIZE = 46;
+
+  std::ifstream in(path, std::ios::binary);
+  const std::vector<char> bytes{std::istreambuf_iterator<char>(in),
+                                std::istreambuf_iterator<char>()};
+
+  size_t endOffset = bytes.size() - END_OF_CENTRAL_DIRECTORY_SIZE;
+  while (readLittleEndian(bytes, endOffset, 4) !=
+         END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+    endOffset -= 1;
+  }
+
+  const auto entryCount = readLittleEndian(bytes, endOffset + 10, 2);
+  size_t offset = readLittleEndian(bytes, endOffset + 16, 4);
+
+  std::vector<ZipEntry> entries;
+  for (uint32_t i = 0; i < entryCount; i += 1) {
+    EXPECT_EQ(CENTRAL_DIRECTORY_HEADER_SIGNATURE,
+              readLittleEndian(bytes, offset, 4));
+
+    ZipEntry entry;
+    entry.compressionMethod =
+        static_cast<uint16_t>(readLittleEndian(bytes, offset + 10, 2));
+    entry.crc = readLittleEndian(bytes, offset + 16, 4);
+    entry.compressedSize = readLittleEndian(bytes, offset + 20, 4);
+    entry.uncompressedSize = readLittleEndian(bytes, offset + 24, 4);
+
+    const auto nameLength = readLittleEndian(bytes, offset + 28, 2);
+    const auto extraLength = readLittleEndian(bytes, offset + 30, 2);
+    const auto commentLength = readLittleEndian(bytes, offset + 32, 2);
+
+    const auto nameStart = bytes.begin() + static_cast<std::ptrdiff_t>(
+                                               offset +
+                                               CENTRAL_DIRECTORY_HEADER_SIZE);
+    entry.name = std::string(nameStart, nameStart + nameLength);
+
+    entries.push_back(entry);
+
+    offset += CENTRAL_DIRECTORY_HEADER_SIZE + nameLength + extraLength +
+              commentLength;
+  }
+
+  return entries;
+}
+
+std::optional<ZipEntry> findZipEntry(const std::vector<ZipEntry>& entries,
+                                     const std::string& name) {
+  const auto it =
+      std::find_if(entries.begin(), entries.end(), [&](const ZipEntry& entry) {
+        return entry.name == name;
+      });
+
+  if (it == entries.end()) {
+    return std::nullopt;
+  }
+
+  return *it;
+}
+
+uint32_t calculateCrc32(const std::string& data) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (const auto byte : data) {
+    crc ^= static_cast<uint8_t>(byte);
+    for (int i = 0; i < 8; i += 1) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+class CreateBackupTest : public ::testing::Test {
 public:
-  BackupTest() : sourceRoot(getTempPath()), destRoot(getTempPath()) {}
+  CreateBackupTest() :
+      sourceRoot(getTempPath()),
+      destRoot(getTempPath()),
+      archivePath(destRoot / "backup.zip") {}
 
 protected:
   static constexpr const char* EMPTY_FOLDER = "emptyFolder";
   static constexpr const char* GIT_FOLDER = ".git";
   static constexpr const char* DEBUG_LOG = "LOOTDebugLog.txt";
+  static constexpr const char* TRACE = "LOOTTrace.json";
   static constexpr const char* BACKUPS_FOLDER = "backups";
   static constexpr const char* ROOT_DIR_FILE = "rootFile.txt";
   static constexpr const char* SUB_FOLDER = "subFolder";
@@ -57,7 +163,8 @@ protected:
     std::filesystem::create_directories(sourceRoot / SUB_FOLDER / GIT_FOLDER);
 
     touch(sourceRoot / DEBUG_LOG);
-    touch(sourceRoot / ROOT_DIR_FILE);
+    touch(sourceRoot / TRACE);
+    writeFile(sourceRoot / ROOT_DIR_FILE, rootFileContent);
     touch(sourceRoot / BACKUPS_FOLDER / BACKUP_FILE);
     touch(sourceRoot / SUB_FOLDER / SUB_FOLDER_FILE);
     touch(sourceRoot / SUB_FOLDER / GIT_FOLDER / GIT_CONFIG);
@@ -68,77 +175,133 @@ protected:
     std::filesystem::remove_all(destRoot);
   }
 
+  void writeFile(const std::filesystem::path& path,
+                 const std::string& content) {
+    std::ofstream out(path, std::ios::binary);
+    out << content;
+  }
+
   std::filesystem::path sourceRoot;
   std::filesystem::path destRoot;
+  std::filesystem::path archivePath;
+  std::string rootFileContent = std::string(1000, 'a');
 };
 
-class CompressDirectoryTest : public BackupTest {};
+TEST_F(CreateBackupTest, shouldReturnNulloptIfThereAreNoFilesToBackUp) {
+  const auto emptyDir = sourceRoot / EMPTY_FOLDER;
 
-class CreateBackupTest : public BackupTest {};
+  EXPECT_FALSE(createBackup(emptyDir, archivePath).has_value());
+  EXPECT_FALSE(std::filesystem::exists(archivePath));
+}
 
-TEST_F(CompressDirectoryTest, shouldReturnThePathToAZipOfTheInput) {
-  createBackup(sourceRoot, destRoot);
+TEST_F(CreateBackupTest, shouldAddFilesInSourceDirToTheArchive) {
+  const auto stats = createBackup(sourceRoot, archivePath);
 
-  auto archivePath = compressDirectory(destRoot);
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(2, stats->fileCount);
+  EXPECT_EQ(0, stats->reusedFileCount);
+  EXPECT_EQ(rootFileContent.size(), stats->byteCount);
 
-  EXPECT_TRUE(std::filesystem::exists(archivePath));
+  const auto entries = readZipEntries(archivePath);
+  ASSERT_EQ(2, entries.size());
+  EXPECT_TRUE(findZipEntry(entries, ROOT_DIR_FILE).has_value());
+  EXPECT_TRUE(
+      findZipEntry(entries, std::string(SUB_FOLDER) + "/" + SUB_FOLDER_FILE)
+          .has_value());
+}
 
-  // Just check the file size because minizip-ng is not compiled with support
-  // for decompression. The size is different on Windows and Linux due to
-  // different amounts of filesystem metadata being stored.
-#ifdef _WIN32
-  auto expectedSize = 656;
-#else
-  auto expectedSize = 440;
-#endif
+TEST_F(CreateBackupTest, shouldCompressFilesAndRecordTheirCrcAndSize) {
+  createBackup(sourceRoot, archivePath);
 
-  auto archiveSize = std::filesystem::file_size(archivePath);
-  EXPECT_EQ(expectedSize, archiveSize);
+  const auto entry = findZipEntry(readZipEntries(archivePath), ROOT_DIR_FILE);
 
-  std::filesystem::remove(archivePath);
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(8, entry->compressionMethod);
+  EXPECT_LT(entry->compressedSize, rootFileContent.size());
+  EXPECT_EQ(rootFileContent.size(), entry->uncompressedSize);
+  EXPECT_EQ(calculateCrc32(rootFileContent), entry->crc);
 }
 
-TEST_F(CreateBackupTest, shouldRecursivelyCopyFilesInSourceDirToDestDir) {
-  createBackup(sourceRoot, destRoot);
+TEST_F(CreateBackupTest, shouldSkipDebugLogInRootDir) {
+  createBackup(sourceRoot, archivePath);
 
-  EXPECT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  EXPECT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+  EXPECT_FALSE(
+      findZipEntry(readZipEntries(archivePath), DEBUG_LOG).has_value());
 }
 
-TEST_F(CreateBackupTest, shouldSkipDebugLogInRootDir) {
-  createBackup(sourceRoot, destRoot);
-
-  ASSERT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  ASSERT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+TEST_F(CreateBackupTest, shouldSkipTraceInRootDir) {
+  createBackup(sourceRoot, archivePath);
 
-  EXPECT_FALSE(std::filesystem::exists(destRoot / DEBUG_LOG));
+  EXPECT_FALSE(findZipEntry(readZipEntries(archivePath), TRACE).has_value());
 }
 
 TEST_F(CreateBackupTest, shouldSkipBackupsDirectoryInRootDir) {
-  createBackup(sourceRoot, destRoot);
-
-  ASSERT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  ASSERT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+  createBackup(sourceRoot, archivePath);
 
-  EXPECT_FALSE(std::filesystem::exists(destRoot / BACKUPS_FOLDER));
+  for (const auto& entry : readZipEntries(archivePath)) {
+    EXPECT_NE(0, entry.name.rfind(BACKUPS_FOLDER, 0));
+  }
 }
 
 TEST_F(CreateBackupTest, shouldSkipDotGitFolderInAnyDirectory) {
-  createBackup(sourceRoot, destRoot);
+  createBackup(sourceRoot, archivePath);
 
-  ASSERT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  ASSERT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+  for (const auto& entry : readZipEntries(archivePath)) {
+    EXPECT_EQ(std::string::npos, entry.name.find(GIT_FOLDER));
+  }
+}
+
+TEST_F(CreateBackupTest,
+       shouldReuseFilesThatAreUnchangedSinceThePreviousBackup) {
+  createBackup(sourceRoot, archivePath);
+
+  const auto secondArchivePath = destRoot / "backup2.zip";
+  const auto stats = createBackup(sourceRoot, secondArchivePath);
+
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(2, stats->reusedFileCount);
+
+  const auto entry =
+      findZipEntry(readZipEntries(secondArchivePath), ROOT_DIR_FILE);
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(rootFileContent.size(), entry->uncompressedSize);
+  EXPECT_EQ(calculateCrc32(rootFileContent), entry->crc);
+  EXPECT_EQ(
+      findZipEntry(readZipEntries(archivePath), ROOT_DIR_FILE)->compressedSize,
+      entry->compressedSize);
+}
+
+TEST_F(CreateBackupTest,
+       shouldCompressFilesThatHaveChangedSinceThePreviousBackup) {
+  createBackup(sourceRoot, archivePath);
+
+  const std::string newContent = "changed";
+  writeFile(sourceRoot / ROOT_DIR_FILE, newContent);
 
-  EXPECT_FALSE(std::filesystem::exists(destRoot / SUB_FOLDER / GIT_FOLDER));
+  const auto secondArchivePath = destRoot / "backup2.zip";
+  const auto stats = createBackup(sourceRoot, secondArchivePath);
+
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(1, stats->reusedFileCount);
+
+  const auto entry =
+      findZipEntry(readZipEntries(secondArchivePath), ROOT_DIR_FILE);
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(newContent.size(), entry->uncompressedSize);
+  EXPECT_EQ(calculateCrc32(newContent), entry->crc);
 }
 
-TEST_F(CreateBackupTest, shouldSkipEmptyDirectories) {
-  createBackup(sourceRoot, destRoot);
+TEST_F(CreateBackupTest, shouldNotReuseFilesIfThePreviousArchiveHasChanged) {
+  createBackup(sourceRoot, archivePath);
+
+  std::ofstream out(archivePath, std::ios::binary | std::ios::app);
+  out << "trailing data";
+  out.close();
 
-  ASSERT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  ASSERT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+  const auto stats = createBackup(sourceRoot, destRoot / "backup2.zip");
 
-  EXPECT_FALSE(std::filesystem::exists(destRoot / EMPTY_FOLDER));
+  ASSERT_TRUE(stats.has_value());
+  EXPECT_EQ(0, stats->reusedFileCount);
 }
 }
 }
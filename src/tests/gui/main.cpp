@@ -33,14 +33,24 @@
 #include <spdlog/spdlog.h>
 #endif
 
-#include <QtCore/QCoreApplication>
+#include <QtWidgets/QApplication>
 
 #include "tests/gui/backup_test.h"
 #include "tests/gui/helpers_test.h"
+#include "tests/gui/qt/card_height_calculator_test.h"
+#include "tests/gui/qt/counters_test.h"
+#include "tests/gui/qt/diagnostics_report_test.h"
+#include "tests/gui/qt/groups_editor/layout_input_test.h"
 #include "tests/gui/qt/helpers_test.h"
+#include "tests/gui/qt/tasks/network_task_test.h"
+#include "tests/gui/qt/tasks/task_scheduler_test.h"
 #include "tests/gui/qt/tasks/tasks_test.h"
+#include "tests/gui/qt/tasks/update_masterlist_task_test.h"
 #include "tests/gui/sourced_message_test.h"
+#include "tests/gui/state/censoring_file_sink_test.h"
 #include "tests/gui/state/change_count_test.h"
+#include "tests/gui/state/diagnostics_test.h"
+#include "tests/gui/state/game/detection/cache_test.h"
 #include "tests/gui/state/game/detection/common_test.h"
 #include "tests/gui/state/game/detection/detail_test.h"
 #include "tests/gui/state/game/detection/epic_games_store_test.h"
@@ -57,13 +67,21 @@
 #include "tests/gui/state/game/helpers_test.h"
 #include "tests/gui/state/loot_paths_test.h"
 #include "tests/gui/state/loot_settings_test.h"
+#include "tests/gui/state/stage_graph_test.h"
+#include "tests/gui/state/tracing_test.h"
 #include "tests/printers.h"
 
 int main(int argc, char** argv) {
   // Set the logger to use a null sink.
   spdlog::create<spdlog::sinks::null_sink_st>("loot_logger");
 
-  QCoreApplication app(argc, argv);
+  // Card sizing tests create widgets, so use a platform plugin that doesn't
+  // need a display unless one has been chosen.
+  if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
+  QApplication app(argc, argv);
 
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,197 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_CARD_HEIGHT_CALCULATOR_TEST
+#define LOOT_TESTS_GUI_QT_CARD_HEIGHT_CALCULATOR_TEST
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <QtWidgets/QLayout>
+#include <QtWidgets/QWidget>
+
+#include "gui/qt/card_height_calculator.h"
+#include "gui/qt/plugin_card.h"
+
+namespace loot::test {
+// The calculator doesn't lay out any widgets, so allow for rounding differences
+// in the sizes that the card's layouts give their text.
+constexpr int CARD_SIZE_TOLERANCE = 2;
+
+PluginItem createNamedPluginItem() {
+  PluginItem plugin;
+  plugin.name = "Blank.esp";
+  plugin.isActive = true;
+
+  return plugin;
+}
+
+PluginItem createFullPluginItem() {
+  auto plugin = createNamedPluginItem();
+  plugin.crc = 0xDEADBEEF;
+  plugin.version = "1.0.0";
+  plugin.isMaster = true;
+  plugin.loadsArchive = true;
+  plugin.hasUserMetadata = true;
+  plugin.cleaningUtility = "TES4Edit";
+
+  plugin.currentTags = {"Actors.AIData", "C.Climate", "Delev", "Graphics"};
+  plugin.addTags = {"Relev"};
+  plugin.removeTags = {"Invent.Add", "Invent.Remove"};
+
+  plugin.messages = {
+      SourcedMessage{MessageType::say, MessageSource::messageMetadata, "Note"},
+      SourcedMessage{MessageType::warn,
+                     MessageSource::messageMetadata,
+                     "A much longer warning message that should wrap onto "
+                     "several lines when the card is narrow enough for the "
+                     "text to no longer fit on one line."},
+      SourcedMessage{MessageType::error,
+                     MessageSource::messageMetadata,
+                     "An error with **formatting** and a "
+                     "[link](https://example.com)."}};
+
+  plugin.locations = {
+      Location("https://www.nexusmods.com/skyrimspecialedition/mods/1",
+               "Nexus Mods"),
+      Location("https://example.com/a/rather/long/path/to/another/source",
+               "Another source")};
+
+  return plugin;
+}
+
+class CardHeightCalculatorTest : public ::testing::TestWithParam<int> {
+protected:
+  CardHeightCalculatorTest() : card(new PluginCard(&parent)) {
+    auto sizePolicy = card->sizePolicy();
+    sizePolicy.setRetainSizeWhenHidden(true);
+    card->setSizePolicy(sizePolicy);
+    card->setHidden(true);
+  }
+
+  int getCardMinimumWidth(const PluginItem& plugin, bool hasHiddenMessages) {
+    card->setContent(plugin, hasHiddenMessages);
+    return card->layout()->minimumSize().width();
+  }
+
+  int getCardHeight(const PluginItem& plugin, int width) {
+    card->setContent(plugin, false);
+    return card->hasHeightForWidth()
+               ? card->layout()->minimumHeightForWidth(width)
+               : card->minimumHeight();
+  }
+
+  CardHeightCalculator getCalculator() const {
+    return CardHeightCalculator(card->getLayoutMetrics());
+  }
+
+  QWidget parent;
+  PluginCard* card;
+};
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CardHeightCalculatorTest,
+                         ::testing::Values(300, 600, 1200));
+
+TEST_P(CardHeightCalculatorTest,
+       calculateMinimumWidthShouldMatchCardWithOnlyAName) {
+  const auto plugin = createNamedPluginItem();
+
+  EXPECT_NEAR(getCardMinimumWidth(plugin, false),
+              getCalculator().calculateMinimumWidth(plugin, false),
+              CARD_SIZE_TOLERANCE);
+}
+
+TEST_P(CardHeightCalculatorTest,
+       calculateMinimumWidthShouldMatchCardWithAllContent) {
+  const auto plugin = createFullPluginItem();
+
+  EXPECT_NEAR(getCardMinimumWidth(plugin, true),
+              getCalculator().calculateMinimumWidth(plugin, true),
+              CARD_SIZE_TOLERANCE);
+}
+
+TEST_P(CardHeightCalculatorTest, calculateHeightShouldMatchCardWithOnlyAName) {
+  const auto plugin = createNamedPluginItem();
+  const auto width = std::max(GetParam(), getCardMinimumWidth(plugin, false));
+
+  EXPECT_NEAR(getCardHeight(plugin, width),
+              getCalculator().calculateHeight(plugin, width),
+              CARD_SIZE_TOLERANCE);
+}
+
+TEST_P(CardHeightCalculatorTest, calculateHeightShouldMatchCardWithMessages) {
+  auto plugin = createNamedPluginItem();
+  plugin.messages = createFullPluginItem().messages;
+  const auto width = std::max(GetParam(), getCardMinimumWidth(plugin, false));
+
+  EXPECT_NEAR(getCardHeight(plugin, width),
+              getCalculator().calculateHeight(plugin, width),
+              CARD_SIZE_TOLERANCE);
+}
+
+TEST_P(CardHeightCalculatorTest, calculateHeightShouldMatchCardWithBashTags) {
+  auto plugin = createNamedPluginItem();
+  plugin.currentTags = createFullPluginItem().currentTags;
+  plugin.removeTags = createFullPluginItem().removeTags;
+  const auto width = std::max(GetParam(), getCardMinimumWidth(plugin, false));
+
+  EXPECT_NEAR(getCardHeight(plugin, width),
+              getCalculator().calculateHeight(plugin, width),
+              CARD_SIZE_TOLERANCE);
+}
+
+TEST_P(CardHeightCalculatorTest, calculateHeightShouldMatchCardWithLocations) {
+  auto plugin = createNamedPluginItem();
+  plugin.locations = createFullPluginItem().locations;
+  const auto width = std::max(GetParam(), getCardMinimumWidth(plugin, false));
+
+  EXPECT_NEAR(getCardHeight(plugin, width),
+              getCalculator().calculateHeight(plugin, width),
+              CARD_SIZE_TOLERANCE);
+}
+
+TEST_P(CardHeightCalculatorTest, calculateHeightShouldMatchCardWithAllContent) {
+  const auto plugin = createFullPluginItem();
+  const auto width = std::max(GetParam(), getCardMinimumWidth(plugin, false));
+
+  EXPECT_NEAR(getCardHeight(plugin, width),
+              getCalculator().calculateHeight(plugin, width),
+              CARD_SIZE_TOLERANCE);
+}
+
+TEST_P(CardHeightCalculatorTest,
+       calculateHeightShouldMatchCardWithoutVersionOrCrc) {
+  auto plugin = createFullPluginItem();
+  plugin.crc = std::nullopt;
+  plugin.version = std::nullopt;
+  const auto width = std::max(GetParam(), getCardMinimumWidth(plugin, false));
+
+  EXPECT_NEAR(getCardHeight(plugin, width),
+              getCalculator().calculateHeight(plugin, width),
+              CARD_SIZE_TOLERANCE);
+}
+}
+
+#endif
@@ -0,0 +1,131 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_COUNTERS_TEST
+#define LOOT_TESTS_GUI_QT_COUNTERS_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/counters.h"
+
+namespace loot::test {
+PluginItem createCountedPluginItem() {
+  PluginItem plugin;
+  plugin.isActive = true;
+  plugin.isLightPlugin = true;
+  plugin.isDirty = true;
+  plugin.messages = {
+      SourcedMessage{MessageType::say, MessageSource::messageMetadata, "1"},
+      SourcedMessage{MessageType::warn, MessageSource::messageMetadata, "2"},
+      SourcedMessage{MessageType::error, MessageSource::messageMetadata, "3"}};
+
+  return plugin;
+}
+
+TEST(GeneralInformationCounters, constructorShouldCountPluginsAndMessages) {
+  const std::vector<SourcedMessage> generalMessages{
+      SourcedMessage{MessageType::error, MessageSource::init, "general"}};
+  PluginItem fullPlugin;
+  fullPlugin.isActive = true;
+
+  const auto counters = GeneralInformationCounters(
+      generalMessages, {createCountedPluginItem(), fullPlugin, PluginItem()});
+
+  EXPECT_EQ(1, counters.warnings);
+  EXPECT_EQ(2, counters.errors);
+  EXPECT_EQ(4, counters.totalMessages);
+  EXPECT_EQ(1, counters.activeLight);
+  EXPECT_EQ(0, counters.activeMedium);
+  EXPECT_EQ(1, counters.activeFull);
+  EXPECT_EQ(1, counters.dirty);
+  EXPECT_EQ(3, counters.totalPlugins);
+}
+
+TEST(GeneralInformationCounters,
+     removePluginShouldUndoAddPluginForTheSamePlugin) {
+  const auto plugin = createCountedPluginItem();
+  PluginItem otherPlugin;
+  otherPlugin.isActive = true;
+  otherPlugin.isMediumPlugin = true;
+
+  auto counters = GeneralInformationCounters({}, {otherPlugin});
+  counters.addPlugin(plugin);
+  counters.removePlugin(plugin);
+
+  EXPECT_EQ(0, counters.warnings);
+  EXPECT_EQ(0, counters.errors);
+  EXPECT_EQ(0, counters.totalMessages);
+  EXPECT_EQ(0, counters.activeLight);
+  EXPECT_EQ(1, counters.activeMedium);
+  EXPECT_EQ(0, counters.activeFull);
+  EXPECT_EQ(0, counters.dirty);
+  EXPECT_EQ(1, counters.totalPlugins);
+}
+
+TEST(GeneralInformationCounters,
+     replacingAPluginShouldGiveTheSameCountsAsRecounting) {
+  auto plugin = createCountedPluginItem();
+  auto counters = GeneralInformationCounters({}, {plugin});
+
+  auto newPlugin = plugin;
+  newPlugin.isDirty = false;
+  newPlugin.isLightPlugin = false;
+  newPlugin.messages.pop_back();
+
+  counters.removePlugin(plugin);
+  counters.addPlugin(newPlugin);
+
+  const auto recounted = GeneralInformationCounters({}, {newPlugin});
+
+  EXPECT_EQ(recounted.warnings, counters.warnings);
+  EXPECT_EQ(recounted.errors, counters.errors);
+  EXPECT_EQ(recounted.totalMessages, counters.totalMessages);
+  EXPECT_EQ(recounted.activeLight, counters.activeLight);
+  EXPECT_EQ(recounted.activeMedium, counters.activeMedium);
+  EXPECT_EQ(recounted.activeFull, counters.activeFull);
+  EXPECT_EQ(recounted.dirty, counters.dirty);
+  EXPECT_EQ(recounted.totalPlugins, counters.totalPlugins);
+}
+
+TEST(GeneralInformationCounters,
+     addMessagesAndRemoveMessagesShouldUpdateMessageCounts) {
+  const std::vector<SourcedMessage> messages{
+      SourcedMessage{MessageType::warn, MessageSource::init, "1"},
+      SourcedMessage{MessageType::say, MessageSource::init, "2"}};
+
+  auto counters = GeneralInformationCounters();
+  counters.addMessages(messages);
+
+  EXPECT_EQ(1, counters.warnings);
+  EXPECT_EQ(0, counters.errors);
+  EXPECT_EQ(2, counters.totalMessages);
+
+  counters.removeMessages(messages);
+
+  EXPECT_EQ(0, counters.warnings);
+  EXPECT_EQ(0, counters.errors);
+  EXPECT_EQ(0, counters.totalMessages);
+}
+}
+
+#endif
@@ -0,0 +1,122 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_DIAGNOSTICS_REPORT_TEST
+#define LOOT_TESTS_GUI_QT_DIAGNOSTICS_REPORT_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/diagnostics_report.h"
+
+namespace loot::test {
+TEST(PluginTypeCounts, constructorShouldCountPluginsByType) {
+  PluginItem master;
+  master.isActive = true;
+  master.isMaster = true;
+  PluginItem light;
+  light.isLightPlugin = true;
+  light.isMaster = true;
+  PluginItem medium;
+  medium.isActive = true;
+  medium.isMediumPlugin = true;
+  PluginItem empty;
+  empty.isEmpty = true;
+
+  const auto counts = PluginTypeCounts({master, light, medium, empty});
+
+  EXPECT_EQ(4, counts.total);
+  EXPECT_EQ(2, counts.active);
+  EXPECT_EQ(2, counts.full);
+  EXPECT_EQ(1, counts.medium);
+  EXPECT_EQ(1, counts.light);
+  EXPECT_EQ(2, counts.master);
+  EXPECT_EQ(1, counts.empty);
+}
+
+TEST(formatDiagnosticsReport, shouldIncludeStageStartTimesAndDurations) {
+  const auto start = std::chrono::steady_clock::now();
+
+  DiagnosticsReport report;
+  report.startupStageTimings = {
+      StageTiming{"settings", {}, start, start + std::chrono::milliseconds(5)},
+      StageTiming{"game init",
+                  {"settings"},
+                  start + std::chrono::milliseconds(5),
+                  start + std::chrono::milliseconds(12)}};
+  report.slowestStartupPath = {"settings", "game init"};
+
+  const auto text = formatDiagnosticsReport(report);
+
+  EXPECT_NE(std::string::npos,
+            text.find("  settings: started at 0 ms, took 5 ms\n"));
+  EXPECT_NE(std::string::npos,
+            text.find("  game init: started at 5 ms, took 7 ms\n"));
+  EXPECT_NE(std::string::npos,
+            text.find("  Slowest path: settings -> game init\n"));
+}
+
+TEST(formatDiagnosticsReport, shouldSayIfLoadingAndSortingHaveNotHappened) {
+  DiagnosticsReport report;
+  report.lastLoadDuration = std::chrono::milliseconds(123);
+
+  const auto text = formatDiagnosticsReport(report);
+
+  EXPECT_NE(std::string::npos, text.find("Last game data load: 123 ms\n"));
+  EXPECT_NE(std::string::npos, text.find("Last sort: not run this session\n"));
+}
+
+TEST(formatDiagnosticsReport, shouldIncludeMemoryInMebibytes) {
+  DiagnosticsReport report;
+  report.residentMemoryBytes = 3 * 1024 * 1024 / 2;
+
+  const auto text = formatDiagnosticsReport(report);
+
+  EXPECT_NE(std::string::npos, text.find("Resident memory: 1.5 MiB\n"));
+}
+
+TEST(formatDiagnosticsReport, shouldIncludeCacheHitRates) {
+  DiagnosticsReport report;
+  report.cacheStats.emplace("used", CacheStats{1, 3});
+  report.cacheStats.emplace("unused", CacheStats{});
+
+  const auto text = formatDiagnosticsReport(report);
+
+  EXPECT_NE(std::string::npos, text.find("  used: 25.0% (1 hits, 3 misses)\n"));
+  EXPECT_NE(std::string::npos, text.find("  unused: not used\n"));
+}
+
+TEST(formatDiagnosticsReport, shouldIncludeSchedulerQueueDepths) {
+  DiagnosticsReport report;
+  report.schedulerThreadCount = 4;
+  report.schedulerRunningTaskCount = 1;
+  report.schedulerLaneStats.at(1).queueDepth = 2;
+
+  const auto text = formatDiagnosticsReport(report);
+
+  EXPECT_NE(std::string::npos,
+            text.find("Task scheduler: 4 threads, 1 tasks running\n"));
+  EXPECT_NE(std::string::npos, text.find("  background: 2 waiting,"));
+}
+}
+
+#endif
@@ -0,0 +1,145 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_TESTS_GUI_QT_GROUPS_EDITOR_LAYOUT_INPUT_TEST
+#define LOOT_TESTS_GUI_QT_GROUPS_EDITOR_LAYOUT_INPUT_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/groups_editor/layout_input.h"
+
+namespace loot::test {
+GraphLayoutInput createGraphLayoutInput(const std::string& nodeName) {
+  return getGraphLayoutInput({GraphLayoutNode{nodeName, QSizeF(10, 20), {}}});
+}
+
+TEST(getGraphLayoutInput, shouldSortNodesByNameAndEdgesByIndices) {
+  const auto input = getGraphLayoutInput(
+      {GraphLayoutNode{"c", QSizeF(3, 3), {"a"}},
+       GraphLayoutNode{"a", QSizeF(1, 1), {"c", "b"}},
+       GraphLayoutNode{"b", QSizeF(2, 2), {}}});
+
+  const std::vector<std::string> expectedNames{"a", "b", "c"};
+  const std::vector<QSizeF> expectedSizes{
+      QSizeF(1, 1), QSizeF(2, 2), QSizeF(3, 3)};
+  const std::vector<std::pair<size_t, size_t>> expectedEdges{
+      {0, 1}, {0, 2}, {2, 0}};
+
+  EXPECT_EQ(expectedNames, input.nodeNames);
+  EXPECT_EQ(expectedSizes, input.nodeSizes);
+  EXPECT_EQ(expectedEdges, input.edges);
+}
+
+TEST(getGraphLayoutInput, shouldNotDependOnTheOrderOfTheGivenNodes) {
+  const auto input1 =
+      getGraphLayoutInput({GraphLayoutNode{"a", QSizeF(1, 1), {"b"}},
+                           GraphLayoutNode{"b", QSizeF(2, 2), {}}});
+  const auto input2 =
+      getGraphLayoutInput({GraphLayoutNode{"b", QSizeF(2, 2), {}},
+                           GraphLayoutNode{"a", QSizeF(1, 1), {"b"}}});
+
+  EXPECT_EQ(input1, input2);
+}
+
+TEST(getGraphLayoutInput, shouldThrowIfAnEdgeGoesToANodeNotInTheGraph) {
+  EXPECT_THROW(
+      getGraphLayoutInput({GraphLayoutNode{"a", QSizeF(1, 1), {"b"}}}),
+      std::logic_error);
+}
+
+TEST(hashGraphLayoutInput, shouldBeEqualForEqualInputs) {
+  EXPECT_EQ(hashGraphLayoutInput(createGraphLayoutInput("a")),
+            hashGraphLayoutInput(createGraphLayoutInput("a")));
+}
+
+TEST(hashGraphLayoutInput, shouldDifferIfNodeNamesSizesOrEdgesDiffer) {
+  const auto input = getGraphLayoutInput(
+      {GraphLayoutNode{"a", QSizeF(1, 1), {"b"}},
+       GraphLayoutNode{"b", QSizeF(2, 2), {}}});
+  const auto renamedInput = getGraphLayoutInput(
+      {GraphLayoutNode{"a", QSizeF(1, 1), {"c"}},
+       GraphLayoutNode{"c", QSizeF(2, 2), {}}});
+  const auto resizedInput = getGraphLayoutInput(
+      {GraphLayoutNode{"a", QSizeF(1, 1), {"b"}},
+       GraphLayoutNode{"b", QSizeF(2, 3), {}}});
+  const auto reversedInput = getGraphLayoutInput(
+      {GraphLayoutNode{"a", QSizeF(1, 1), {}},
+       GraphLayoutNode{"b", QSizeF(2, 2), {"a"}}});
+
+  const auto hash = hashGraphLayoutInput(input);
+
+  EXPECT_NE(hash, hashGraphLayoutInput(renamedInput));
+  EXPECT_NE(hash, hashGraphLayoutInput(resizedInput));
+  EXPECT_NE(hash, hashGraphLayoutInput(reversedInput));
+}
+
+TEST(shouldUseHeuristicLayout, shouldBeTrueOnlyForLargeGraphs) {
+  EXPECT_FALSE(shouldUseHeuristicLayout(0));
+  EXPECT_FALSE(shouldUseHeuristicLayout(LARGE_GRAPH_NODE_COUNT - 1));
+  EXPECT_TRUE(shouldUseHeuristicLayout(LARGE_GRAPH_NODE_COUNT));
+  EXPECT_TRUE(shouldUseHeuristicLayout(LARGE_GRAPH_NODE_COUNT + 1));
+}
+
+TEST(GraphLayoutCache, getShouldReturnTheNodePositionsInsertedForAnInput) {
+  GraphLayoutCache cache;
+  const auto input = createGraphLayoutInput("a");
+  const std::map<std::string, QPointF> nodePositions{{"a", QPointF(1, 2)}};
+
+  EXPECT_FALSE(cache.get(input).has_value());
+
+  cache.insert(input, nodePositions);
+
+  EXPECT_EQ(nodePositions, cache.get(input));
+}
+
+TEST(GraphLayoutCache, getShouldCompareInputsWhenTheirHashesCollide) {
+  GraphLayoutCache cache([](const GraphLayoutInput&) { return size_t{0}; });
+  const auto input = createGraphLayoutInput("a");
+
+  cache.insert(input, {{"a", QPointF(1, 2)}});
+
+  EXPECT_FALSE(cache.get(createGraphLayoutInput("b")).has_value());
+  EXPECT_TRUE(cache.get(input).has_value());
+}
+
+TEST(GraphLayoutCache, insertShouldClearTheCacheOnceItIsFull) {
+  GraphLayoutCache cache;
+
+  for (size_t i = 0; i < MAX_CACHED_GRAPH_LAYOUTS; i += 1) {
+    cache.insert(createGraphLayoutInput(std::to_string(i)), {});
+  }
+
+  for (size_t i = 0; i < MAX_CACHED_GRAPH_LAYOUTS; i += 1) {
+    EXPECT_TRUE(
+        cache.get(createGraphLayoutInput(std::to_string(i))).has_value());
+  }
+
+  cache.insert(createGraphLayoutInput("new"), {});
+
+  EXPECT_FALSE(cache.get(createGraphLayoutInput("0")).has_value());
+  EXPECT_TRUE(cache.get(createGraphLayoutInput("new")).has_value());
+}
+}
+
+#endif
@@ -26,6 +26,8 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
+
 #include "gui/qt/helpers.h"
 #include "tests/gui/test_helpers.h"
 
@@ -50,6 +52,8 @@ protected:
     out.close();
   }
 
+  static constexpr const char* URL = "https://example.com/Blank.esm";
+
   std::filesystem::path filePath_;
   std::filesystem::path fileMetadataPath_;
 };
@@ -64,6 +68,12 @@ class UpdateFileWithDataTest : public QtHelpersFixture {};
 
 class UpdateFileTest : public QtHelpersFixture {};
 
+class DownloadedFileWriterTest : public QtHelpersFixture {};
+
+class GetHttpValidatorsTest : public QtHelpersFixture {};
+
+class UpdateFileRevisionDateTest : public QtHelpersFixture {};
+
 class ReadOldMessagesTest : public QtHelpersFixture {};
 
 class WriteOldMessagesTest : public QtHelpersFixture {};
@@ -96,6 +106,25 @@ TEST_F(CalculateGitBlobHashTest, shouldReplaceCRLFWithLFBeforeCalculatingHash) {
   EXPECT_EQ("7d91453217afc429984c4706e8df22aaac47c9ce", hash);
 }
 
+TEST_F(CalculateGitBlobHashTest,
+       shouldReplaceCRLFWithLFAcrossChunkBoundariesInALargeFile) {
+  auto file = rootPath_ / "text.txt";
+
+  // Put CRLF line endings on either side of and straddling the 64 KiB chunk
+  // boundaries.
+  auto content = QByteArray(64 * 1024 - 1, 'a') + "\r\n" +
+                 QByteArray(64 * 1024 - 2, 'b') + "\r\n\r" +
+                 QByteArray(64 * 1024, 'c') + "\r";
+
+  std::ofstream out(file, std::ios_base::binary);
+  out.write(content.constData(), content.size());
+  out.close();
+
+  auto hash = calculateGitBlobHash(file);
+
+  EXPECT_EQ(calculateGitBlobHash(content.replace("\r\n", "\n")), hash);
+}
+
 TEST_F(GetFileRevisionTest, shouldThrowIfGivenPathIsNotARegularFile) {
   createTestFile();
 
@@ -156,6 +185,51 @@ TEST_F(GetFileRevisionTest,
   EXPECT_TRUE(revision.is_modified);
 }
 
+TEST_F(GetFileRevisionTest,
+       shouldReuseTheRecordedHashIfTheFileIsUnchangedSinceItWasRecorded) {
+  updateFileWithData(filePath_, QByteArray("new data"));
+
+  // Change the recorded hash to check that it's not recalculated.
+  const auto hash = calculateGitBlobHash(QByteArray("new data"));
+  std::ifstream in(fileMetadataPath_);
+  std::string metadata((std::istreambuf_iterator<char>(in)),
+                       std::istreambuf_iterator<char>());
+  in.close();
+
+  metadata.replace(metadata.find(hash), hash.size(), std::string(40, '0'));
+
+  std::ofstream out(fileMetadataPath_);
+  out << metadata;
+  out.close();
+
+  auto revision = getFileRevision(filePath_);
+
+  EXPECT_EQ(std::string(40, '0'), revision.id);
+  EXPECT_FALSE(revision.is_modified);
+}
+
+TEST_F(GetFileRevisionTest, shouldNotWriteToTheMetadataFileOfAnEditedFile) {
+  createTestMetadataFile();
+
+  std::ofstream out(filePath_);
+  out << "";
+  out.close();
+
+  const auto readMetadata = [&]() {
+    std::ifstream in(fileMetadataPath_);
+    return std::string((std::istreambuf_iterator<char>(in)),
+                       std::istreambuf_iterator<char>());
+  };
+  const auto metadata = readMetadata();
+
+  auto revision = getFileRevision(filePath_);
+
+  EXPECT_EQ(metadata, readMetadata());
+  EXPECT_EQ("e69de29bb2d1d6434b8b29ae775ad8c2e48c5391", revision.id);
+  EXPECT_EQ("2022-01-22", revision.date);
+  EXPECT_TRUE(revision.is_modified);
+}
+
 TEST_F(GetFileRevisionSummaryTest, shouldReturnTheFileRevisionIfItCanBeRead) {
   createTestFile();
   createTestMetadataFile();
@@ -331,6 +405,160 @@ TEST_F(UpdateFileTest, shouldWriteMetadataFileEvenIfHashIsUnchanged) {
   EXPECT_EQ(expectedDate, revision.date);
 }
 
+TEST_F(DownloadedFileWriterTest,
+       commitShouldReplaceTheFileIfTheWrittenDataIsDifferent) {
+  createTestFile();
+
+  const auto data = QByteArray("new data");
+
+  DownloadedFileWriter writer(filePath_);
+  writer.write(data);
+  const auto result = writer.commit(HttpValidators());
+
+  EXPECT_TRUE(result);
+  EXPECT_EQ(calculateGitBlobHash(data), calculateGitBlobHash(filePath_));
+  EXPECT_EQ(calculateGitBlobHash(data), getFileRevision(filePath_).id);
+}
+
+TEST_F(DownloadedFileWriterTest,
+       commitShouldNotReplaceAFileWithCRLFLineEndingsIfTheDataIsTheSame) {
+  const auto data = QByteArray("First line\r\nSecond line\r\n");
+
+  DownloadedFileWriter firstWriter(filePath_);
+  firstWriter.write(data);
+  ASSERT_TRUE(firstWriter.commit(HttpValidators()));
+
+  // Split the data so that a CRLF straddles the two writes.
+  DownloadedFileWriter writer(filePath_);
+  writer.write(data.left(11));
+  writer.write(data.mid(11));
+  const auto result = writer.commit(HttpValidators());
+
+  EXPECT_FALSE(result);
+  EXPECT_EQ(calculateGitBlobHash(filePath_), getFileRevision(filePath_).id);
+}
+
+TEST_F(DownloadedFileWriterTest,
+       commitShouldReplaceAFileWithoutRevisionMetadataEvenIfTheDataIsTheSame) {
+  const auto data = QByteArray("new data");
+
+  std::ofstream out(filePath_, std::ios_base::binary);
+  out.write(data.constData(), data.size());
+  out.close();
+
+  DownloadedFileWriter writer(filePath_);
+  writer.write(data);
+  const auto result = writer.commit(HttpValidators());
+
+  EXPECT_TRUE(result);
+  EXPECT_EQ(calculateGitBlobHash(data), getFileRevision(filePath_).id);
+}
+
+TEST_F(DownloadedFileWriterTest,
+       commitShouldReplaceAFileThatWasEditedSinceItsRevisionWasRecorded) {
+  const auto data = QByteArray("new data");
+  updateFileWithData(filePath_, data);
+
+  std::ofstream out(filePath_, std::ios_base::binary | std::ios_base::app);
+  out << "edit";
+  out.close();
+
+  DownloadedFileWriter writer(filePath_);
+  writer.write(data);
+  const auto result = writer.commit(HttpValidators());
+
+  EXPECT_TRUE(result);
+  EXPECT_EQ(calculateGitBlobHash(data), calculateGitBlobHash(filePath_));
+  EXPECT_FALSE(getFileRevision(filePath_).is_modified);
+}
+
+TEST_F(GetHttpValidatorsTest, shouldReturnNoValidatorsIfTheFileDoesNotExist) {
+  const auto validators = getHttpValidators(filePath_, QUrl(URL));
+
+  EXPECT_TRUE(validators.isEmpty());
+}
+
+TEST_F(GetHttpValidatorsTest,
+       shouldReturnTheValidatorsWrittenWithTheFileIfItIsUnchanged) {
+  updateFileWithData(
+      filePath_, QByteArray("new data"), {"\"etag\"", "date", URL});
+
+  const auto validators = getHttpValidators(filePath_, QUrl(URL));
+
+  EXPECT_EQ("\"etag\"", validators.etag);
+  EXPECT_EQ("date", validators.lastModified);
+}
+
+TEST_F(GetHttpValidatorsTest,
+       shouldReturnNoValidatorsIfTheyWereSentForADifferentUrl) {
+  updateFileWithData(
+      filePath_, QByteArray("new data"), {"\"etag\"", "date", URL});
+
+  const auto validators =
+      getHttpValidators(filePath_, QUrl("https://example.com/Other.esm"));
+
+  EXPECT_TRUE(validators.isEmpty());
+}
+
+TEST_F(GetHttpValidatorsTest, shouldReturnNoValidatorsIfTheFileHasBeenEdited) {
+  updateFileWithData(
+      filePath_, QByteArray("new data"), {"\"etag\"", "date", URL});
+
+  std::ofstream out(filePath_, std::ios_base::app);
+  out << "more data";
+  out.close();
+
+  const auto validators = getHttpValidators(filePath_, QUrl(URL));
+
+  EXPECT_TRUE(validators.isEmpty());
+}
+
+TEST_F(GetHttpValidatorsTest,
+       shouldReturnNoValidatorsIfTheMetadataFileHasNoFileStamp) {
+  createTestFile();
+  createTestMetadataFile();
+
+  const auto validators = getHttpValidators(filePath_, QUrl(URL));
+
+  EXPECT_TRUE(validators.isEmpty());
+}
+
+TEST_F(UpdateFileRevisionDateTest, shouldThrowIfThereIsNoMetadataFile) {
+  createTestFile();
+
+  EXPECT_THROW(updateFileRevisionDate(filePath_, HttpValidators()),
+               std::runtime_error);
+}
+
+TEST_F(UpdateFileRevisionDateTest,
+       shouldKeepTheStoredHashAndValidatorsIfNoneAreGiven) {
+  const auto data = QByteArray("new data");
+  updateFileWithData(filePath_, data, {"\"etag\"", "date", URL});
+
+  updateFileRevisionDate(filePath_, HttpValidators());
+
+  const auto revision = getFileRevision(filePath_);
+  const auto validators = getHttpValidators(filePath_, QUrl(URL));
+
+  EXPECT_EQ(calculateGitBlobHash(data), revision.id);
+  EXPECT_EQ(QDate::currentDate().toString(Qt::ISODate).toStdString(),
+            revision.date);
+  EXPECT_EQ("\"etag\"", validators.etag);
+  EXPECT_EQ("date", validators.lastModified);
+}
+
+TEST_F(UpdateFileRevisionDateTest, shouldReplaceStoredValidatorsWithGivenOnes) {
+  updateFileWithData(
+      filePath_, QByteArray("new data"), {"\"etag\"", "date", URL});
+
+  updateFileRevisionDate(filePath_, {"\"etag2\"", ""});
+
+  const auto validators = getHttpValidators(filePath_, QUrl(URL));
+
+  EXPECT_EQ("\"etag2\"", validators.etag);
+  EXPECT_EQ("date", validators.lastModified);
+}
+
 TEST(isValidUrl, shouldBeFalseForALocalWindowsPath) {
   auto result = isValidUrl("C:\\Users\\user\\file");
 
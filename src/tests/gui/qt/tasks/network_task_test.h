@@ -0,0 +1,95 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_TESTS_GUI_QT_TASKS_NETWORK_TASK_TEST
+#define LOOT_TESTS_GUI_QT_TASKS_NETWORK_TASK_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtTest/QSignalSpy>
+#include <algorithm>
+#include <string>
+
+#include "gui/qt/tasks/network_task.h"
+#include "tests/gui/qt/tasks/non_blocking_test_task.h"
+
+namespace loot {
+namespace test {
+inline constexpr int NETWORK_TASKS_TIMEOUT_MS = 100;
+
+TEST(getNetworkAccessManager, shouldReturnTheSameManagerEachTime) {
+  EXPECT_EQ(&getNetworkAccessManager(), &getNetworkAccessManager());
+}
+
+TEST(executeNetworkTasks, shouldNotRunMoreThanTheGivenNumberOfTasksAtOnce) {
+  QElapsedTimer timer;
+  timer.start();
+
+  NonBlockingTestTask task1(false, timer);
+  NonBlockingTestTask task2(false, timer);
+  NonBlockingTestTask task3(false, timer);
+
+  auto spy1 = QSignalSpy(&task1, &Task::finished);
+  auto spy2 = QSignalSpy(&task2, &Task::finished);
+  auto spy3 = QSignalSpy(&task3, &Task::finished);
+
+  executeNetworkTasks({&task1, &task2, &task3}, 2);
+
+  ASSERT_TRUE(spy3.wait(NETWORK_TASKS_TIMEOUT_MS));
+  ASSERT_EQ(1, spy1.count());
+  ASSERT_EQ(1, spy2.count());
+
+  // Each task's result holds its start and end times.
+  const auto getTime = [](QSignalSpy& spy, size_t index) {
+    const auto result = spy.takeFirst().at(0).value<QueryResult>();
+    return std::stoll(std::get<CancelSortResult>(result).at(index).first);
+  };
+
+  const auto task1End = getTime(spy1, 1);
+  const auto task2End = getTime(spy2, 1);
+  const auto task3Start = getTime(spy3, 0);
+
+  // The third task can't start until one of the first two has finished.
+  EXPECT_GE(task3Start, std::min(task1End, task2End));
+}
+
+TEST(executeNetworkTasks, shouldStartTheNextTaskWhenATaskErrors) {
+  QElapsedTimer timer;
+  timer.start();
+
+  NonBlockingTestTask task1(true, timer);
+  NonBlockingTestTask task2(false, timer);
+
+  auto errorSpy = QSignalSpy(&task1, &Task::error);
+  auto finishedSpy = QSignalSpy(&task2, &Task::finished);
+
+  executeNetworkTasks({&task1, &task2}, 1);
+
+  ASSERT_TRUE(finishedSpy.wait(NETWORK_TASKS_TIMEOUT_MS));
+  EXPECT_EQ(1, errorSpy.count());
+}
+}
+}
+
+#endif
@@ -0,0 +1,202 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_TESTS_GUI_QT_TASKS_TASK_SCHEDULER_TEST
+#define LOOT_TESTS_GUI_QT_TASKS_TASK_SCHEDULER_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFutureWatcher>
+#include <QtTest/QSignalSpy>
+
+#include "gui/qt/tasks/task_scheduler.h"
+#include "tests/gui/qt/tasks/non_blocking_test_task.h"
+#include "tests/gui/qt/tasks/tasks_test.h"
+
+namespace loot {
+namespace test {
+inline constexpr int SCHEDULER_TIMEOUT_MS = 1000;
+
+void waitForFuture(const QFuture<QueryResult>& future) {
+  QFutureWatcher<QueryResult> watcher;
+  auto finishedSpy = QSignalSpy(&watcher, &QFutureWatcherBase::finished);
+  watcher.setFuture(future);
+
+  if (!future.isFinished()) {
+    ASSERT_TRUE(finishedSpy.wait(SCHEDULER_TIMEOUT_MS));
+  }
+}
+
+long long getTaskStartTime(const QSignalSpy& finishedSpy) {
+  const auto result = finishedSpy.at(0).at(0).value<QueryResult>();
+  return std::stoll(std::get<CancelSortResult>(result).at(0).first);
+}
+
+TEST(TaskScheduler, executeShouldRunATaskAndResolveItsFuture) {
+  QElapsedTimer timer;
+  timer.start();
+
+  NonBlockingTestTask task(false, timer);
+  auto finishedSpy = QSignalSpy(&task, &Task::finished);
+  TaskScheduler scheduler(nullptr, 2);
+
+  const auto future = scheduler.execute(&task, TaskPriority::interactive);
+
+  ASSERT_TRUE(finishedSpy.wait(SCHEDULER_TIMEOUT_MS));
+  EXPECT_TRUE(future.isFinished());
+  EXPECT_EQ(1, scheduler.getLaneStats().at(0).startedCount);
+}
+
+TEST(TaskScheduler, executeShouldStartWaitingTasksInPriorityOrder) {
+  QElapsedTimer timer;
+  timer.start();
+
+  NonBlockingTestTask firstTask(false, timer);
+  NonBlockingTestTask backgroundTask(false, timer);
+  NonBlockingTestTask interactiveTask(false, timer);
+  auto backgroundSpy = QSignalSpy(&backgroundTask, &Task::finished);
+  auto interactiveSpy = QSignalSpy(&interactiveTask, &Task::finished);
+  TaskScheduler scheduler(nullptr, 1);
+
+  scheduler.execute(&firstTask, TaskPriority::background);
+  scheduler.execute(&backgroundTask, TaskPriority::background);
+  scheduler.execute(&interactiveTask, TaskPriority::interactive);
+
+  EXPECT_EQ(1, scheduler.getRunningTaskCount());
+  EXPECT_EQ(1, scheduler.getLaneStats().at(0).queueDepth);
+  EXPECT_EQ(1, scheduler.getLaneStats().at(1).queueDepth);
+
+  ASSERT_TRUE(backgroundSpy.wait(SCHEDULER_TIMEOUT_MS));
+  ASSERT_EQ(1, interactiveSpy.count());
+
+  EXPECT_LT(getTaskStartTime(interactiveSpy), getTaskStartTime(backgroundSpy));
+}
+
+TEST(TaskScheduler, executeShouldDiscardAQueryIfAnIdenticalQueryIsWaiting) {
+  QElapsedTimer timer;
+  timer.start();
+
+  NonBlockingTestTask blockingTask(false, timer);
+  TaskScheduler scheduler(nullptr, 1);
+
+  scheduler.execute(&blockingTask, TaskPriority::interactive);
+
+  const auto firstFuture = scheduler.execute(
+      std::make_unique<TestQuery>(1), TaskPriority::background, "key");
+  const auto secondFuture = scheduler.execute(
+      std::make_unique<TestQuery>(2), TaskPriority::background, "key");
+
+  EXPECT_FALSE(secondFuture.isCanceled());
+  EXPECT_EQ(1, scheduler.getLaneStats().at(1).queueDepth);
+  EXPECT_EQ(1, scheduler.getLaneStats().at(1).deduplicatedCount);
+
+  waitForFuture(firstFuture);
+
+  ASSERT_TRUE(secondFuture.isFinished());
+  EXPECT_EQ("1", std::get<PluginItem>(secondFuture.result()).name);
+}
+
+TEST(TaskScheduler, executeShouldDiscardAQueryIfAnIdenticalQueryIsRunning) {
+  TaskScheduler scheduler(nullptr, 1);
+
+  const auto firstFuture = scheduler.execute(
+      std::make_unique<TestQuery>(1), TaskPriority::interactive, "key");
+
+  EXPECT_EQ(1, scheduler.getRunningTaskCount());
+
+  const auto secondFuture = scheduler.execute(
+      std::make_unique<TestQuery>(2), TaskPriority::interactive, "key");
+
+  EXPECT_EQ(0, scheduler.getLaneStats().at(0).queueDepth);
+  EXPECT_EQ(1, scheduler.getLaneStats().at(0).deduplicatedCount);
+
+  waitForFuture(firstFuture);
+
+  ASSERT_TRUE(secondFuture.isFinished());
+  EXPECT_EQ("1", std::get<PluginItem>(secondFuture.result()).name);
+}
+
+TEST(TaskScheduler, executeShouldNotDiscardAQueryOnceAnIdenticalQueryIsDone) {
+  TaskScheduler scheduler(nullptr, 1);
+
+  const auto firstFuture = scheduler.execute(
+      std::make_unique<TestQuery>(1), TaskPriority::interactive, "key");
+  waitForFuture(firstFuture);
+
+  // Let the scheduler handle the task finishing.
+  QCoreApplication::processEvents();
+
+  const auto secondFuture = scheduler.execute(
+      std::make_unique<TestQuery>(2), TaskPriority::interactive, "key");
+  waitForFuture(secondFuture);
+
+  EXPECT_EQ(0, scheduler.getLaneStats().at(0).deduplicatedCount);
+  EXPECT_EQ("2", std::get<PluginItem>(secondFuture.result()).name);
+}
+
+TEST(TaskScheduler, shouldEmitIdleOnceNoTasksAreWaitingOrRunning) {
+  QElapsedTimer timer;
+  timer.start();
+
+  NonBlockingTestTask firstTask(false, timer);
+  NonBlockingTestTask secondTask(false, timer);
+  TaskScheduler scheduler(nullptr, 1);
+  auto idleSpy = QSignalSpy(&scheduler, &TaskScheduler::idle);
+
+  EXPECT_TRUE(scheduler.isIdle());
+
+  scheduler.execute(&firstTask, TaskPriority::interactive);
+  scheduler.execute(&secondTask, TaskPriority::interactive);
+
+  EXPECT_FALSE(scheduler.isIdle());
+
+  ASSERT_TRUE(idleSpy.wait(SCHEDULER_TIMEOUT_MS));
+  EXPECT_EQ(1, idleSpy.count());
+  EXPECT_TRUE(scheduler.isIdle());
+}
+
+TEST(TaskScheduler, executeShouldNotStartASpeculativeTaskOnTheLastIdleThread) {
+  QElapsedTimer timer;
+  timer.start();
+
+  NonBlockingTestTask firstTask(false, timer);
+  NonBlockingTestTask speculativeTask(false, timer);
+  auto firstSpy = QSignalSpy(&firstTask, &Task::finished);
+  auto speculativeSpy = QSignalSpy(&speculativeTask, &Task::finished);
+  TaskScheduler scheduler(nullptr, 2);
+
+  scheduler.execute(&firstTask, TaskPriority::interactive);
+  scheduler.execute(&speculativeTask, TaskPriority::speculative);
+
+  EXPECT_EQ(1, scheduler.getRunningTaskCount());
+  EXPECT_EQ(1, scheduler.getLaneStats().at(2).queueDepth);
+
+  ASSERT_TRUE(firstSpy.wait(SCHEDULER_TIMEOUT_MS));
+  ASSERT_TRUE(speculativeSpy.wait(SCHEDULER_TIMEOUT_MS));
+}
+}
+}
+
+#endif
@@ -0,0 +1,142 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#include "tests/gui/qt/tasks/test_http_server.h"
+
+#include <QtNetwork/QTcpSocket>
+#include <optional>
+#include <stdexcept>
+
+namespace {
+QByteArray getReasonPhrase(int statusCode) {
+  switch (statusCode) {
+    case 200:
+      return "OK";
+    case 304:
+      return "Not Modified";
+    case 404:
+      return "Not Found";
+    default:
+      return "Unknown";
+  }
+}
+
+std::optional<loot::test::TestHttpRequest> parseRequest(
+    const QByteArray& data) {
+  const auto headersEnd = data.indexOf("\r\n\r\n");
+  if (headersEnd < 0) {
+    return std::nullopt;
+  }
+
+  const auto lines = data.left(headersEnd).split('\n');
+
+  loot::test::TestHttpRequest request;
+
+  const auto requestLine = lines.front().trimmed().split(' ');
+  if (requestLine.size() >= 2) {
+    request.method = requestLine.at(0);
+    request.path = requestLine.at(1);
+  }
+
+  for (qsizetype i = 1; i < lines.size(); i += 1) {
+    const auto& line = lines.at(i);
+    const auto separator = line.indexOf(':');
+    if (separator < 0) {
+      continue;
+    }
+
+    request.headers.insert(line.left(separator).trimmed().toLower(),
+                           line.mid(separator + 1).trimmed());
+  }
+
+  return request;
+}
+}
+
+namespace loot {
+namespace test {
+TestHttpServer::TestHttpServer(Handler handler) : handler(std::move(handler)) {
+  connect(&server,
+          &QTcpServer::newConnection,
+          this,
+          &TestHttpServer::onNewConnection);
+
+  if (!server.listen(QHostAddress::LocalHost)) {
+    throw std::runtime_error("Failed to start the test HTTP server: " +
+                             server.errorString().toStdString());
+  }
+}
+
+std::string TestHttpServer::getUrl(const QString& path) const {
+  return QString("http://127.0.0.1:%1%2")
+      .arg(server.serverPort())
+      .arg(path)
+      .toStdString();
+}
+
+const std::vector<TestHttpRequest>& TestHttpServer::getRequests() const {
+  return requests;
+}
+
+void TestHttpServer::onNewConnection() {
+  while (server.hasPendingConnections()) {
+    const auto socket = server.nextPendingConnection();
+
+    connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+    connect(socket, &QTcpSocket::readyRead, this, [this, socket]() {
+      onReadyRead(socket);
+    });
+  }
+}
+
+void TestHttpServer::onReadyRead(QTcpSocket* socket) {
+  // Requests are small, so buffer them on the socket until the headers are
+  // complete.
+  auto data = socket->property("requestData").toByteArray();
+  data.append(socket->readAll());
+  socket->setProperty("requestData", data);
+
+  const auto request = parseRequest(data);
+  if (!request.has_value()) {
+    return;
+  }
+
+  requests.push_back(request.value());
+
+  const auto response = handler(request.value());
+
+  QByteArray output = "HTTP/1.1 " + QByteArray::number(response.statusCode) +
+                      " " + getReasonPhrase(response.statusCode) + "\r\n";
+  for (const auto& [name, value] : response.headers) {
+    output += name + ": " + value + "\r\n";
+  }
+  output += "Content-Length: " + QByteArray::number(response.body.size()) +
+            "\r\nConnection: close\r\n\r\n";
+  output += response.body;
+
+  socket->write(output);
+  socket->disconnectFromHost();
+}
+}
+}
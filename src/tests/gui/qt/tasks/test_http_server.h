@@ -0,0 +1,76 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_TESTS_GUI_QT_TASKS_TEST_HTTP_SERVER
+#define LOOT_TESTS_GUI_QT_TASKS_TEST_HTTP_SERVER
+
+#include <QtCore/QByteArray>
+#include <QtCore/QMap>
+#include <QtCore/QString>
+#include <QtNetwork/QTcpServer>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace loot {
+namespace test {
+struct TestHttpRequest {
+  QByteArray method;
+  QByteArray path;
+  // Header names are lowercased.
+  QMap<QByteArray, QByteArray> headers;
+};
+
+struct TestHttpResponse {
+  int statusCode{200};
+  std::vector<std::pair<QByteArray, QByteArray>> headers;
+  QByteArray body;
+};
+
+// A minimal HTTP/1.1 server that listens on localhost and serves responses
+// produced by the given handler, recording the requests that it receives.
+class TestHttpServer : public QObject {
+  Q_OBJECT
+public:
+  using Handler = std::function<TestHttpResponse(const TestHttpRequest&)>;
+
+  explicit TestHttpServer(Handler handler);
+
+  std::string getUrl(const QString& path) const;
+  const std::vector<TestHttpRequest>& getRequests() const;
+
+private:
+  QTcpServer server;
+  Handler handler;
+  std::vector<TestHttpRequest> requests;
+
+  void onReadyRead(QTcpSocket* socket);
+
+private slots:
+  void onNewConnection();
+};
+}
+}
+
+#endif
@@ -0,0 +1,262 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_TESTS_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK_TEST
+#define LOOT_TESTS_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QTest>
+
+#include "gui/qt/helpers.h"
+#include "gui/qt/tasks/update_masterlist_task.h"
+#include "tests/gui/qt/tasks/test_http_server.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class UpdateMasterlistTaskTest : public FilesystemTest {
+protected:
+  static constexpr int RESPONSE_TIMEOUT_MS = 5000;
+  static constexpr const char* ETAG = "\"abc123\"";
+  static constexpr const char* LAST_MODIFIED = "Mon, 19 Oct 2026 10:00:00 GMT";
+  static constexpr const char* MASTERLIST_URL_PATH = "/masterlist.yaml";
+
+  UpdateMasterlistTaskTest() :
+      masterlistPath_(rootPath_ / "masterlist.yaml"),
+      masterlistData_("groups: []\n"),
+      server_([this](const TestHttpRequest& request) {
+        return handleRequest(request);
+      }) {}
+
+  std::optional<bool> runTask(const QString& urlPath = MASTERLIST_URL_PATH) {
+    auto task = UpdateMasterlistTask(
+        "folder", server_.getUrl(urlPath), masterlistPath_);
+    auto finishedSpy = QSignalSpy(&task, &Task::finished);
+    auto errorSpy = QSignalSpy(&task, &Task::error);
+
+    task.execute();
+
+    QTest::qWaitFor(
+        [&]() { return !finishedSpy.isEmpty() || !errorSpy.isEmpty(); },
+        RESPONSE_TIMEOUT_MS);
+    if (finishedSpy.isEmpty()) {
+      return std::nullopt;
+    }
+
+    const auto result = finishedSpy.takeFirst().at(0).value<QueryResult>();
+
+    return std::get<MasterlistUpdateResult>(result).second;
+  }
+
+  std::vector<std::filesystem::path> getDirectoryEntries() const {
+    std::vector<std::filesystem::path> entries;
+    for (const auto& entry : std::filesystem::directory_iterator(rootPath_)) {
+      entries.push_back(entry.path().filename());
+    }
+    return entries;
+  }
+
+  std::filesystem::path masterlistPath_;
+  QByteArray masterlistData_;
+  int statusCode_{200};
+  bool honourValidators_{true};
+  bool compressResponse_{false};
+  TestHttpServer server_;
+
+private:
+  TestHttpResponse handleRequest(const TestHttpRequest& request) const {
+    if (honourValidators_ &&
+        (request.headers.value("if-none-match") == ETAG ||
+         request.headers.value("if-modified-since") == LAST_MODIFIED)) {
+      return TestHttpResponse{304, {{"ETag", ETAG}}, QByteArray()};
+    }
+
+    auto response = TestHttpResponse{
+        statusCode_,
+        {{"ETag", ETAG}, {"Last-Modified", LAST_MODIFIED}},
+        masterlistData_};
+
+    if (compressResponse_) {
+      // qCompress() prefixes the zlib stream with its uncompressed length.
+      static constexpr qsizetype LENGTH_PREFIX_SIZE = 4;
+      response.body = qCompress(masterlistData_).mid(LENGTH_PREFIX_SIZE);
+      response.headers.push_back({"Content-Encoding", "deflate"});
+    }
+
+    return response;
+  }
+};
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldMakeAnUnconditionalRequestIfTheMasterlistDoesNotExist) {
+  const auto result = runTask();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result.value());
+
+  ASSERT_EQ(1, server_.getRequests().size());
+  EXPECT_FALSE(server_.getRequests()[0].headers.contains("if-none-match"));
+  EXPECT_FALSE(server_.getRequests()[0].headers.contains("if-modified-since"));
+
+  const auto validators = getHttpValidators(
+      masterlistPath_,
+      QUrl(QString::fromStdString(server_.getUrl(MASTERLIST_URL_PATH))));
+  EXPECT_EQ(ETAG, validators.etag);
+  EXPECT_EQ(LAST_MODIFIED, validators.lastModified);
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldTreatANotModifiedResponseToStoredValidatorsAsUpToDate) {
+  ASSERT_TRUE(runTask().has_value());
+
+  const auto result = runTask();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_FALSE(result.value());
+
+  ASSERT_EQ(2, server_.getRequests().size());
+  EXPECT_EQ(ETAG, server_.getRequests()[1].headers.value("if-none-match"));
+  EXPECT_EQ(LAST_MODIFIED,
+            server_.getRequests()[1].headers.value("if-modified-since"));
+
+  const auto revision = getFileRevision(masterlistPath_);
+  EXPECT_EQ(calculateGitBlobHash(masterlistData_), revision.id);
+  EXPECT_FALSE(revision.is_modified);
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldMakeAnUnconditionalRequestIfTheSourceUrlHasChanged) {
+  ASSERT_TRUE(runTask().has_value());
+
+  masterlistData_ = QByteArray("groups: {}\n");
+
+  const auto result = runTask("/branch/masterlist.yaml");
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result.value());
+
+  ASSERT_EQ(2, server_.getRequests().size());
+  EXPECT_FALSE(server_.getRequests()[1].headers.contains("if-none-match"));
+  EXPECT_FALSE(server_.getRequests()[1].headers.contains("if-modified-since"));
+  EXPECT_EQ(calculateGitBlobHash(masterlistData_),
+            calculateGitBlobHash(masterlistPath_));
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldMakeAnUnconditionalRequestIfTheMasterlistHasBeenEdited) {
+  ASSERT_TRUE(runTask().has_value());
+
+  std::ofstream out(masterlistPath_, std::ios_base::app);
+  out << "# An edit\n";
+  out.close();
+
+  const auto result = runTask();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result.value());
+
+  ASSERT_EQ(2, server_.getRequests().size());
+  EXPECT_FALSE(server_.getRequests()[1].headers.contains("if-none-match"));
+  EXPECT_EQ(calculateGitBlobHash(masterlistData_),
+            calculateGitBlobHash(masterlistPath_));
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldAcceptACompressedResponseAndWriteTheDecompressedData) {
+  masterlistData_ = QByteArray("groups: []\n").repeated(1000);
+  compressResponse_ = true;
+
+  const auto result = runTask();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result.value());
+
+  ASSERT_EQ(1, server_.getRequests().size());
+  EXPECT_TRUE(
+      server_.getRequests()[0].headers.value("accept-encoding").contains(
+          "deflate"));
+
+  EXPECT_EQ(calculateGitBlobHash(masterlistData_),
+            calculateGitBlobHash(masterlistPath_));
+  EXPECT_EQ(calculateGitBlobHash(masterlistData_),
+            getFileRevision(masterlistPath_).id);
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldNotReplaceTheMasterlistIfTheDownloadedDataIsUnchanged) {
+  honourValidators_ = false;
+  ASSERT_TRUE(runTask().has_value());
+
+  const auto modificationTime =
+      std::filesystem::last_write_time(masterlistPath_);
+
+  const auto result = runTask();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_FALSE(result.value());
+  EXPECT_EQ(modificationTime,
+            std::filesystem::last_write_time(masterlistPath_));
+  EXPECT_EQ(calculateGitBlobHash(masterlistData_),
+            getFileRevision(masterlistPath_).id);
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldReplaceTheMasterlistIfDownloadedDataOfTheSameSizeDiffers) {
+  honourValidators_ = false;
+  ASSERT_TRUE(runTask().has_value());
+
+  masterlistData_ = QByteArray("groups: {}\n");
+
+  const auto result = runTask();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result.value());
+  EXPECT_EQ(calculateGitBlobHash(masterlistData_),
+            calculateGitBlobHash(masterlistPath_));
+  EXPECT_EQ(calculateGitBlobHash(masterlistData_),
+            getFileRevision(masterlistPath_).id);
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldLeaveTheMasterlistUnchangedIfTheResponseIsAnError) {
+  ASSERT_TRUE(runTask().has_value());
+  const auto entries = getDirectoryEntries();
+
+  statusCode_ = 404;
+  honourValidators_ = false;
+  masterlistData_ = QByteArray("Not found");
+
+  const auto result = runTask();
+
+  EXPECT_FALSE(result.has_value());
+  EXPECT_EQ(calculateGitBlobHash(QByteArray("groups: []\n")),
+            calculateGitBlobHash(masterlistPath_));
+  EXPECT_EQ(entries, getDirectoryEntries());
+}
+}
+}
+
+#endif
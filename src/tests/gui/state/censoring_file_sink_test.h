@@ -0,0 +1,162 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_CENSORING_FILE_SINK_TEST
+#define LOOT_TESTS_GUI_STATE_CENSORING_FILE_SINK_TEST
+
+#include <gtest/gtest.h>
+#include <spdlog/logger.h>
+
+#include <fstream>
+
+#include "gui/state/censoring_file_sink.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+using Replacements = std::vector<std::pair<std::string, std::string>>;
+
+TEST(StringCensor, censorShouldReturnNulloptIfTheTextHasNoMatches) {
+  StringCensor censor(Replacements{{"secret", "X"}});
+
+  EXPECT_FALSE(censor.censor("nothing to see here").has_value());
+}
+
+TEST(StringCensor, censorShouldIgnoreEmptyStrings) {
+  StringCensor censor(Replacements{{"", "X"}});
+
+  EXPECT_FALSE(censor.censor("text").has_value());
+}
+
+TEST(StringCensor, censorShouldReplaceEveryOccurrenceOfAString) {
+  StringCensor censor(Replacements{{"secret", "X"}});
+
+  EXPECT_EQ("X, X and X", censor.censor("secret, secret and secret"));
+}
+
+TEST(StringCensor, censorShouldPreferALongerStringOverItsPrefix) {
+  StringCensor censor(
+      Replacements{{"/home/user", "$HOME"}, {"/home/user/docs", "DOCS"}});
+
+  EXPECT_EQ("DOCS/file and $HOME/file",
+            censor.censor("/home/user/docs/file and /home/user/file"));
+}
+
+TEST(StringCensor, censorShouldNotMatchAStringThatOverlapsAReplacedString) {
+  StringCensor censor(Replacements{{"abc", "X"}, {"bcd", "Y"}});
+
+  EXPECT_EQ("Xd", censor.censor("abcd"));
+  EXPECT_EQ("xY", censor.censor("xbcd"));
+}
+
+class CensoringFileSinkTest : public ::testing::Test {
+protected:
+  CensoringFileSinkTest() :
+      rootPath(getTempPath()), logPath(rootPath / "LOOTDebugLog.txt") {}
+
+  void SetUp() override { std::filesystem::create_directories(rootPath); }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath); }
+
+  std::shared_ptr<spdlog::logger> createLogger(size_t bufferCapacity) {
+#ifdef _WIN32
+    const auto platformFilePath = logPath.wstring();
+#else
+    const auto platformFilePath = logPath.u8string();
+#endif
+    auto sink = std::make_shared<CensoringFileSink>(
+        platformFilePath, Replacements{{"secret", "X"}}, bufferCapacity);
+
+    auto logger = std::make_shared<spdlog::logger>("test_logger", sink);
+    logger->set_pattern("%v");
+    logger->set_level(spdlog::level::trace);
+
+    return logger;
+  }
+
+  std::vector<std::string> readLogLines() const {
+    std::vector<std::string> lines;
+    std::ifstream in(logPath);
+    std::string line;
+    while (std::getline(in, line)) {
+      lines.push_back(line);
+    }
+
+    return lines;
+  }
+
+  const std::filesystem::path rootPath;
+  const std::filesystem::path logPath;
+};
+
+TEST_F(CensoringFileSinkTest,
+       messagesShouldBeWrittenInOrderWhenTheBufferIsFull) {
+  auto logger = createLogger(2);
+
+  std::vector<std::string> expected;
+  for (int i = 0; i < 100; i += 1) {
+    logger->info("message {}", i);
+    expected.push_back("message " + std::to_string(i));
+  }
+  logger.reset();
+
+  EXPECT_EQ(expected, readLogLines());
+}
+
+TEST_F(CensoringFileSinkTest,
+       errorMessageShouldBeWrittenImmediatelyAfterBufferedMessages) {
+  auto logger = createLogger(16);
+
+  logger->info("first");
+  logger->debug("second");
+  logger->error("third");
+
+  const std::vector<std::string> expected{"first", "second", "third"};
+  EXPECT_EQ(expected, readLogLines());
+}
+
+TEST_F(CensoringFileSinkTest, destructorShouldWriteBufferedMessages) {
+  auto logger = createLogger(16);
+
+  logger->info("first");
+  logger->info("second");
+  logger.reset();
+
+  const std::vector<std::string> expected{"first", "second"};
+  EXPECT_EQ(expected, readLogLines());
+}
+
+TEST_F(CensoringFileSinkTest, messagesShouldBeCensored) {
+  auto logger = createLogger(16);
+
+  logger->info("a secret message");
+  logger->error("another secret");
+  logger.reset();
+
+  const std::vector<std::string> expected{"a X message", "another X"};
+  EXPECT_EQ(expected, readLogLines());
+}
+}
+}
+
+#endif
@@ -0,0 +1,86 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_DIAGNOSTICS_TEST
+#define LOOT_TESTS_GUI_STATE_DIAGNOSTICS_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/state/diagnostics.h"
+
+namespace loot::test {
+TEST(CacheStats, getHitRateShouldReturnNulloptIfThereHaveBeenNoLookups) {
+  EXPECT_FALSE(CacheStats().getHitRate().has_value());
+}
+
+TEST(CacheStats, getHitRateShouldReturnTheFractionOfLookupsThatWereHits) {
+  const auto stats = CacheStats{3, 1};
+
+  EXPECT_EQ(0.75, stats.getHitRate());
+}
+
+TEST(SessionDiagnostics, durationsShouldBeNulloptByDefault) {
+  SessionDiagnostics diagnostics;
+
+  EXPECT_FALSE(diagnostics.getLastLoadDuration().has_value());
+  EXPECT_FALSE(diagnostics.getLastSortDuration().has_value());
+  EXPECT_TRUE(diagnostics.getCacheStats().empty());
+}
+
+TEST(SessionDiagnostics, recordingADurationShouldReplaceThePreviousOne) {
+  SessionDiagnostics diagnostics;
+
+  diagnostics.recordLoadDuration(std::chrono::milliseconds(1));
+  diagnostics.recordLoadDuration(std::chrono::milliseconds(2));
+  diagnostics.recordSortDuration(std::chrono::milliseconds(3));
+
+  EXPECT_EQ(std::chrono::milliseconds(2), diagnostics.getLastLoadDuration());
+  EXPECT_EQ(std::chrono::milliseconds(3), diagnostics.getLastSortDuration());
+}
+
+TEST(SessionDiagnostics, recordCacheLookupShouldCountHitsAndMissesPerCache) {
+  SessionDiagnostics diagnostics;
+
+  diagnostics.recordCacheLookup("a", true);
+  diagnostics.recordCacheLookup("a", true);
+  diagnostics.recordCacheLookup("a", false);
+  diagnostics.recordCacheLookup("b", false);
+
+  const auto stats = diagnostics.getCacheStats();
+
+  ASSERT_EQ(2, stats.size());
+  EXPECT_EQ(2, stats.at("a").hits);
+  EXPECT_EQ(1, stats.at("a").misses);
+  EXPECT_EQ(0, stats.at("b").hits);
+  EXPECT_EQ(1, stats.at("b").misses);
+}
+
+TEST(getResidentMemoryBytes, shouldReturnANonZeroValue) {
+  const auto bytes = getResidentMemoryBytes();
+
+  ASSERT_TRUE(bytes.has_value());
+  EXPECT_LT(0, bytes.value());
+}
+}
+
+#endif
@@ -0,0 +1,245 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_DETECTION_CACHE_TEST
+#define LOOT_TESTS_GUI_STATE_GAME_DETECTION_CACHE_TEST
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "gui/state/game/detection/cache.h"
+#include "tests/common_game_test_fixture.h"
+#include "tests/gui/state/game/detection/test_registry.h"
+
+namespace loot::test {
+class GameDetectionCacheTest : public FilesystemTest {
+protected:
+  GameDetectionCacheTest() :
+      cachePath(rootPath_ / "cache.json"),
+      installPath(rootPath_ / "generic"),
+      masterFilePath(installPath / "Data" / "Skyrim.esm") {
+    touch(masterFilePath);
+    touch(installPath / "SkyrimSE.exe");
+
+    registry.SetStringValue(REGISTRY_SUB_KEY, installPath.u8string());
+  }
+
+  std::vector<GameInstall> findInstalls(
+      const std::vector<std::string>& preferredUILanguages = {}) {
+    return findGameInstallsUsingCache(cachePath,
+                                      registry,
+                                      {},
+                                      {},
+                                      preferredUILanguages,
+                                      DEFAULT_SOURCE_TIME_BUDGET)
+        .installs;
+  }
+
+  void replaceCachedInstallsLocalPaths(const std::filesystem::path& localPath) {
+    auto cache = loadGameDetectionCache(cachePath);
+    ASSERT_TRUE(cache.has_value());
+
+    for (auto& install : cache->gameInstalls) {
+      install.localPath = localPath;
+    }
+
+    saveGameDetectionCache(cachePath, cache.value());
+  }
+
+  static constexpr const char* REGISTRY_SUB_KEY =
+      "Software\\Bethesda Softworks\\Skyrim Special Edition";
+
+  std::filesystem::path cachePath;
+  std::filesystem::path installPath;
+  std::filesystem::path masterFilePath;
+
+  TestRegistry registry;
+};
+
+TEST_F(GameDetectionCacheTest,
+       getDetectionInputStampShouldReturnANonExistentStampForAMissingPath) {
+  const auto stamp = getDetectionInputStamp(rootPath_ / "missing");
+
+  EXPECT_FALSE(stamp.exists);
+  EXPECT_FALSE(stamp.isDirectory);
+  EXPECT_EQ(0, stamp.size);
+  EXPECT_EQ(0, stamp.modificationTime);
+}
+
+TEST_F(GameDetectionCacheTest,
+       getDetectionInputStampShouldChangeWhenAFileIsModified) {
+  const auto stamp = getDetectionInputStamp(masterFilePath);
+
+  EXPECT_TRUE(stamp.exists);
+  EXPECT_FALSE(stamp.isDirectory);
+
+  std::filesystem::last_write_time(
+      masterFilePath,
+      std::filesystem::last_write_time(masterFilePath) + std::chrono::hours(1));
+
+  EXPECT_NE(stamp, getDetectionInputStamp(masterFilePath));
+}
+
+TEST_F(GameDetectionCacheTest,
+       recordDetectionInputShouldDoNothingIfNoRecorderIsActive) {
+  EXPECT_NO_THROW(recordDetectionInput(masterFilePath));
+}
+
+TEST_F(GameDetectionCacheTest,
+       recordDetectionInputShouldRecordPathsInTheActiveRecorder) {
+  DetectionInputRecorder recorder;
+
+  recordDetectionInput(masterFilePath);
+  recordDetectionInput(rootPath_ / "missing");
+
+  const auto inputs = recorder.getInputs();
+
+  ASSERT_EQ(1, inputs.paths.count(masterFilePath));
+  ASSERT_EQ(1, inputs.paths.count(rootPath_ / "missing"));
+  EXPECT_TRUE(inputs.paths.at(masterFilePath).exists);
+  EXPECT_FALSE(inputs.paths.at(rootPath_ / "missing").exists);
+}
+
+TEST_F(GameDetectionCacheTest,
+       recordDetectionInputShouldNotRecordOnceTheThreadsStopFlagIsSet) {
+  DetectionInputRecorder recorder;
+  std::atomic<bool> stopFlag(false);
+
+  std::thread([&]() {
+    setDetectionInputStopFlag(&stopFlag);
+
+    recordDetectionInput(masterFilePath);
+    stopFlag.store(true);
+    recordDetectionInput(rootPath_ / "missing");
+  }).join();
+
+  // The flag only applies to the thread that set it.
+  recordDetectionInput(rootPath_ / "other");
+
+  const auto inputs = recorder.getInputs();
+
+  EXPECT_EQ(1, inputs.paths.count(masterFilePath));
+  EXPECT_EQ(0, inputs.paths.count(rootPath_ / "missing"));
+  EXPECT_EQ(1, inputs.paths.count(rootPath_ / "other"));
+}
+
+TEST_F(GameDetectionCacheTest, onlyOneRecorderShouldBeActiveAtATime) {
+  DetectionInputRecorder recorder;
+
+  EXPECT_THROW(DetectionInputRecorder(), std::logic_error);
+}
+
+TEST_F(GameDetectionCacheTest,
+       recordingRegistryShouldRecordValuesReadThroughIt) {
+  DetectionInputRecorder recorder;
+  const RecordingRegistry recordingRegistry(registry);
+
+  const auto value = recordingRegistry.getStringValue(
+      RegistryValue{RegistryRootKey::LOCAL_MACHINE, REGISTRY_SUB_KEY, ""});
+
+  EXPECT_EQ(installPath.u8string(), value);
+
+  const auto inputs = recorder.getInputs();
+  ASSERT_EQ(1, inputs.registryReads.size());
+  EXPECT_EQ(value, inputs.registryReads.begin()->second.result);
+}
+
+TEST_F(GameDetectionCacheTest,
+       loadGameDetectionCacheShouldReturnNulloptIfTheCacheDoesNotExist) {
+  EXPECT_FALSE(loadGameDetectionCache(cachePath).has_value());
+}
+
+TEST_F(GameDetectionCacheTest,
+       loadGameDetectionCacheShouldReturnNulloptIfTheCacheIsInvalid) {
+  std::ofstream out(cachePath);
+  out << "not json";
+  out.close();
+
+  EXPECT_FALSE(loadGameDetectionCache(cachePath).has_value());
+}
+
+TEST_F(GameDetectionCacheTest,
+       findGameInstallsUsingCacheShouldSaveTheDetectionInputsAndResults) {
+  const auto installs = findInstalls();
+
+  ASSERT_EQ(1, installs.size());
+  EXPECT_EQ(GameId::tes5se, installs[0].gameId);
+  EXPECT_EQ(installPath, installs[0].installPath);
+
+  const auto cache = loadGameDetectionCache(cachePath);
+  ASSERT_TRUE(cache.has_value());
+
+  ASSERT_EQ(1, cache->gameInstalls.size());
+  EXPECT_EQ(GameId::tes5se, cache->gameInstalls[0].gameId);
+  EXPECT_EQ(InstallSource::unknown, cache->gameInstalls[0].source);
+  EXPECT_EQ(installPath, cache->gameInstalls[0].installPath);
+
+  EXPECT_EQ(1, cache->inputs.paths.count(masterFilePath));
+  EXPECT_FALSE(cache->inputs.registryReads.empty());
+}
+
+TEST_F(GameDetectionCacheTest,
+       findGameInstallsUsingCacheShouldReuseResultsIfNothingHasChanged) {
+  findInstalls();
+  replaceCachedInstallsLocalPaths("cached");
+
+  const auto installs = findInstalls();
+
+  ASSERT_EQ(1, installs.size());
+  EXPECT_EQ("cached", installs[0].localPath);
+}
+
+TEST_F(GameDetectionCacheTest,
+       findGameInstallsUsingCacheShouldRedetectIfAFileHasChanged) {
+  findInstalls();
+  replaceCachedInstallsLocalPaths("cached");
+
+  std::filesystem::remove(masterFilePath);
+
+  EXPECT_TRUE(findInstalls().empty());
+}
+
+TEST_F(GameDetectionCacheTest,
+       findGameInstallsUsingCacheShouldRedetectIfARegistryValueHasChanged) {
+  findInstalls();
+  replaceCachedInstallsLocalPaths("cached");
+
+  registry.SetStringValue(REGISTRY_SUB_KEY, (rootPath_ / "other").u8string());
+
+  EXPECT_TRUE(findInstalls().empty());
+}
+
+TEST_F(GameDetectionCacheTest,
+       findGameInstallsUsingCacheShouldRedetectIfTheParametersHaveChanged) {
+  findInstalls();
+  replaceCachedInstallsLocalPaths("cached");
+
+  const auto installs = findInstalls({"de"});
+
+  ASSERT_EQ(1, installs.size());
+  EXPECT_EQ("", installs[0].localPath);
+}
+}
+
+#endif
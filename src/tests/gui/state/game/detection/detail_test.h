@@ -25,6 +25,8 @@
 #define LOOT_TESTS_GUI_STATE_GAME_DETECTION_DETAIL_TEST
 
 #include <boost/algorithm/string/replace.hpp>
+#include <chrono>
+#include <thread>
 
 #include "gui/state/game/detection/detail.h"
 #include "tests/common_game_test_fixture.h"
@@ -207,6 +209,54 @@ TEST_F(FindGameInstallsTest, shouldDeduplicateFoundInstalls) {
   EXPECT_EQ("", installs[3].localPath);
 }
 
+TEST_F(FindGameInstallsTest,
+       findGameInstallsWithATimeBudgetShouldReportNoTimeoutsIfAllFinish) {
+  const auto found = findGameInstalls(
+      registry, {}, {xboxGamingRootPath}, {}, DEFAULT_SOURCE_TIME_BUDGET);
+
+  EXPECT_EQ(5, found.installs.size());
+  EXPECT_TRUE(found.timedOutSources.empty());
+}
+
+TEST_F(FindGameInstallsTest,
+       findGameInstallsWithATimeBudgetShouldSkipSourcesThatTakeTooLong) {
+  class SlowRegistry : public RegistryInterface {
+  public:
+    explicit SlowRegistry(const RegistryInterface& registry) :
+        registry_(registry) {}
+
+    std::optional<std::string> getStringValue(
+        const RegistryValue& value) const override {
+      std::this_thread::sleep_for(std::chrono::seconds(1));
+      return registry_.getStringValue(value);
+    }
+
+  private:
+    const RegistryInterface& registry_;
+  };
+
+  const auto found = findGameInstalls(SlowRegistry(registry),
+                                      {},
+                                      {xboxGamingRootPath},
+                                      {},
+                                      std::chrono::milliseconds(200));
+
+  ASSERT_FALSE(found.installs.empty());
+  EXPECT_EQ(InstallSource::microsoft, found.installs.back().source);
+  EXPECT_EQ(msInstallPath, found.installs.back().installPath);
+
+  EXPECT_NE(found.timedOutSources.end(),
+            std::find(found.timedOutSources.begin(),
+                      found.timedOutSources.end(),
+                      "the GOG Registry entries"));
+  EXPECT_EQ(found.installs.end(),
+            std::find_if(found.installs.begin(),
+                         found.installs.end(),
+                         [](const GameInstall& install) {
+                           return install.source == InstallSource::gog;
+                         }));
+}
+
 TEST(CountGameInstalls, shouldCountConfiguredAndNewInstallsByGameAndSource) {
   const std::vector<GameInstall> configuredInstalls{
       {GameId::tes3, InstallSource::epic},
@@ -148,6 +148,35 @@ TEST_P(Epic_FindGameInstallsTest,
   EXPECT_EQ(expectedInstallPath, install.value().installPath);
   EXPECT_EQ("", install.value().localPath);
 }
+
+TEST_P(Epic_FindGameInstallsTest,
+       manifestIndexShouldMapTheGameToItsManifestInstallLocation) {
+  const epic::EgsManifestIndex index(registry);
+
+  EXPECT_EQ(gamePath, index.getInstallLocation(GetParam()));
+}
+
+TEST_P(Epic_FindGameInstallsTest,
+       manifestIndexShouldBeEmptyIfTheManifestsDirectoryDoesNotExist) {
+  std::filesystem::remove_all(epicManifestsPath);
+
+  const epic::EgsManifestIndex index(registry);
+
+  EXPECT_FALSE(index.getInstallLocation(GetParam()).has_value());
+}
+
+TEST_P(Epic_FindGameInstallsTest,
+       findGameInstallsShouldFindTheSameInstallUsingAManifestIndex) {
+  const epic::EgsManifestIndex index(registry);
+
+  const auto install = epic::findGameInstalls(index, GetParam(), {});
+  const auto expectedInstall =
+      epic::findGameInstalls(registry, GetParam(), {});
+
+  ASSERT_TRUE(install.has_value());
+  ASSERT_TRUE(expectedInstall.has_value());
+  EXPECT_EQ(expectedInstall.value().installPath, install.value().installPath);
+}
 }
 
 #endif
@@ -25,6 +25,7 @@
 #ifndef LOOT_TESTS_GUI_STATE_GAME_DETECTION_GENERIC_TEST
 #define LOOT_TESTS_GUI_STATE_GAME_DETECTION_GENERIC_TEST
 
+#include "gui/state/game/detection/cache.h"
 #include "gui/state/game/detection/generic.h"
 #include "gui/state/game/detection/gog.h"
 #include "tests/common_game_test_fixture.h"
@@ -97,21 +98,23 @@ protected:
     }
   }
 
-  void createSteamFile() const {
+  std::filesystem::path getSteamFilePath() const {
     if (GetParam() == GameId::tes3) {
-      touch(gamePath / "steam_autocloud.vdf");
+      return gamePath / "steam_autocloud.vdf";
     } else if (GetParam() == GameId::nehrim) {
-      touch(gamePath / "steam_api.dll");
+      return gamePath / "steam_api.dll";
     } else if (GetParam() == GameId::starfield) {
-      touch(gamePath / "steam_api64.dll");
+      return gamePath / "steam_api64.dll";
     } else if (GetParam() == GameId::oblivionRemastered) {
-      touch(gamePath / "Engine" / "Binaries" / "ThirdParty" / "Steamworks" /
-            "Steamv153" / "Win64" / "steam_api64.dll");
+      return gamePath / "Engine" / "Binaries" / "ThirdParty" / "Steamworks" /
+             "Steamv153" / "Win64" / "steam_api64.dll";
     } else {
-      touch(gamePath / "installscript.vdf");
+      return gamePath / "installscript.vdf";
     }
   }
 
+  void createSteamFile() const { touch(getSteamFilePath()); }
+
 private:
   std::filesystem::path initialCurrentPath;
 };
@@ -344,6 +347,36 @@ TEST_P(Generic_FindGameInstallsTest, shouldIdentifySteamRegistryGame) {
   }
 }
 
+TEST_P(Generic_FindGameInstallsTest,
+       shouldRecordTheSteamFileCheckedForARegistryGameAsADetectionInput) {
+  restoreCurrentPath();
+  createSteamFile();
+
+  TestRegistry registry;
+  const auto subKey = getSubKey();
+  if (subKey.has_value()) {
+    registry.SetStringValue(subKey.value(), gamePath.u8string());
+  }
+
+  DetectionInputRecorder recorder;
+  loot::generic::findGameInstalls(registry, GetParam());
+  const auto inputs = recorder.getInputs();
+
+  // These games either have no generic Registry entry or are identified
+  // without checking for a file.
+  const auto isSteamFileChecked =
+      subKey.has_value() && GetParam() != GameId::tes5 &&
+      GetParam() != GameId::tes5vr && GetParam() != GameId::fo4vr &&
+      GetParam() != GameId::openmw;
+
+  if (isSteamFileChecked) {
+    ASSERT_EQ(1, inputs.paths.count(getSteamFilePath()));
+    EXPECT_TRUE(inputs.paths.at(getSteamFilePath()).exists);
+  } else {
+    EXPECT_EQ(0, inputs.paths.count(getSteamFilePath()));
+  }
+}
+
 TEST_P(Generic_FindGameInstallsTest, shouldIdentifyGogRegistryGame) {
   restoreCurrentPath();
 
@@ -412,6 +412,68 @@ TEST_F(Steam_FindGameInstallTest,
 #endif
 }
 
+class SteamLibraryIndexTest : public FilesystemTest {
+protected:
+  SteamLibraryIndexTest() :
+      library1Path_(rootPath_ / "library1"),
+      library2Path_(rootPath_ / "library2") {}
+
+  void createSkyrimSEInstall(const std::filesystem::path& libraryPath) {
+    const auto installPath =
+        libraryPath / "steamapps" / "common" / "Skyrim Special Edition";
+    touch(installPath / "Data" / "Skyrim.esm");
+    touch(installPath / "SkyrimSE.exe");
+
+    std::ofstream out(libraryPath / "steamapps" / "appmanifest_489830.acf");
+    out << R"test(
+"AppState"
+{
+	"appid"		"489830"
+	"installdir"		"Skyrim Special Edition"
+}
+)test";
+    out.close();
+  }
+
+  std::filesystem::path library1Path_;
+  std::filesystem::path library2Path_;
+};
+
+TEST_F(SteamLibraryIndexTest, shouldBeEmptyIfThereAreNoLibraries) {
+  const loot::steam::SteamLibraryIndex index({});
+
+  for (const auto gameId : ALL_GAME_IDS) {
+    EXPECT_TRUE(index.findGameInstalls(gameId).empty());
+  }
+}
+
+TEST_F(SteamLibraryIndexTest,
+       findGameInstallsShouldReturnInstallsFromAllLibrariesInOrder) {
+  createSkyrimSEInstall(library1Path_);
+  createSkyrimSEInstall(library2Path_);
+
+  const loot::steam::SteamLibraryIndex index({library2Path_, library1Path_});
+
+  const auto installs = index.findGameInstalls(GameId::tes5se);
+
+  ASSERT_EQ(2, installs.size());
+  EXPECT_EQ(GameId::tes5se, installs[0].gameId);
+  EXPECT_EQ(InstallSource::steam, installs[0].source);
+  EXPECT_EQ(library2Path_ / "steamapps" / "common" / "Skyrim Special Edition",
+            installs[0].installPath);
+  EXPECT_EQ(library1Path_ / "steamapps" / "common" / "Skyrim Special Edition",
+            installs[1].installPath);
+}
+
+TEST_F(SteamLibraryIndexTest,
+       findGameInstallsShouldReturnAnEmptyVectorForAGameThatIsNotInstalled) {
+  createSkyrimSEInstall(library1Path_);
+
+  const loot::steam::SteamLibraryIndex index({library1Path_});
+
+  EXPECT_TRUE(index.findGameInstalls(GameId::fo4).empty());
+}
+
 class Steam_FindGameInstallsTest
     : public BaseGameDetectionTest,
       public ::testing::WithParamInterface<GameId> {
@@ -30,9 +30,11 @@
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <boost/locale/generator.hpp>
+#include <chrono>
 #include <fstream>
 
 #include "gui/state/game/game.h"
+#include "gui/state/game/game_snapshot.h"
 #include "gui/state/game/helpers.h"
 #include "tests/common_game_test_fixture.h"
 #include "tests/gui/test_helpers.h"
@@ -1228,6 +1230,124 @@ TEST_P(GameTest, pluginsShouldBeFullyLoadedAfterFullyLoadingThem) {
   EXPECT_TRUE(game.arePluginsFullyLoaded());
 }
 
+TEST_P(GameTest, reloadChangedDataShouldReturnFalseIfNothingHasChanged) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+  game.loadMasterlist();
+  game.loadUserlist();
+  game.publishSnapshot({}, MessageContent::DEFAULT_LANGUAGE);
+
+  EXPECT_FALSE(game.reloadChangedData().hasChanges());
+}
+
+TEST_P(GameTest, reloadChangedDataShouldReloadAPluginThatHasBeenModified) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(false);
+  game.loadMasterlist();
+  game.loadUserlist();
+  game.publishSnapshot({}, MessageContent::DEFAULT_LANGUAGE);
+
+  const auto pluginPath = dataPath / BLANK_ESM;
+  std::filesystem::last_write_time(
+      pluginPath,
+      std::filesystem::last_write_time(pluginPath) + std::chrono::hours(1));
+
+  const auto changes = game.reloadChangedData();
+  EXPECT_EQ(std::vector<std::string>{BLANK_ESM}, changes.modifiedPlugins);
+  EXPECT_TRUE(changes.onlyPluginsModified());
+  EXPECT_FALSE(game.arePluginsFullyLoaded());
+
+  game.publishSnapshot({}, MessageContent::DEFAULT_LANGUAGE);
+
+  EXPECT_FALSE(game.reloadChangedData().hasChanges());
+}
+
+TEST_P(GameTest, reloadChangedDataShouldLoadAPluginThatHasBeenAdded) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+  game.loadMasterlist();
+  game.loadUserlist();
+  game.publishSnapshot({}, MessageContent::DEFAULT_LANGUAGE);
+
+  ASSERT_EQ(nullptr, game.getPlugin(BLANK_ESP));
+
+  copyPlugin(BLANK_ESP);
+
+  EXPECT_TRUE(game.reloadChangedData().hasChanges());
+  EXPECT_NE(nullptr, game.getPlugin(BLANK_ESP));
+}
+
+TEST_P(GameTest, reloadChangedDataShouldReturnTrueIfTheUserlistHasChanged) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+  game.loadMasterlist();
+  game.loadUserlist();
+  game.publishSnapshot({}, MessageContent::DEFAULT_LANGUAGE);
+
+  std::ofstream out(game.getUserlistPath());
+  out << "plugins:\n  - name: " << BLANK_ESM << "\n    dirty: []\n";
+  out.close();
+
+  EXPECT_TRUE(game.reloadChangedData().hasChanges());
+}
+
+TEST_P(GameTest,
+       reloadChangedDataShouldNotOnlyHaveModifiedPluginsIfTheUserlistChanged) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+  game.loadMasterlist();
+  game.loadUserlist();
+  game.publishSnapshot({}, MessageContent::DEFAULT_LANGUAGE);
+
+  const auto pluginPath = dataPath / BLANK_ESM;
+  std::filesystem::last_write_time(
+      pluginPath,
+      std::filesystem::last_write_time(pluginPath) + std::chrono::hours(1));
+
+  std::ofstream out(game.getUserlistPath());
+  out << "plugins:\n  - name: " << BLANK_ESM << "\n    dirty: []\n";
+  out.close();
+
+  const auto changes = game.reloadChangedData();
+  EXPECT_TRUE(changes.metadataChanged);
+  EXPECT_FALSE(changes.onlyPluginsModified());
+}
+
+TEST_P(GameTest, getSnapshotLanguageShouldReturnTheLanguageLastPublishedIn) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+
+  EXPECT_EQ(MessageContent::DEFAULT_LANGUAGE, game.getSnapshotLanguage());
+
+  game.publishSnapshot({}, "de");
+
+  EXPECT_EQ("de", game.getSnapshotLanguage());
+}
+
+TEST_P(GameTest, unloadShouldLeaveTheGameUninitialised) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+
+  EXPECT_GT(game.estimateMemoryUsage(), 0u);
+
+  game.unload();
+
+  EXPECT_FALSE(game.isInitialised());
+  EXPECT_EQ(0u, game.estimateMemoryUsage());
+  EXPECT_TRUE(game.getSnapshot()->pluginItems.empty());
+}
+
+TEST_P(GameTest,
+       estimateMemoryUsageShouldBeGreaterWhenPluginsAreFullyLoaded) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+  const auto headersOnlyUsage = game.estimateMemoryUsage();
+
+  game.loadAllInstalledPlugins(false);
+
+  EXPECT_GT(game.estimateMemoryUsage(), headersOnlyUsage);
+}
+
 TEST_P(GameTest,
        supportsLightPluginsShouldReturnTrueForSkyrimVRIfSKSEPluginIsInstalled) {
   Game game = createInitialisedGame();
@@ -1592,7 +1712,7 @@ TEST_P(GameTest, sortPluginsShouldReplaceExistingMissingPluginErrorMessages) {
 TEST_P(GameTest,
        incrementLoadOrderSortCountShouldSupressTheDefaultCachedMessage) {
   Game game = createInitialisedGame();
-  game.getSortCount().increment();
+  game.incrementSortCount();
 
   const auto messages =
       game.getMessages(MessageContent::DEFAULT_LANGUAGE, false);
@@ -1605,8 +1725,8 @@ TEST_P(GameTest,
   Game game = createInitialisedGame();
   auto expectedMessages =
       game.getMessages(MessageContent::DEFAULT_LANGUAGE, false);
-  game.getSortCount().increment();
-  game.getSortCount().decrement();
+  game.incrementSortCount();
+  game.decrementSortCount();
 
   EXPECT_EQ(expectedMessages,
             game.getMessages(MessageContent::DEFAULT_LANGUAGE, false));
@@ -1618,7 +1738,7 @@ TEST_P(
   Game game = createInitialisedGame();
   auto expectedMessages =
       game.getMessages(MessageContent::DEFAULT_LANGUAGE, false);
-  game.getSortCount().decrement();
+  game.decrementSortCount();
 
   EXPECT_EQ(expectedMessages,
             game.getMessages(MessageContent::DEFAULT_LANGUAGE, false));
@@ -1628,9 +1748,9 @@ TEST_P(
     GameTest,
     decrementingLoadOrderSortCountToANonZeroValueShouldSupressTheDefaultCachedMessage) {
   Game game = createInitialisedGame();
-  game.getSortCount().increment();
-  game.getSortCount().increment();
-  game.getSortCount().decrement();
+  game.incrementSortCount();
+  game.incrementSortCount();
+  game.decrementSortCount();
 
   const auto messages =
       game.getMessages(MessageContent::DEFAULT_LANGUAGE, false);
@@ -1685,6 +1805,140 @@ TEST_P(GameTest, appendingMessagesShouldStoreThemInTheGivenOrder) {
   EXPECT_EQ(messages[1], gameMessages[1]);
 }
 
+TEST_P(GameTest, initShouldPublishASnapshotWithOnlyTheUnsortedMessage) {
+  Game game = createInitialisedGame();
+
+  const auto snapshot = game.getSnapshot();
+
+  EXPECT_TRUE(snapshot->loadOrder.empty());
+  EXPECT_TRUE(snapshot->pluginItems.empty());
+  ASSERT_EQ(1, snapshot->generalMessages.size());
+  EXPECT_EQ(MessageSource::unsortedLoadOrderCheck,
+            snapshot->generalMessages[0].source);
+}
+
+TEST_P(GameTest, publishSnapshotShouldNotChangeEarlierSnapshots) {
+  Game game = createInitialisedGame();
+  const auto oldSnapshot = game.getSnapshot();
+
+  PluginItem pluginItem;
+  pluginItem.name = BLANK_ESM;
+  game.publishSnapshot({pluginItem}, MessageContent::DEFAULT_LANGUAGE);
+
+  const auto newSnapshot = game.getSnapshot();
+
+  EXPECT_GT(newSnapshot->version, oldSnapshot->version);
+  EXPECT_TRUE(oldSnapshot->pluginItems.empty());
+  ASSERT_EQ(1, newSnapshot->pluginItems.size());
+  EXPECT_EQ(BLANK_ESM, newSnapshot->pluginItems[0].name);
+}
+
+TEST_P(GameTest, publishSnapshotUpdateShouldReplaceItemsWithTheSameName) {
+  Game game = createInitialisedGame();
+
+  PluginItem firstItem;
+  firstItem.name = BLANK_ESM;
+  PluginItem secondItem;
+  secondItem.name = BLANK_ESP;
+  game.publishSnapshot({firstItem, secondItem},
+                       MessageContent::DEFAULT_LANGUAGE);
+
+  firstItem.isDirty = true;
+  game.publishSnapshotUpdate({firstItem});
+
+  const auto snapshot = game.getSnapshot();
+
+  ASSERT_EQ(2, snapshot->pluginItems.size());
+  EXPECT_EQ(BLANK_ESM, snapshot->pluginItems[0].name);
+  EXPECT_TRUE(snapshot->pluginItems[0].isDirty);
+  EXPECT_EQ(BLANK_ESP, snapshot->pluginItems[1].name);
+}
+
+TEST_P(GameTest, appendMessageShouldPublishTheMessageInANewSnapshot) {
+  Game game = createInitialisedGame();
+  const auto oldSnapshot = game.getSnapshot();
+
+  const auto message =
+      SourcedMessage{MessageType::say, MessageSource::messageMetadata, "1"};
+  game.appendMessage(message);
+
+  const auto newSnapshot = game.getSnapshot();
+
+  EXPECT_EQ(1, oldSnapshot->generalMessages.size());
+  ASSERT_EQ(2, newSnapshot->generalMessages.size());
+  EXPECT_EQ(message, newSnapshot->generalMessages[0]);
+}
+
+TEST_P(GameTest,
+       snapshotGeneralMessagesShouldBeInTheSameOrderAsGetMessagesOutput) {
+  Game game = createInitialisedGame();
+
+  game.incrementSortCount();
+  game.appendMessage(
+      SourcedMessage{MessageType::say, MessageSource::messageMetadata, "1"});
+  game.decrementSortCount();
+  game.appendMessage(
+      SourcedMessage{MessageType::warn, MessageSource::messageMetadata, "2"});
+
+  EXPECT_EQ(game.getMessages(MessageContent::DEFAULT_LANGUAGE, false),
+            game.getSnapshot()->generalMessages);
+}
+
+TEST_P(GameTest,
+       appendMessageShouldReuseMetadataMessagesDerivedWhenLastPublished) {
+  Game game = createInitialisedGame();
+
+  std::ofstream out(game.getMasterlistPath());
+  out << "globals:\n  - type: say\n    content: 'first'\n";
+  out.close();
+
+  game.loadMasterlist();
+  game.publishSnapshot({}, MessageContent::DEFAULT_LANGUAGE);
+
+  out.open(game.getMasterlistPath());
+  out << "globals:\n  - type: say\n    content: 'second'\n";
+  out.close();
+
+  game.loadMasterlist();
+
+  const auto message =
+      SourcedMessage{MessageType::warn, MessageSource::messageMetadata, "1"};
+  game.appendMessage(message);
+
+  const auto generalMessages = game.getSnapshot()->generalMessages;
+  ASSERT_EQ(3, generalMessages.size());
+  EXPECT_EQ("first", generalMessages[0].text);
+  EXPECT_EQ(message, generalMessages[1]);
+  EXPECT_EQ(MessageSource::unsortedLoadOrderCheck, generalMessages[2].source);
+
+  game.publishSnapshot({}, MessageContent::DEFAULT_LANGUAGE);
+
+  EXPECT_EQ("second", game.getSnapshot()->generalMessages[0].text);
+}
+
+TEST_P(GameTest, incrementSortCountShouldRemoveTheSnapshotUnsortedMessage) {
+  Game game = createInitialisedGame();
+  game.incrementSortCount();
+
+  EXPECT_TRUE(game.getSnapshot()->generalMessages.empty());
+
+  game.decrementSortCount();
+
+  ASSERT_EQ(1, game.getSnapshot()->generalMessages.size());
+  EXPECT_EQ(MessageSource::unsortedLoadOrderCheck,
+            game.getSnapshot()->generalMessages[0].source);
+}
+
+TEST_P(GameTest, setLoadOrderShouldPublishTheNewLoadOrderInASnapshot) {
+  Game game = createInitialisedGame();
+  const std::vector<std::string> loadOrder{
+      BLANK_DIFFERENT_ESM, BLANK_ESM, BLANK_DIFFERENT_ESP, BLANK_ESP};
+
+  ASSERT_NO_THROW(game.setLoadOrder(loadOrder));
+
+  EXPECT_EQ(loadOrder, game.getSnapshot()->loadOrder);
+}
+
 TEST_P(GameTest, loadMetadataShouldLoadMasterlistAndUserMetadata) {
   Game game = createInitialisedGame();
 
@@ -31,8 +31,10 @@ namespace loot {
 namespace test {
 class TestGamesManager : public GamesManager {
 public:
-  TestGamesManager() :
-      GamesManager(std::filesystem::path(), std::filesystem::path()) {}
+  TestGamesManager(size_t maxWarmGames = DEFAULT_MAX_WARM_GAMES) :
+      GamesManager(std::filesystem::path(),
+                   std::filesystem::path(),
+                   maxWarmGames) {}
 
   int getInitialiseCount(const std::string& folderName) {
     auto it = initialiseCounts_.find(folderName);
@@ -175,6 +177,21 @@ TEST(
             manager.getCurrentGame().getSettings().getMasterlistSource());
 }
 
+TEST(GamesManager,
+     setInstalledGamesShouldNotMoveTheCurrentGameIfItIsNotRecreated) {
+  TestGamesManager manager;
+  manager.setInstalledGames(TEST_GAMES_SETTINGS);
+
+  manager.setCurrentGame(TEST_GAMES_SETTINGS[2].getFolderName());
+  const auto& currentGame = manager.getCurrentGame();
+
+  // Removing an earlier game would move later games if they were stored by
+  // value.
+  manager.setInstalledGames({TEST_GAMES_SETTINGS[2]});
+
+  EXPECT_EQ(&currentGame, &manager.getCurrentGame());
+}
+
 TEST(GamesManager, getCurrentGameShouldThrowIfNoGamesAreInstalled) {
   TestGamesManager manager;
   EXPECT_THROW(manager.getCurrentGame(), std::runtime_error);
@@ -213,6 +230,54 @@ TEST(GamesManager, setCurrentGameShouldNotInitialiseGameData) {
             manager.getInitialiseCount(TEST_GAMES_SETTINGS[1].getFolderName()));
 }
 
+TEST(GamesManager, setCurrentGameShouldMakeTheGameTheMostRecentlyUsed) {
+  TestGamesManager manager;
+  manager.setInstalledGames(TEST_GAMES_SETTINGS);
+
+  manager.setCurrentGame(TEST_GAMES_SETTINGS[1].getFolderName());
+  manager.setCurrentGame(TEST_GAMES_SETTINGS[2].getFolderName());
+
+  EXPECT_EQ(std::vector<std::string>({
+                TEST_GAMES_SETTINGS[2].getFolderName(),
+                TEST_GAMES_SETTINGS[1].getFolderName(),
+            }),
+            manager.getWarmGameFolderNames());
+
+  manager.setCurrentGame(TEST_GAMES_SETTINGS[1].getFolderName());
+
+  EXPECT_EQ(std::vector<std::string>({
+                TEST_GAMES_SETTINGS[1].getFolderName(),
+                TEST_GAMES_SETTINGS[2].getFolderName(),
+            }),
+            manager.getWarmGameFolderNames());
+}
+
+TEST(GamesManager,
+     setCurrentGameShouldEvictTheLeastRecentlyUsedGameIfThereAreTooMany) {
+  TestGamesManager manager(1);
+  manager.setInstalledGames(TEST_GAMES_SETTINGS);
+
+  manager.setCurrentGame(TEST_GAMES_SETTINGS[1].getFolderName());
+  manager.setCurrentGame(TEST_GAMES_SETTINGS[2].getFolderName());
+
+  EXPECT_EQ(std::vector<std::string>({TEST_GAMES_SETTINGS[2].getFolderName()}),
+            manager.getWarmGameFolderNames());
+}
+
+TEST(GamesManager,
+     setInstalledGamesShouldForgetWarmGamesThatHaveNoLoadedData) {
+  TestGamesManager manager;
+  manager.setInstalledGames(TEST_GAMES_SETTINGS);
+
+  manager.setCurrentGame(TEST_GAMES_SETTINGS[1].getFolderName());
+  manager.setCurrentGame(TEST_GAMES_SETTINGS[2].getFolderName());
+
+  manager.setInstalledGames(TEST_GAMES_SETTINGS);
+
+  EXPECT_EQ(std::vector<std::string>({TEST_GAMES_SETTINGS[2].getFolderName()}),
+            manager.getWarmGameFolderNames());
+}
+
 TEST(GamesManager,
      getFirstInstalledGameFolderNameShouldReturnNulloptIfNoGamesAreInstalled) {
   TestGamesManager manager;
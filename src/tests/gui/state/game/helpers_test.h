@@ -26,10 +26,16 @@
 
 #include <gtest/gtest.h>
 
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <chrono>
 #include <fstream>
+#include <thread>
 
 #include "gui/state/game/helpers.h"
 #include "tests/common_game_test_fixture.h"
+#include "tests/gui/test_helpers.h"
 
 namespace loot {
 namespace test {
@@ -259,6 +265,271 @@ TEST_P(ResolveGameFilePathTest,
 
   EXPECT_FALSE(pluginPath.has_value());
 }
+
+class LoadOrderBackupTest : public ::testing::Test {
+protected:
+  LoadOrderBackupTest() : backupDirectory(getTempPath() / "backups") {
+    for (size_t i = 0; i < 20; i += 1) {
+      loadOrder.push_back("Plugin" + std::to_string(i) + ".esp");
+    }
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(backupDirectory.parent_path());
+  }
+
+  void backUp(const std::vector<std::string>& loadOrderToBackUp,
+              std::string_view name) {
+    backupLoadOrder(loadOrderToBackUp, backupDirectory, name);
+
+    // Backup files are distinguished using millisecond-precision timestamps,
+    // so make sure there's at least 1 ms between the creation of each.
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  std::vector<std::string> moveToEnd(std::vector<std::string> plugins,
+                                     size_t index) {
+    const auto plugin = plugins.at(index);
+    plugins.erase(plugins.begin() + index);
+    plugins.push_back(plugin);
+
+    return plugins;
+  }
+
+  QJsonObject readJson(const std::filesystem::path& path) {
+    QFile file(QString::fromStdString(path.u8string()));
+    file.open(QIODevice::ReadOnly);
+
+    return QJsonDocument::fromJson(file.readAll()).object();
+  }
+
+  std::filesystem::path backupDirectory;
+  std::vector<std::string> loadOrder;
+};
+
+TEST_F(LoadOrderBackupTest, findLoadOrderBackupsShouldListBackupsOldestFirst) {
+  backUp(loadOrder, "first");
+  backUp(moveToEnd(loadOrder, 0), "second");
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+
+  ASSERT_EQ(2, backups.size());
+  EXPECT_EQ("first", backups[0].name);
+  EXPECT_EQ(loadOrder.size(), backups[0].pluginCount);
+  EXPECT_FALSE(backups[0].autoDelete);
+  EXPECT_EQ("second", backups[1].name);
+  EXPECT_LT(backups[0].unixTimestampMs, backups[1].unixTimestampMs);
+}
+
+TEST_F(LoadOrderBackupTest, backupLoadOrderShouldStoreASmallChangeAsADelta) {
+  const auto changedLoadOrder = moveToEnd(loadOrder, 3);
+  backUp(loadOrder, "first");
+  backUp(changedLoadOrder, "second");
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+  ASSERT_EQ(2, backups.size());
+
+  const auto json = readJson(backups[1].path);
+  EXPECT_EQ(backups[0].path.filename().u8string(),
+            json.value("base").toString().toStdString());
+  EXPECT_TRUE(json.value("loadOrderDelta").isArray());
+  EXPECT_LT(std::filesystem::file_size(backups[1].path),
+            std::filesystem::file_size(backups[0].path));
+
+  EXPECT_EQ(changedLoadOrder.size(), backups[1].pluginCount);
+  EXPECT_EQ(loadOrder, readLoadOrderBackup(backups[0]));
+  EXPECT_EQ(changedLoadOrder, readLoadOrderBackup(backups[1]));
+}
+
+TEST_F(LoadOrderBackupTest,
+       backupLoadOrderShouldWriteDeltasWithoutTheKeysOlderVersionsRead) {
+  backUp(loadOrder, "first");
+  backUp(moveToEnd(loadOrder, 3), "second");
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+  ASSERT_EQ(2, backups.size());
+
+  // Older versions of LOOT skip backup files that have no creation timestamp,
+  // and read their load order from the loadOrder key.
+  const auto fullJson = readJson(backups[0].path);
+  EXPECT_TRUE(fullJson.contains("creationTimestamp"));
+  EXPECT_TRUE(fullJson.value("loadOrder").isArray());
+
+  const auto deltaJson = readJson(backups[1].path);
+  EXPECT_FALSE(deltaJson.contains("creationTimestamp"));
+  EXPECT_FALSE(deltaJson.contains("loadOrder"));
+}
+
+TEST_F(LoadOrderBackupTest,
+       backupLoadOrderShouldStoreALargeChangeAsAFullLoadOrder) {
+  const std::vector<std::string> changedLoadOrder(loadOrder.rbegin(),
+                                                  loadOrder.rend());
+  backUp(loadOrder, "first");
+  backUp(changedLoadOrder, "second");
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+  ASSERT_EQ(2, backups.size());
+
+  const auto json = readJson(backups[1].path);
+  EXPECT_FALSE(json.contains("base"));
+  EXPECT_EQ(changedLoadOrder, readLoadOrderBackup(backups[1]));
+}
+
+TEST_F(LoadOrderBackupTest,
+       backupLoadOrderShouldStoreAFullLoadOrderInEveryTenthBackup) {
+  std::vector<std::vector<std::string>> loadOrders;
+  for (size_t i = 0; i < 12; i += 1) {
+    loadOrders.push_back(moveToEnd(loadOrder, i));
+    backUp(loadOrders.back(), std::to_string(i));
+  }
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+  ASSERT_EQ(12, backups.size());
+
+  for (size_t i = 0; i < backups.size(); i += 1) {
+    const auto json = readJson(backups[i].path);
+    EXPECT_EQ(i % 10 == 0, json.contains("loadOrder")) << "Backup " << i;
+    EXPECT_EQ(loadOrders[i], readLoadOrderBackup(backups[i]));
+  }
+
+  EXPECT_EQ(backups[10].path.filename().u8string(),
+            readJson(backups[11].path).value("base").toString().toStdString());
+}
+
+TEST_F(LoadOrderBackupTest,
+       findLoadOrderBackupsShouldNotReadBackupsThatAreInTheIndex) {
+  backUp(loadOrder, "first");
+
+  const auto path = findLoadOrderBackups(backupDirectory).at(0).path;
+  std::ofstream out(path);
+  out << "invalid";
+  out.close();
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+
+  ASSERT_EQ(1, backups.size());
+  EXPECT_EQ("first", backups[0].name);
+  EXPECT_EQ(loadOrder.size(), backups[0].pluginCount);
+  EXPECT_THROW(readLoadOrderBackup(backups[0]), std::runtime_error);
+}
+
+TEST_F(LoadOrderBackupTest,
+       findLoadOrderBackupsShouldIndexBackupFilesThatAreNotInTheIndex) {
+  std::filesystem::create_directories(backupDirectory);
+  std::ofstream out(backupDirectory / "loadorder.1700000000000.json");
+  out << "{\n"
+      << "  \"autoDelete\": true,\n"
+      << "  \"creationTimestamp\": \"2023-11-14T22:13:20.000Z\",\n"
+      << "  \"loadOrder\": [\"Plugin0.esp\", \"Plugin1.esp\"],\n"
+      << "  \"name\": \"Legacy Backup\"\n"
+      << "}\n";
+  out.close();
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+
+  ASSERT_EQ(1, backups.size());
+  EXPECT_EQ("Legacy Backup", backups[0].name);
+  EXPECT_EQ(1700000000000, backups[0].unixTimestampMs);
+  EXPECT_TRUE(backups[0].autoDelete);
+  EXPECT_EQ(2, backups[0].pluginCount);
+  EXPECT_TRUE(std::filesystem::exists(backupDirectory / "index.json"));
+}
+
+TEST_F(LoadOrderBackupTest,
+       findLoadOrderBackupsShouldSkipIndexedBackupsThatHaveBeenDeleted) {
+  backUp(loadOrder, "first");
+  backUp(moveToEnd(loadOrder, 0), "second");
+
+  std::filesystem::remove(findLoadOrderBackups(backupDirectory).at(1).path);
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+
+  ASSERT_EQ(1, backups.size());
+  EXPECT_EQ("first", backups[0].name);
+}
+
+TEST_F(LoadOrderBackupTest,
+       deletingAFullBackupFileShouldNotAffectOtherFullBackups) {
+  const std::vector<std::string> secondLoadOrder(loadOrder.rbegin(),
+                                                 loadOrder.rend());
+  backUp(loadOrder, "first");
+  backUp(secondLoadOrder, "second");
+
+  std::filesystem::remove(findLoadOrderBackups(backupDirectory).at(0).path);
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+
+  ASSERT_EQ(1, backups.size());
+  EXPECT_EQ(secondLoadOrder, readLoadOrderBackup(backups[0]));
+}
+
+TEST_F(LoadOrderBackupTest,
+       findLoadOrderBackupsShouldRemoveDeltasWhoseBaseFileHasBeenDeleted) {
+  backUp(loadOrder, "first");
+  backUp(moveToEnd(loadOrder, 0), "second");
+
+  const auto backupsBefore = findLoadOrderBackups(backupDirectory);
+  ASSERT_EQ(2, backupsBefore.size());
+  std::filesystem::remove(backupsBefore[0].path);
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+
+  EXPECT_TRUE(backups.empty());
+  EXPECT_FALSE(std::filesystem::exists(backupsBefore[1].path));
+}
+
+TEST_F(LoadOrderBackupTest,
+       deleteLoadOrderBackupShouldKeepBackupsStoredAsDeltasAgainstItReadable) {
+  const auto secondLoadOrder = moveToEnd(loadOrder, 0);
+  const auto thirdLoadOrder = moveToEnd(loadOrder, 1);
+  backUp(loadOrder, "first");
+  backUp(secondLoadOrder, "second");
+  backUp(thirdLoadOrder, "third");
+
+  deleteLoadOrderBackup(findLoadOrderBackups(backupDirectory).at(0));
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+
+  ASSERT_EQ(2, backups.size());
+  EXPECT_TRUE(readJson(backups[0].path).contains("loadOrder"));
+  EXPECT_EQ(backups[0].path.filename().u8string(),
+            readJson(backups[1].path).value("base").toString().toStdString());
+  EXPECT_EQ(secondLoadOrder, readLoadOrderBackup(backups[0]));
+  EXPECT_EQ(thirdLoadOrder, readLoadOrderBackup(backups[1]));
+}
+
+TEST_F(LoadOrderBackupTest, deleteLoadOrderBackupShouldRemoveOnlyThatBackup) {
+  const auto secondLoadOrder = moveToEnd(loadOrder, 0);
+  backUp(loadOrder, "first");
+  backUp(secondLoadOrder, "second");
+
+  const auto firstBackup = findLoadOrderBackups(backupDirectory).at(0);
+  deleteLoadOrderBackup(firstBackup);
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+
+  EXPECT_FALSE(std::filesystem::exists(firstBackup.path));
+  ASSERT_EQ(1, backups.size());
+  EXPECT_EQ("second", backups[0].name);
+  EXPECT_EQ(secondLoadOrder, readLoadOrderBackup(backups[0]));
+}
+
+TEST_F(LoadOrderBackupTest,
+       automaticBackupsShouldBeLimitedToTenAndRemainReadable) {
+  std::vector<std::vector<std::string>> loadOrders;
+  for (size_t i = 0; i < 12; i += 1) {
+    loadOrders.push_back(moveToEnd(loadOrder, i));
+    backupLoadOrder(loadOrders.back(), backupDirectory);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  const auto backups = findLoadOrderBackups(backupDirectory);
+
+  ASSERT_EQ(10, backups.size());
+  for (size_t i = 0; i < backups.size(); i += 1) {
+    EXPECT_EQ(loadOrders[i + 2], readLoadOrderBackup(backups[i]));
+  }
+}
 }
 }
 
@@ -76,6 +76,19 @@ TEST(LootPaths, getPreludePathShouldUseLootDataPath) {
             paths.getPreludePath());
 }
 
+TEST(LootPaths, getGameDetectionCachePathShouldUseLootDataPath) {
+  LootPaths paths("", "");
+
+  EXPECT_EQ(paths.getLootDataPath() / "game-detection-cache.json",
+            paths.getGameDetectionCachePath());
+}
+
+TEST(LootPaths, getTracePathShouldUseLootDataPath) {
+  LootPaths paths("", "");
+
+  EXPECT_EQ(paths.getLootDataPath() / "LOOTTrace.json", paths.getTracePath());
+}
+
 #ifdef _WIN32
 TEST(LootPaths,
      constructorShouldSetAppPathToExecutableDirectoryIfGivenPathIsEmpty) {
@@ -83,6 +83,7 @@ protected:
 
 TEST_F(LootSettingsTest, defaultConstructorShouldSetDefaultValues) {
   EXPECT_FALSE(settings_.isDebugLoggingEnabled());
+  EXPECT_FALSE(settings_.isTracingEnabled());
   EXPECT_TRUE(settings_.isMasterlistUpdateBeforeSortEnabled());
   EXPECT_TRUE(settings_.isLootUpdateCheckEnabled());
   EXPECT_EQ("auto", settings_.getGame());
@@ -90,6 +91,8 @@ TEST_F(LootSettingsTest, defaultConstructorShouldSetDefaultValues) {
   EXPECT_TRUE(settings_.getLastVersion().empty());
   EXPECT_EQ("en", settings_.getLanguage());
   EXPECT_EQ("default", settings_.getTheme());
+  EXPECT_EQ(4u, settings_.getMaxConcurrentDownloads());
+  EXPECT_EQ(std::chrono::seconds(10), settings_.getGameDetectionTimeBudget());
   EXPECT_FALSE(settings_.getFilters().hideVersionNumbers);
   EXPECT_TRUE(settings_.getFilters().hideBashTags);
   EXPECT_FALSE(settings_.getFilters().hideCRCs);
@@ -140,6 +143,7 @@ TEST_F(LootSettingsTest, loadingShouldReadFromATomlFile) {
   using std::endl;
   std::ofstream out(settingsFile_);
   out << "enableDebugLogging = true" << endl
+      << "enableTracing = true" << endl
       << "updateMasterlist = true" << endl
       << "enableLootUpdateCheck = false" << endl
       << "game = \"Oblivion\"" << endl
@@ -148,6 +152,8 @@ TEST_F(LootSettingsTest, loadingShouldReadFromATomlFile) {
       << "theme = \"dark\"" << endl
       << "lastVersion = \"0.7.1\"" << endl
       << "preludeSource = \"../prelude.yaml\"" << endl
+      << "maxConcurrentDownloads = 2" << endl
+      << "gameDetectionTimeBudget = 30" << endl
       << endl
       << "[window]" << endl
       << "top = 1" << endl
@@ -186,6 +192,7 @@ TEST_F(LootSettingsTest, loadingShouldReadFromATomlFile) {
   settings_.load(settingsFile_);
 
   EXPECT_TRUE(settings_.isDebugLoggingEnabled());
+  EXPECT_TRUE(settings_.isTracingEnabled());
   EXPECT_TRUE(settings_.isMasterlistUpdateBeforeSortEnabled());
   EXPECT_FALSE(settings_.isLootUpdateCheckEnabled());
   EXPECT_EQ("Oblivion", settings_.getGame());
@@ -194,6 +201,8 @@ TEST_F(LootSettingsTest, loadingShouldReadFromATomlFile) {
   EXPECT_EQ("fr", settings_.getLanguage());
   EXPECT_EQ("dark", settings_.getTheme());
   EXPECT_EQ("../prelude.yaml", settings_.getPreludeSource());
+  EXPECT_EQ(2u, settings_.getMaxConcurrentDownloads());
+  EXPECT_EQ(std::chrono::seconds(30), settings_.getGameDetectionTimeBudget());
 
   ASSERT_TRUE(settings_.getMainWindowPosition().has_value());
   EXPECT_EQ(1, settings_.getMainWindowPosition().value().top);
@@ -1666,6 +1675,41 @@ TEST_F(LootSettingsTest, loadingTomlShouldSkipUnrecognisedGames) {
   EXPECT_EQ("Game Name", settings_.getGameSettings()[0].getName());
 }
 
+TEST_F(LootSettingsTest,
+       loadingShouldIgnoreAMaxConcurrentDownloadsValueLessThanOne) {
+  std::ofstream out(settingsFile_);
+  out << "maxConcurrentDownloads = 0";
+  out.close();
+
+  settings_.load(settingsFile_);
+
+  EXPECT_EQ(4u, settings_.getMaxConcurrentDownloads());
+}
+
+TEST_F(LootSettingsTest, setMaxConcurrentDownloadsShouldAllowAtLeastOne) {
+  settings_.setMaxConcurrentDownloads(0);
+
+  EXPECT_EQ(1u, settings_.getMaxConcurrentDownloads());
+}
+
+TEST_F(LootSettingsTest,
+       loadingShouldIgnoreAGameDetectionTimeBudgetValueLessThanOne) {
+  std::ofstream out(settingsFile_);
+  out << "gameDetectionTimeBudget = 0";
+  out.close();
+
+  settings_.load(settingsFile_);
+
+  EXPECT_EQ(std::chrono::seconds(10), settings_.getGameDetectionTimeBudget());
+}
+
+TEST_F(LootSettingsTest,
+       setGameDetectionTimeBudgetShouldAllowAtLeastOneSecond) {
+  settings_.setGameDetectionTimeBudget(std::chrono::seconds(0));
+
+  EXPECT_EQ(std::chrono::seconds(1), settings_.getGameDetectionTimeBudget());
+}
+
 TEST_F(LootSettingsTest, saveShouldWriteSettingsToPassedTomlFile) {
   const std::string game = "Oblivion";
   const std::string language = "fr";
@@ -1709,6 +1753,7 @@ TEST_F(LootSettingsTest, saveShouldWriteSettingsToPassedTomlFile) {
   filters.hideCRCs = true;
 
   settings_.enableDebugLogging(true);
+  settings_.enableTracing(true);
   settings_.enableMasterlistUpdateBeforeSort(true);
   settings_.enableLootUpdateCheck(false);
   settings_.setDefaultGame(game);
@@ -1716,6 +1761,8 @@ TEST_F(LootSettingsTest, saveShouldWriteSettingsToPassedTomlFile) {
   settings_.setLanguage(language);
   settings_.setTheme(theme);
   settings_.setPreludeSource(preludeSource);
+  settings_.setMaxConcurrentDownloads(3);
+  settings_.setGameDetectionTimeBudget(std::chrono::seconds(20));
 
   settings_.storeMainWindowPosition(windowPosition);
   settings_.storeGroupsEditorWindowPosition(groupsEditorWindowPosition);
@@ -1730,6 +1777,7 @@ TEST_F(LootSettingsTest, saveShouldWriteSettingsToPassedTomlFile) {
   settings.load(settingsFile_);
 
   EXPECT_TRUE(settings.isDebugLoggingEnabled());
+  EXPECT_TRUE(settings.isTracingEnabled());
   EXPECT_TRUE(settings.isMasterlistUpdateBeforeSortEnabled());
   EXPECT_FALSE(settings.isLootUpdateCheckEnabled());
   EXPECT_EQ(game, settings.getGame());
@@ -1737,6 +1785,8 @@ TEST_F(LootSettingsTest, saveShouldWriteSettingsToPassedTomlFile) {
   EXPECT_EQ(language, settings.getLanguage());
   EXPECT_EQ(theme, settings.getTheme());
   EXPECT_EQ(preludeSource, settings.getPreludeSource());
+  EXPECT_EQ(3u, settings.getMaxConcurrentDownloads());
+  EXPECT_EQ(std::chrono::seconds(20), settings.getGameDetectionTimeBudget());
 
   ASSERT_TRUE(settings_.getMainWindowPosition().has_value());
   EXPECT_EQ(1, settings_.getMainWindowPosition().value().top);
@@ -0,0 +1,159 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+
+#ifndef LOOT_TESTS_GUI_STATE_STAGE_GRAPH_TEST
+#define LOOT_TESTS_GUI_STATE_STAGE_GRAPH_TEST
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "gui/state/stage_graph.h"
+
+namespace loot {
+namespace test {
+StageTiming createTiming(const std::string& name,
+                         const std::vector<std::string>& dependencies,
+                         int startMs,
+                         int endMs) {
+  const auto origin = std::chrono::steady_clock::time_point();
+  return StageTiming{name,
+                     dependencies,
+                     origin + std::chrono::milliseconds(startMs),
+                     origin + std::chrono::milliseconds(endMs)};
+}
+
+TEST(StageGraph, addStageShouldThrowIfADependencyHasNotBeenAdded) {
+  StageGraph graph;
+
+  EXPECT_THROW(graph.addStage("a", {"b"}, []() {}), std::invalid_argument);
+}
+
+TEST(StageGraph, addStageShouldThrowIfTheStageHasAlreadyBeenAdded) {
+  StageGraph graph;
+  graph.addStage("a", {}, []() {});
+
+  EXPECT_THROW(graph.addStage("a", {}, []() {}), std::invalid_argument);
+}
+
+TEST(StageGraph, runShouldRunStagesAfterTheirDependencies) {
+  std::mutex mutex;
+  std::vector<std::string> order;
+  const auto recordRun = [&](const std::string& name) {
+    return [&, name]() {
+      std::lock_guard<std::mutex> guard(mutex);
+      order.push_back(name);
+    };
+  };
+
+  StageGraph graph;
+  graph.addStage("a", {}, recordRun("a"));
+  graph.addStage("b", {"a"}, recordRun("b"));
+  graph.addStage("c", {"b"}, recordRun("c"));
+
+  graph.run();
+
+  EXPECT_EQ(std::vector<std::string>({"a", "b", "c"}), order);
+}
+
+TEST(StageGraph, runShouldRunIndependentStagesConcurrently) {
+  // Each stage waits for the other to start, so this would deadlock if they
+  // ran one after the other.
+  std::atomic<int> startedCount{0};
+  const auto waitForOther = [&]() {
+    startedCount += 1;
+    while (startedCount < 2) {
+      std::this_thread::yield();
+    }
+  };
+
+  StageGraph graph;
+  graph.addStage("a", {}, waitForOther);
+  graph.addStage("b", {}, waitForOther);
+
+  graph.run();
+
+  EXPECT_EQ(2, startedCount);
+}
+
+TEST(StageGraph, runShouldReturnTimingsWithDependencyNames) {
+  StageGraph graph({"upstream"});
+  graph.addStage("a", {}, []() {});
+  graph.addStage("b", {"a"}, []() {});
+
+  const auto timings = graph.run();
+
+  ASSERT_EQ(2, timings.size());
+  EXPECT_EQ("a", timings[0].name);
+  EXPECT_EQ(std::vector<std::string>({"upstream"}), timings[0].dependencies);
+  EXPECT_EQ("b", timings[1].name);
+  EXPECT_EQ(std::vector<std::string>({"a"}), timings[1].dependencies);
+  EXPECT_LE(timings[0].end, timings[1].start);
+}
+
+TEST(StageGraph, runShouldRethrowAStageExceptionAndNotRunItsDependents) {
+  bool dependentRan = false;
+
+  StageGraph graph;
+  graph.addStage("a", {}, []() { throw std::runtime_error("error"); });
+  graph.addStage("b", {"a"}, [&]() { dependentRan = true; });
+
+  EXPECT_THROW(graph.run(), std::runtime_error);
+  EXPECT_FALSE(dependentRan);
+}
+
+TEST(StageTimings, recordShouldDoNothingAfterFinishIsCalled) {
+  StageTimings timings;
+  timings.record(createTiming("a", {}, 0, 1));
+  timings.finish();
+  timings.record(createTiming("b", {}, 1, 2));
+
+  ASSERT_EQ(1, timings.getTimings().size());
+  EXPECT_EQ("a", timings.getTimings()[0].name);
+}
+
+TEST(StageTimings, getSlowestPathShouldFollowTheDependenciesThatEndedLast) {
+  StageTimings timings;
+  timings.record(createTiming("settings", {}, 0, 10));
+  timings.record(createTiming("roots", {}, 0, 30));
+  timings.record(createTiming("detection", {"settings", "roots"}, 30, 40));
+  timings.record(createTiming("headers", {"detection"}, 40, 100));
+  timings.record(createTiming("masterlist", {"detection"}, 40, 60));
+  timings.record(createTiming("derive", {"headers", "masterlist"}, 100, 110));
+
+  EXPECT_EQ(std::vector<std::string>(
+                {"roots", "detection", "headers", "derive"}),
+            timings.getSlowestPath());
+}
+
+TEST(StageTimings, getSlowestPathShouldBeEmptyIfNoTimingsHaveBeenRecorded) {
+  StageTimings timings;
+
+  EXPECT_TRUE(timings.getSlowestPath().empty());
+}
+}
+}
+
+#endif
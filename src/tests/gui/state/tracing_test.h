@@ -0,0 +1,162 @@
+/*  LOOT
+
+    A modding utility for Starfield and some Elder Scrolls and Fallout games.
+
+    Copyright (C) 2013-2026 Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_TRACING_TEST
+#define LOOT_TESTS_GUI_STATE_TRACING_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "gui/state/tracing.h"
+#include "tests/common_game_test_fixture.h"
+
+namespace loot {
+namespace test {
+class TracingTest : public FilesystemTest {
+protected:
+  TracingTest() : tracePath_(rootPath_ / "LOOTTrace.json") {}
+
+  void SetUp() override { setTracePath(tracePath_); }
+
+  void TearDown() override {
+    enableTracing(false);
+    setTracePath({});
+
+    FilesystemTest::TearDown();
+  }
+
+  QJsonArray readTraceEvents() const {
+    std::ifstream in(tracePath_, std::ios::binary);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+
+    // The closing bracket is deliberately never written.
+    const auto json = QByteArray::fromStdString(buffer.str() + "]");
+
+    return QJsonDocument::fromJson(json).array();
+  }
+
+  std::filesystem::path tracePath_;
+};
+
+TEST_F(TracingTest, spansShouldNotBeRecordedIfTracingIsDisabled) {
+  { TraceSpan span("query", "test"); }
+
+  EXPECT_FALSE(isTracingEnabled());
+  EXPECT_FALSE(std::filesystem::exists(tracePath_));
+}
+
+TEST_F(TracingTest, enableTracingShouldDoNothingIfNoTracePathIsSet) {
+  setTracePath({});
+  enableTracing(true);
+
+  EXPECT_FALSE(isTracingEnabled());
+}
+
+TEST_F(TracingTest, spansShouldBeWrittenAsCompleteEvents) {
+  enableTracing(true);
+  ASSERT_TRUE(isTracingEnabled());
+
+  { TraceSpan span("libloot", "SortPlugins"); }
+
+  const auto events = readTraceEvents();
+  ASSERT_EQ(2, events.size());
+
+  EXPECT_EQ("process_name", events[0].toObject()["name"].toString());
+  EXPECT_EQ("M", events[0].toObject()["ph"].toString());
+
+  const auto event = events[1].toObject();
+  EXPECT_EQ("SortPlugins", event["name"].toString());
+  EXPECT_EQ("libloot", event["cat"].toString());
+  EXPECT_EQ("X", event["ph"].toString());
+  EXPECT_LE(0, event["ts"].toInteger());
+  EXPECT_LE(0, event["dur"].toInteger());
+  EXPECT_EQ(1, event["pid"].toInteger());
+  EXPECT_EQ(1, event["tid"].toInteger());
+}
+
+TEST_F(TracingTest, eventsFromDifferentThreadsShouldHaveDifferentThreadIds) {
+  enableTracing(true);
+
+  { TraceSpan span("task", "first"); }
+  std::thread([]() { TraceSpan span("task", "second"); }).join();
+  { TraceSpan span("task", "third"); }
+
+  const auto events = readTraceEvents();
+  ASSERT_EQ(4, events.size());
+
+  EXPECT_EQ(1, events[1].toObject()["tid"].toInteger());
+  EXPECT_EQ(2, events[2].toObject()["tid"].toInteger());
+  EXPECT_EQ(1, events[3].toObject()["tid"].toInteger());
+}
+
+TEST_F(TracingTest, eventNamesShouldBeEscaped) {
+  enableTracing(true);
+
+  const auto name = std::string("C:\\\"Games\"\n\x01");
+  { TraceSpan span("filesystem", name); }
+
+  const auto events = readTraceEvents();
+  ASSERT_EQ(2, events.size());
+
+  EXPECT_EQ(QString::fromStdString(name),
+            events[1].toObject()["name"].toString());
+}
+
+TEST_F(TracingTest, reenablingTracingShouldAppendToTheTrace) {
+  enableTracing(true);
+  { TraceSpan span("query", "first"); }
+  enableTracing(false);
+  { TraceSpan span("query", "ignored"); }
+  enableTracing(true);
+  { TraceSpan span("query", "second"); }
+
+  const auto events = readTraceEvents();
+  ASSERT_EQ(3, events.size());
+
+  EXPECT_EQ("first", events[1].toObject()["name"].toString());
+  EXPECT_EQ("second", events[2].toObject()["name"].toString());
+}
+
+TEST_F(TracingTest, recordTraceEventShouldUseTheGivenTimes) {
+  enableTracing(true);
+
+  const auto start = std::chrono::steady_clock::now();
+  recordTraceEvent(
+      "task", "background", start, start + std::chrono::milliseconds(3));
+
+  const auto events = readTraceEvents();
+  ASSERT_EQ(2, events.size());
+
+  EXPECT_EQ(3000, events[1].toObject()["dur"].toInteger());
+}
+}
+}
+
+#endif